@@ -0,0 +1,130 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid);
+ *            POSTAMBLE(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid);
+ *            LOOPPREAMBLE(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid, loopFlag);
+ *            LOOPPOSTAMBLE(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid, loopFlag);
+ *            CLEANUP(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid);
+ *        where:
+ *            input_cuda: variable (float *);
+ *            input_cudaSz: number of members in variable (unsigned int);
+ *            input_hidden_cuda: variable (float *);
+ *            input_hidden_cudaSz: number of members in variable (unsigned int);
+ *            hidden_partial_sum: variable (float *);
+ *            hidden_partial_sumSz: number of members in variable (unsigned int);
+ *            hidden_partial_sumC: variable (float *);
+ *            hidden_partial_sumCSz: number of members in variable (unsigned int);
+ *            in: variable (int);
+ *            hid: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *input_cuda = NULL;
+static unsigned int input_cudaSz = 0;
+static float *input_hidden_cuda = NULL;
+static unsigned int input_hidden_cudaSz = 0;
+static float *hidden_partial_sum = NULL;
+static unsigned int hidden_partial_sumSz = 0;
+static float *hidden_partial_sumC = NULL;
+static unsigned int hidden_partial_sumCSz = 0;
+static int in;
+static int hid;
+
+/* Work sizes */
+static size_t *globalSizeBpnn_Layerforward_Ocl = NULL;
+static size_t *localSizeBpnn_Layerforward_Ocl = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(input_cuda),
+	RT_BIND_POINTER(input_hidden_cuda),
+	RT_BIND_POINTER_C(hidden_partial_sum),
+	RT_BIND_VALUE(in),
+	RT_BIND_VALUE(hid),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(bpnn_layerforward_ocl, Bpnn_Layerforward_Ocl),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(input_cuda, input_cudaSz, input_hidden_cuda, input_hidden_cudaSz, hidden_partial_sum, hidden_partial_sumSz, hidden_partial_sumC, hidden_partial_sumCSz, in, hid);
+}
@@ -96,6 +96,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBpnn_Layerforward_Ocl = NULL;
+	cl_command_queue transferQueueBpnn_Layerforward_Ocl = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -106,6 +107,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimBpnn_Layerforward_Ocl = 3;
 	size_t globalSizeBpnn_Layerforward_Ocl[3] = {
 		16, 65536, 1
@@ -157,7 +159,13 @@ int main(void) {
 
 	/* Create command queue for bpnn_layerforward_ocl kernel */
 	PRINT_STEP("Creating command queue for \"bpnn_layerforward_ocl\"...");
-	queueBpnn_Layerforward_Ocl = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBpnn_Layerforward_Ocl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bpnn_layerforward_ocl kernel */
+	PRINT_STEP("Creating transfer command queue for \"bpnn_layerforward_ocl\"...");
+	transferQueueBpnn_Layerforward_Ocl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -228,11 +236,11 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBpnn_Layerforward_Ocl, input_cudaK, CL_TRUE, 0, 65537 * sizeof(float), input_cuda, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Layerforward_Ocl, input_cudaK, TRANSFER_BLOCKING, 0, 65537 * sizeof(float), input_cuda, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input_cuda"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (input_cudaK)"));
-		fRet = clEnqueueWriteBuffer(queueBpnn_Layerforward_Ocl, input_hidden_cudaK, CL_TRUE, 0, 1114129 * sizeof(float), input_hidden_cuda, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Layerforward_Ocl, input_hidden_cudaK, TRANSFER_BLOCKING, 0, 1114129 * sizeof(float), input_hidden_cuda, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input_hidden_cuda"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (input_hidden_cudaK)"));
-		fRet = clEnqueueWriteBuffer(queueBpnn_Layerforward_Ocl, hidden_partial_sumK, CL_TRUE, 0, 65536 * sizeof(float), hidden_partial_sum, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Layerforward_Ocl, hidden_partial_sumK, TRANSFER_BLOCKING, 0, 65536 * sizeof(float), hidden_partial_sum, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "hidden_partial_sum"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (hidden_partial_sumK)"));
 		fRet = clSetKernelArg(kernelBpnn_Layerforward_Ocl, 5, sizeof(int), &in);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (in)"));
@@ -241,8 +249,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBpnn_Layerforward_Ocl);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBpnn_Layerforward_Ocl, kernelBpnn_Layerforward_Ocl, workDimBpnn_Layerforward_Ocl, NULL, globalSizeBpnn_Layerforward_Ocl, localSizeBpnn_Layerforward_Ocl, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBpnn_Layerforward_Ocl, kernelBpnn_Layerforward_Ocl, workDimBpnn_Layerforward_Ocl, NULL, globalSizeBpnn_Layerforward_Ocl, localSizeBpnn_Layerforward_Ocl, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bpnn_layerforward_ocl"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBpnn_Layerforward_Ocl);
 		gettimeofday(&tNow, NULL);
@@ -250,9 +259,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBpnn_Layerforward_Ocl, hidden_partial_sumK, CL_TRUE, 0, 65536 * sizeof(float), hidden_partial_sum, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBpnn_Layerforward_Ocl, hidden_partial_sumK, TRANSFER_BLOCKING, 0, 65536 * sizeof(float), hidden_partial_sum, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "hidden_partial_sum"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -263,6 +274,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -280,6 +292,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(input_cudaK)
 		clReleaseMemObject(input_cudaK);
@@ -309,6 +324,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBpnn_Layerforward_Ocl)
 		clReleaseCommandQueue(queueBpnn_Layerforward_Ocl);
+	if(transferQueueBpnn_Layerforward_Ocl)
+		clReleaseCommandQueue(transferQueueBpnn_Layerforward_Ocl);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,137 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz);
+ *            POSTAMBLE(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz);
+ *            LOOPPREAMBLE(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz, loopFlag);
+ *            LOOPPOSTAMBLE(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz, loopFlag);
+ *            CLEANUP(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz);
+ *        where:
+ *            delta: variable (float *);
+ *            deltaSz: number of members in variable (unsigned int);
+ *            hid: variable (int);
+ *            ly: variable (float *);
+ *            lySz: number of members in variable (unsigned int);
+ *            lyC: variable (float *);
+ *            lyCSz: number of members in variable (unsigned int);
+ *            in: variable (int);
+ *            w: variable (float *);
+ *            wSz: number of members in variable (unsigned int);
+ *            wC: variable (float *);
+ *            wCSz: number of members in variable (unsigned int);
+ *            oldw: variable (float *);
+ *            oldwSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *delta = NULL;
+static unsigned int deltaSz = 0;
+static int hid;
+static float *ly = NULL;
+static unsigned int lySz = 0;
+static float *lyC = NULL;
+static unsigned int lyCSz = 0;
+static int in;
+static float *w = NULL;
+static unsigned int wSz = 0;
+static float *wC = NULL;
+static unsigned int wCSz = 0;
+static float *oldw = NULL;
+static unsigned int oldwSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeBpnn_Adjust_Weights_Ocl = NULL;
+static size_t *localSizeBpnn_Adjust_Weights_Ocl = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(delta),
+	RT_BIND_VALUE(hid),
+	RT_BIND_POINTER_C(ly),
+	RT_BIND_VALUE(in),
+	RT_BIND_POINTER_C(w),
+	RT_BIND_POINTER(oldw),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(bpnn_adjust_weights_ocl, Bpnn_Adjust_Weights_Ocl),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(delta, deltaSz, hid, ly, lySz, lyC, lyCSz, in, w, wSz, wC, wCSz, oldw, oldwSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -100,6 +100,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBpnn_Adjust_Weights_Ocl = NULL;
+	cl_command_queue transferQueueBpnn_Adjust_Weights_Ocl = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -108,8 +109,10 @@ int main(void) {
 	cl_kernel kernelBpnn_Adjust_Weights_Ocl = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 8);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimBpnn_Adjust_Weights_Ocl = 3;
 	size_t globalSizeBpnn_Adjust_Weights_Ocl[3] = {
 		16, 65536, 1
@@ -164,7 +167,13 @@ int main(void) {
 
 	/* Create command queue for bpnn_adjust_weights_ocl kernel */
 	PRINT_STEP("Creating command queue for \"bpnn_adjust_weights_ocl\"...");
-	queueBpnn_Adjust_Weights_Ocl = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBpnn_Adjust_Weights_Ocl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bpnn_adjust_weights_ocl kernel */
+	PRINT_STEP("Creating transfer command queue for \"bpnn_adjust_weights_ocl\"...");
+	transferQueueBpnn_Adjust_Weights_Ocl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -185,18 +194,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create bpnn_adjust_weights_ocl kernel */
 	PRINT_STEP("Creating kernel \"bpnn_adjust_weights_ocl\" from program...");
 	kernelBpnn_Adjust_Weights_Ocl = clCreateKernel(program, "bpnn_adjust_weights_ocl", &fRet);
@@ -234,23 +256,24 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBpnn_Adjust_Weights_Ocl, deltaK, CL_TRUE, 0, 17 * sizeof(float), delta, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Adjust_Weights_Ocl, deltaK, TRANSFER_BLOCKING, 0, 17 * sizeof(float), delta, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "delta"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (deltaK)"));
 		fRet = clSetKernelArg(kernelBpnn_Adjust_Weights_Ocl, 1, sizeof(int), &hid);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (hid)"));
-		fRet = clEnqueueWriteBuffer(queueBpnn_Adjust_Weights_Ocl, lyK, CL_TRUE, 0, 65537 * sizeof(float), ly, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Adjust_Weights_Ocl, lyK, TRANSFER_BLOCKING, 0, 65537 * sizeof(float), ly, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "ly"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (lyK)"));
 		fRet = clSetKernelArg(kernelBpnn_Adjust_Weights_Ocl, 3, sizeof(int), &in);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (in)"));
-		fRet = clEnqueueWriteBuffer(queueBpnn_Adjust_Weights_Ocl, wK, CL_TRUE, 0, 1114129 * sizeof(float), w, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Adjust_Weights_Ocl, wK, TRANSFER_BLOCKING, 0, 1114129 * sizeof(float), w, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "w"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (wK)"));
-		fRet = clEnqueueWriteBuffer(queueBpnn_Adjust_Weights_Ocl, oldwK, CL_TRUE, 0, 1114129 * sizeof(float), oldw, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBpnn_Adjust_Weights_Ocl, oldwK, TRANSFER_BLOCKING, 0, 1114129 * sizeof(float), oldw, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "oldw"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (oldwK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBpnn_Adjust_Weights_Ocl);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBpnn_Adjust_Weights_Ocl, kernelBpnn_Adjust_Weights_Ocl, workDimBpnn_Adjust_Weights_Ocl, NULL, globalSizeBpnn_Adjust_Weights_Ocl, localSizeBpnn_Adjust_Weights_Ocl, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBpnn_Adjust_Weights_Ocl, kernelBpnn_Adjust_Weights_Ocl, workDimBpnn_Adjust_Weights_Ocl, NULL, globalSizeBpnn_Adjust_Weights_Ocl, localSizeBpnn_Adjust_Weights_Ocl, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bpnn_adjust_weights_ocl"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBpnn_Adjust_Weights_Ocl);
 		gettimeofday(&tNow, NULL);
@@ -258,11 +281,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBpnn_Adjust_Weights_Ocl, lyK, CL_TRUE, 0, 65537 * sizeof(float), ly, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBpnn_Adjust_Weights_Ocl, wK, CL_TRUE, 0, 1114129 * sizeof(float), w, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBpnn_Adjust_Weights_Ocl, oldwK, CL_TRUE, 0, 1114129 * sizeof(float), oldw, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBpnn_Adjust_Weights_Ocl, lyK, TRANSFER_BLOCKING, 0, 65537 * sizeof(float), ly, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "ly"));
+		fRet = clEnqueueReadBuffer(transferQueueBpnn_Adjust_Weights_Ocl, wK, TRANSFER_BLOCKING, 0, 1114129 * sizeof(float), w, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "w"));
+		fRet = clEnqueueReadBuffer(transferQueueBpnn_Adjust_Weights_Ocl, oldwK, TRANSFER_BLOCKING, 0, 1114129 * sizeof(float), oldw, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "oldw"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -273,6 +298,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -299,6 +326,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(deltaK)
 		clReleaseMemObject(deltaK);
@@ -332,6 +362,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBpnn_Adjust_Weights_Ocl)
 		clReleaseCommandQueue(queueBpnn_Adjust_Weights_Ocl);
+	if(transferQueueBpnn_Adjust_Weights_Ocl)
+		clReleaseCommandQueue(transferQueueBpnn_Adjust_Weights_Ocl);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -24,6 +24,7 @@
 #define LIST_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 typedef union {
 	int d;
@@ -31,15 +32,22 @@ typedef union {
 	char *s;
 } elem_u;
 
-typedef struct elem_t {
-	elem_u val;
-	struct elem_t *next; 
-} elem_t;
+/* Strings are copied into blocks owned by the list */
+typedef struct list_block_t {
+	struct list_block_t *next;
+	size_t used;
+	size_t capacity;
+	char data[];
+} list_block_t;
 
+/* Elements are stored contiguously from elems[front], so that indexed access is constant time */
 typedef struct {
 	unsigned int size;
 	unsigned int type;
-	elem_t *head;
+	unsigned int front;
+	unsigned int capacity;
+	elem_u *elems;
+	list_block_t *strings;
 } list_t;
 
 list_t *dlist_create(void);
@@ -0,0 +1,161 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag);
+ *            POSTAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag);
+ *            LOOPPREAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag, loopFlag);
+ *            LOOPPOSTAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag, loopFlag);
+ *            CLEANUP(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag);
+ *        where:
+ *            levels: variable (unsigned int *);
+ *            levelsSz: number of members in variable (unsigned int);
+ *            levelsC: variable (unsigned int *);
+ *            levelsCSz: number of members in variable (unsigned int);
+ *            edgeArray: variable (unsigned int *);
+ *            edgeArraySz: number of members in variable (unsigned int);
+ *            edgeArrayAux: variable (unsigned int *);
+ *            edgeArrayAuxSz: number of members in variable (unsigned int);
+ *            W_SZ: variable (int);
+ *            CHUNK_SZ: variable (int);
+ *            numVertices: variable (unsigned int);
+ *            curr: variable (int);
+ *            flag: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static unsigned int *levels = NULL;
+static unsigned int levelsSz = 0;
+static unsigned int *levelsC = NULL;
+static unsigned int levelsCSz = 0;
+static unsigned int *edgeArray = NULL;
+static unsigned int edgeArraySz = 0;
+static unsigned int *edgeArrayAux = NULL;
+static unsigned int edgeArrayAuxSz = 0;
+static int W_SZ;
+static int CHUNK_SZ;
+static unsigned int numVertices;
+static int curr;
+static int flag;
+
+/* Work sizes */
+static size_t *globalSizeBfs_Kernel_Warp = NULL;
+static size_t *localSizeBfs_Kernel_Warp = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(levels),
+	RT_BIND_POINTER(edgeArray),
+	RT_BIND_POINTER(edgeArrayAux),
+	RT_BIND_VALUE(W_SZ),
+	RT_BIND_VALUE(CHUNK_SZ),
+	RT_BIND_VALUE(numVertices),
+	RT_BIND_VALUE(curr),
+	RT_BIND_VALUE(flag),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(BFS_kernel_warp, Bfs_Kernel_Warp),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(levels, levelsSz, levelsC, levelsCSz, edgeArray, edgeArraySz, edgeArrayAux, edgeArrayAuxSz, W_SZ, CHUNK_SZ, numVertices, curr, flag);
+}
@@ -99,6 +99,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBfs_Kernel_Warp = NULL;
+	cl_command_queue transferQueueBfs_Kernel_Warp = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,8 +108,10 @@ int main(void) {
 	cl_kernel kernelBfs_Kernel_Warp = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimBfs_Kernel_Warp = 1;
 	size_t globalSizeBfs_Kernel_Warp[1] = {
 		8192
@@ -163,7 +166,13 @@ int main(void) {
 
 	/* Create command queue for BFS_kernel_warp kernel */
 	PRINT_STEP("Creating command queue for \"BFS_kernel_warp\"...");
-	queueBfs_Kernel_Warp = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBfs_Kernel_Warp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for BFS_kernel_warp kernel */
+	PRINT_STEP("Creating transfer command queue for \"BFS_kernel_warp\"...");
+	transferQueueBfs_Kernel_Warp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -184,18 +193,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create BFS_kernel_warp kernel */
 	PRINT_STEP("Creating kernel \"BFS_kernel_warp\" from program...");
 	kernelBfs_Kernel_Warp = clCreateKernel(program, "BFS_kernel_warp", &fRet);
@@ -234,6 +256,17 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (flagK)"));
 	PRINT_SUCCESS();
 
+	/* Setting loop-invariant input buffers (uploaded only once) */
+	PRINT_STEP("Setting loop-invariant buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueBfs_Kernel_Warp, levelsK, CL_TRUE, 0, 1000 * sizeof(unsigned int), levels, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "levels"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (levelsK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueBfs_Kernel_Warp, edgeArrayK, CL_TRUE, 0, 1001 * sizeof(unsigned int), edgeArray, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "edgeArray"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (edgeArrayK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueBfs_Kernel_Warp, edgeArrayAuxK, CL_TRUE, 0, 1998 * sizeof(unsigned int), edgeArrayAux, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "edgeArrayAux"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (edgeArrayAuxK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
 		/* Calling loop preamble function */
 		PRINT_STEP("[%d] Calling loop preamble function...", i);
@@ -242,12 +275,6 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBfs_Kernel_Warp, levelsK, CL_TRUE, 0, 1000 * sizeof(unsigned int), levels, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (levelsK)"));
-		fRet = clEnqueueWriteBuffer(queueBfs_Kernel_Warp, edgeArrayK, CL_TRUE, 0, 1001 * sizeof(unsigned int), edgeArray, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (edgeArrayK)"));
-		fRet = clEnqueueWriteBuffer(queueBfs_Kernel_Warp, edgeArrayAuxK, CL_TRUE, 0, 1998 * sizeof(unsigned int), edgeArrayAux, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (edgeArrayAuxK)"));
 		fRet = clSetKernelArg(kernelBfs_Kernel_Warp, 3, sizeof(int), &W_SZ);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (W_SZ)"));
 		fRet = clSetKernelArg(kernelBfs_Kernel_Warp, 4, sizeof(int), &CHUNK_SZ);
@@ -256,13 +283,14 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (numVertices)"));
 		fRet = clSetKernelArg(kernelBfs_Kernel_Warp, 6, sizeof(int), &curr);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (curr)"));
-		fRet = clEnqueueWriteBuffer(queueBfs_Kernel_Warp, flagK, CL_TRUE, 0, sizeof(int), &flag, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBfs_Kernel_Warp, flagK, TRANSFER_BLOCKING, 0, sizeof(int), &flag, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "flag"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (flagK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBfs_Kernel_Warp);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBfs_Kernel_Warp, kernelBfs_Kernel_Warp, workDimBfs_Kernel_Warp, NULL, globalSizeBfs_Kernel_Warp, localSizeBfs_Kernel_Warp, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBfs_Kernel_Warp, kernelBfs_Kernel_Warp, workDimBfs_Kernel_Warp, NULL, globalSizeBfs_Kernel_Warp, localSizeBfs_Kernel_Warp, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "BFS_kernel_warp"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBfs_Kernel_Warp);
 		gettimeofday(&tNow, NULL);
@@ -270,10 +298,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBfs_Kernel_Warp, levelsK, CL_TRUE, 0, 1000 * sizeof(unsigned int), levels, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBfs_Kernel_Warp, flagK, CL_TRUE, 0, 1 * sizeof(int), &flag, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBfs_Kernel_Warp, flagK, TRANSFER_BLOCKING, 0, 1 * sizeof(int), &flag, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "flag"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -284,10 +313,19 @@ int main(void) {
 		i++;
 	} while(loopFlag);
 
+	/* Get output buffers */
+	PRINT_STEP("Getting kernels arguments...");
+	fRet = clEnqueueReadBuffer(transferQueueBfs_Kernel_Warp, levelsK, CL_TRUE, 0, 1000 * sizeof(unsigned int), levels, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "levels"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -305,6 +343,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(levelsK)
 		clReleaseMemObject(levelsK);
@@ -334,6 +375,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBfs_Kernel_Warp)
 		clReleaseCommandQueue(queueBfs_Kernel_Warp);
+	if(transferQueueBfs_Kernel_Warp)
+		clReleaseCommandQueue(transferQueueBfs_Kernel_Warp);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -28,23 +28,21 @@
 
 #define MAX_STR_SZ 256
 
+/* Initial number of elements and size of each block of string storage */
+#define LIST_INITIAL_CAPACITY 16
+#define LIST_BLOCK_SZ 65536
+
 #define TYPE_D 0
 #define TYPE_LF 1
 #define TYPE_S 2
 
-#define ASSIGN(type, val, dval, lfval, sval) {\
-	switch(type) {\
+#define ASSIGN(list, val, dval, lfval, sval) {\
+	switch((list)->type) {\
 		case TYPE_LF:\
 			val.lf = lfval;\
 			break;\
 		case TYPE_S:\
-			if(sval) {\
-				val.s = malloc(strnlen(sval, MAX_STR_SZ - 1) + 1);\
-				strcpy(val.s, sval);\
-			}\
-			else {\
-				val.s = NULL;\
-			}\
+			val.s = sval? _list_strdup(list, sval) : NULL;\
 			break;\
 		default:\
 			val.d = dval;\
@@ -52,154 +50,146 @@
 	}\
 }
 
-#define DEALLOC(type, val) {\
-	switch(type) {\
-		case TYPE_S:\
-			if(val.s)\
-				free(val.s);\
-			break;\
-	}\
+/**
+ * @brief Copy a string into the list's string blocks. Blocks are never moved or freed before the list is destroyed, so
+ *        strings returned by the list stay valid even after being replaced or removed.
+ */
+char *_list_strdup(list_t *list, const char *str) {
+	size_t len = strnlen(str, MAX_STR_SZ - 1);
+	char *ret;
+
+	if(!(list->strings) || (list->strings->capacity - list->strings->used) < (len + 1)) {
+		size_t capacity = (len + 1 > LIST_BLOCK_SZ)? len + 1 : LIST_BLOCK_SZ;
+		list_block_t *block = malloc(sizeof(list_block_t) + capacity);
+
+		block->next = list->strings;
+		block->used = 0;
+		block->capacity = capacity;
+		list->strings = block;
+	}
+
+	ret = list->strings->data + list->strings->used;
+	memcpy(ret, str, len);
+	ret[len] = '\0';
+	list->strings->used += len + 1;
+
+	return ret;
+}
+
+/**
+ * @brief Make room for at least n elements after the front.
+ *        Popped elements are reclaimed here, so that queues do not grow indefinitely.
+ */
+void _list_reserve(list_t *list, unsigned int n) {
+	if(list->front + n <= list->capacity)
+		return;
+
+	/* The popped prefix is reclaimed only once it is half of the array, so that the elements are moved at most once per refill */
+	if(list->front && (list->front >= list->capacity / 2)) {
+		memmove(list->elems, &(list->elems[list->front]), list->size * sizeof(elem_u));
+		list->front = 0;
+	}
+
+	if(list->front + n > list->capacity) {
+		unsigned int capacity = list->capacity? list->capacity : LIST_INITIAL_CAPACITY;
+
+		while(capacity < list->front + n)
+			capacity *= 2;
+
+		list->elems = realloc(list->elems, capacity * sizeof(elem_u));
+		list->capacity = capacity;
+	}
 }
 
 list_t *_list_create(unsigned int type) {
 	list_t *list = malloc(sizeof(list_t));
 	list->size = 0;
 	list->type = type;
-	list->head = NULL;
+	list->front = 0;
+	list->capacity = 0;
+	list->elems = NULL;
+	list->strings = NULL;
+
+	return list;
 }
 
 void _list_destroy(list_t **list) {
-	elem_t *tmpPointer = (*list)->head;
-	elem_t *tmpPointerNext;
+	list_block_t *tmpPointer = (*list)->strings;
+	list_block_t *tmpPointerNext;
 
 	while(tmpPointer) {
 		tmpPointerNext = tmpPointer->next;
-		DEALLOC((*list)->type, tmpPointer->val);
 		free(tmpPointer);
 		tmpPointer = tmpPointerNext;
 	}
 
+	free((*list)->elems);
 	free(*list);
 	*list = NULL;
 }
 
 void _list_trim(list_t **list, unsigned int n) {
 	if(n) {
-		elem_t *tmpPointer = (*list)->head;
-		elem_t *tmpPointerNext;
-
-		int i;
-		for(i = 0; tmpPointer; i++) {
-			tmpPointerNext = tmpPointer->next;
-			if(i >= n) {
-				DEALLOC((*list)->type, tmpPointer->val);
-				free(tmpPointer);
-			}
-			else if((n - 1) == i)
-				tmpPointer->next = NULL;
-			tmpPointer = tmpPointerNext;
-		}
-
-		(*list)->size = n;
+		if(n < (*list)->size)
+			(*list)->size = n;
 	}
 	else
 		_list_destroy(list);
 } 
 
 void _list_pushBack(list_t *list, int dval, double lfval, char *sval) {
-	if(list->head) {
-		elem_t *tmpPointer = list->head;
-
-		while(tmpPointer->next)
-			tmpPointer = tmpPointer->next;
+	elem_u val;
 
-		tmpPointer->next = malloc(sizeof(elem_t));
-		tmpPointer->next->next = NULL;
-		ASSIGN(list->type, tmpPointer->next->val, dval, lfval, sval);
-	}
-	else {
-		list->head = malloc(sizeof(elem_t));
-		list->head->next = NULL;
-		ASSIGN(list->type, list->head->val, dval, lfval, sval);
-	}
+	ASSIGN(list, val, dval, lfval, sval);
+	_list_reserve(list, list->size + 1);
+	list->elems[list->front + list->size] = val;
 
 	(list->size)++;
 }
 
 void _list_popFront(list_t *list) {
-	if(list->head) {
-		elem_t *tmpPointer = list->head->next;
-		DEALLOC(list->type, list->head->val);
-		free(list->head);
-		list->head = tmpPointer;
+	if(list->size) {
+		(list->front)++;
 		(list->size)--;
+
+		if(!(list->size))
+			list->front = 0;
 	}
 }
 
 elem_u _list_front(list_t *list) {
-	return list->head->val;
+	return list->elems[list->front];
 }
 
 elem_u _list_back(list_t *list) {
-	elem_t *tmpPointer = list->head;
-
-	while(tmpPointer->next)
-		tmpPointer = tmpPointer->next;
-
-	return tmpPointer->val;
+	return list->elems[list->front + list->size - 1];
 }
 
 elem_u _list_get(list_t *list, unsigned int pos) {
-	elem_t *tmpPointer = list->head;
-
-	int i;
-	for(i = 0; i < pos; i++)
-		tmpPointer = tmpPointer->next;
-
-	return tmpPointer->val;
+	return list->elems[list->front + pos];
 }
 
 void _list_insert(list_t *list, unsigned int pos, int dval, double lfval, char *sval) {
-	if(list->head) {
-		elem_t *tmpCurr = NULL;
-		elem_t *tmpNext = list->head;
-
-		int i;
-		for(i = 0; i < pos; i++) {
-			tmpCurr = tmpNext;
-			tmpNext = tmpNext->next;
-		}
-
-		elem_t *tmpElem = malloc(sizeof(elem_t));
-		tmpElem->next = tmpNext;
-		ASSIGN(list->type, tmpElem->val, dval, lfval, sval);
-		if(tmpCurr)
-			tmpCurr->next = tmpElem;
-		else
-			list->head = tmpElem;
-	}
-	else {
-		list->head = malloc(sizeof(elem_t));
-		list->head->next = NULL;
-		ASSIGN(list->type, list->head->val, dval, lfval, sval);
-	}
+	elem_u val;
+
+	if(pos > list->size)
+		pos = list->size;
+
+	ASSIGN(list, val, dval, lfval, sval);
+	_list_reserve(list, list->size + 1);
+	memmove(&(list->elems[list->front + pos + 1]), &(list->elems[list->front + pos]), (list->size - pos) * sizeof(elem_u));
+	list->elems[list->front + pos] = val;
 
 	(list->size)++;
 }
 
 void _list_swap(list_t *list, unsigned int pos, int dval, double lfval, char *sval) {
-	if(list->head) {
-		elem_t *tmpCurr = NULL;
-		elem_t *tmpNext = list->head;
-
-		int i;
-		for(i = 0; i < pos; i++) {
-			tmpCurr = tmpNext;
-			tmpNext = tmpNext->next;
-		}
-
-		DEALLOC(list->type, tmpNext->val);
-		ASSIGN(list->type, tmpNext->val, dval, lfval, sval);
+	if(pos < list->size) {
+		elem_u val;
+
+		/* New value is copied before replacing, as it may point to the current one */
+		ASSIGN(list, val, dval, lfval, sval);
+		list->elems[list->front + pos] = val;
 	}
 }
 
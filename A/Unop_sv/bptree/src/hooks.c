@@ -0,0 +1,171 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz);
+ *            POSTAMBLE(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz);
+ *            LOOPPREAMBLE(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz, loopFlag);
+ *            LOOPPOSTAMBLE(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz, loopFlag);
+ *            CLEANUP(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz);
+ *        where:
+ *            height: variable (long);
+ *            knodesDLocation: variable (int *);
+ *            knodesDLocationSz: number of members in variable (unsigned int);
+ *            knodesDIndices: variable (int *);
+ *            knodesDIndicesSz: number of members in variable (unsigned int);
+ *            knodesDKeys: variable (int *);
+ *            knodesDKeysSz: number of members in variable (unsigned int);
+ *            knodesDIsLeaf: variable (bool *);
+ *            knodesDIsLeafSz: number of members in variable (unsigned int);
+ *            knodesDNumKeys: variable (int *);
+ *            knodesDNumKeysSz: number of members in variable (unsigned int);
+ *            knodes_elem: variable (long);
+ *            recordsD: variable (int *);
+ *            recordsDSz: number of members in variable (unsigned int);
+ *            currKnodeD: variable (long *);
+ *            currKnodeDSz: number of members in variable (unsigned int);
+ *            currKnodeDC: variable (long *);
+ *            currKnodeDCSz: number of members in variable (unsigned int);
+ *            offsetD: variable (long *);
+ *            offsetDSz: number of members in variable (unsigned int);
+ *            offsetDC: variable (long *);
+ *            offsetDCSz: number of members in variable (unsigned int);
+ *            keysD: variable (int *);
+ *            keysDSz: number of members in variable (unsigned int);
+ *            ansD: variable (int *);
+ *            ansDSz: number of members in variable (unsigned int);
+ *            ansDC: variable (int *);
+ *            ansDCSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static long height;
+static int *knodesDLocation = NULL;
+static unsigned int knodesDLocationSz = 0;
+static int *knodesDIndices = NULL;
+static unsigned int knodesDIndicesSz = 0;
+static int *knodesDKeys = NULL;
+static unsigned int knodesDKeysSz = 0;
+static bool *knodesDIsLeaf = NULL;
+static unsigned int knodesDIsLeafSz = 0;
+static int *knodesDNumKeys = NULL;
+static unsigned int knodesDNumKeysSz = 0;
+static long knodes_elem;
+static int *recordsD = NULL;
+static unsigned int recordsDSz = 0;
+static long *currKnodeD = NULL;
+static unsigned int currKnodeDSz = 0;
+static long *currKnodeDC = NULL;
+static unsigned int currKnodeDCSz = 0;
+static long *offsetD = NULL;
+static unsigned int offsetDSz = 0;
+static long *offsetDC = NULL;
+static unsigned int offsetDCSz = 0;
+static int *keysD = NULL;
+static unsigned int keysDSz = 0;
+static int *ansD = NULL;
+static unsigned int ansDSz = 0;
+static int *ansDC = NULL;
+static unsigned int ansDCSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeFindk = NULL;
+static size_t *localSizeFindk = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(height),
+	RT_BIND_POINTER(knodesDLocation),
+	RT_BIND_POINTER(knodesDIndices),
+	RT_BIND_POINTER(knodesDKeys),
+	RT_BIND_POINTER(knodesDIsLeaf),
+	RT_BIND_POINTER(knodesDNumKeys),
+	RT_BIND_VALUE(knodes_elem),
+	RT_BIND_POINTER(recordsD),
+	RT_BIND_POINTER_C(currKnodeD),
+	RT_BIND_POINTER_C(offsetD),
+	RT_BIND_POINTER(keysD),
+	RT_BIND_POINTER_C(ansD),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(findK, Findk),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(height, knodesDLocation, knodesDLocationSz, knodesDIndices, knodesDIndicesSz, knodesDKeys, knodesDKeysSz, knodesDIsLeaf, knodesDIsLeafSz, knodesDNumKeys, knodesDNumKeysSz, knodes_elem, recordsD, recordsDSz, currKnodeD, currKnodeDSz, currKnodeDC, currKnodeDCSz, offsetD, offsetDSz, offsetDC, offsetDCSz, keysD, keysDSz, ansD, ansDSz, ansDC, ansDCSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -114,6 +114,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueFindk = NULL;
+	cl_command_queue transferQueueFindk = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -122,8 +123,10 @@ int main(void) {
 	cl_kernel kernelFindk = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 14);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimFindk = 1;
 	size_t globalSizeFindk[1] = {
 		2560000
@@ -190,7 +193,13 @@ int main(void) {
 
 	/* Create command queue for findK kernel */
 	PRINT_STEP("Creating command queue for \"findK\"...");
-	queueFindk = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueFindk = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for findK kernel */
+	PRINT_STEP("Creating transfer command queue for \"findK\"...");
+	transferQueueFindk = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -211,18 +220,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create findK kernel */
 	PRINT_STEP("Creating kernel \"findK\" from program...");
 	kernelFindk = clCreateKernel(program, "findK", &fRet);
@@ -286,33 +308,34 @@ int main(void) {
 		PRINT_STEP("[%d] Setting buffers...", i);
 		fRet = clSetKernelArg(kernelFindk, 0, sizeof(long), &height);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (height)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, knodesDLocationK, CL_TRUE, 0, 7874 * sizeof(int), knodesDLocation, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, knodesDLocationK, TRANSFER_BLOCKING, 0, 7874 * sizeof(int), knodesDLocation, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "knodesDLocation"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (knodesDLocationK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, knodesDIndicesK, CL_TRUE, 0, 2023618 * sizeof(int), knodesDIndices, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, knodesDIndicesK, TRANSFER_BLOCKING, 0, 2023618 * sizeof(int), knodesDIndices, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "knodesDIndices"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (knodesDIndicesK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, knodesDKeysK, CL_TRUE, 0, 2023618 * sizeof(int), knodesDKeys, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, knodesDKeysK, TRANSFER_BLOCKING, 0, 2023618 * sizeof(int), knodesDKeys, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "knodesDKeys"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (knodesDKeysK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, knodesDIsLeafK, CL_TRUE, 0, 7874 * sizeof(bool), knodesDIsLeaf, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, knodesDIsLeafK, TRANSFER_BLOCKING, 0, 7874 * sizeof(bool), knodesDIsLeaf, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "knodesDIsLeaf"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (knodesDIsLeafK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, knodesDNumKeysK, CL_TRUE, 0, 7874 * sizeof(int), knodesDNumKeys, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, knodesDNumKeysK, TRANSFER_BLOCKING, 0, 7874 * sizeof(int), knodesDNumKeys, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "knodesDNumKeys"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (knodesDNumKeysK)"));
 		fRet = clSetKernelArg(kernelFindk, 6, sizeof(long), &knodes_elem);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (knodes_elem)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, recordsDK, CL_TRUE, 0, 1000000 * sizeof(int), recordsD, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, recordsDK, TRANSFER_BLOCKING, 0, 1000000 * sizeof(int), recordsD, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "recordsD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (recordsDK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, currKnodeDK, CL_TRUE, 0, 10000 * sizeof(long), currKnodeD, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, currKnodeDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(long), currKnodeD, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "currKnodeD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (currKnodeDK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, offsetDK, CL_TRUE, 0, 10000 * sizeof(long), offsetD, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, offsetDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(long), offsetD, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "offsetD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (offsetDK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, keysDK, CL_TRUE, 0, 10000 * sizeof(int), keysD, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, keysDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), keysD, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "keysD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (keysDK)"));
-		fRet = clEnqueueWriteBuffer(queueFindk, ansDK, CL_TRUE, 0, 10000 * sizeof(int), ansD, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindk, ansDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), ansD, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "ansD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (ansDK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueFindk);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueFindk, kernelFindk, workDimFindk, NULL, globalSizeFindk, localSizeFindk, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueFindk, kernelFindk, workDimFindk, NULL, globalSizeFindk, localSizeFindk, ASYNC_WAIT_LIST(profileEvents, 0, 10), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "findK"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueFindk);
 		gettimeofday(&tNow, NULL);
@@ -320,11 +343,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueFindk, currKnodeDK, CL_TRUE, 0, 10000 * sizeof(long), currKnodeD, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueFindk, offsetDK, CL_TRUE, 0, 10000 * sizeof(long), offsetD, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueFindk, ansDK, CL_TRUE, 0, 10000 * sizeof(int), ansD, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueFindk, currKnodeDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(long), currKnodeD, ASYNC_WAIT_LIST(profileEvents, 10, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "currKnodeD"));
+		fRet = clEnqueueReadBuffer(transferQueueFindk, offsetDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(long), offsetD, ASYNC_WAIT_LIST(profileEvents, 10, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "offsetD"));
+		fRet = clEnqueueReadBuffer(transferQueueFindk, ansDK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), ansD, ASYNC_WAIT_LIST(profileEvents, 10, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "ansD"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 11, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -335,6 +360,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -370,6 +397,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(knodesDLocationK)
 		clReleaseMemObject(knodesDLocationK);
@@ -422,6 +452,8 @@ _err:
 	/* Dealloc queues */
 	if(queueFindk)
 		clReleaseCommandQueue(queueFindk);
+	if(transferQueueFindk)
+		clReleaseCommandQueue(transferQueueFindk);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,125 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr);
+ *            POSTAMBLE(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr);
+ *            LOOPPREAMBLE(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr, loopFlag);
+ *            LOOPPOSTAMBLE(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr, loopFlag);
+ *            CLEANUP(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr);
+ *        where:
+ *            variables: variable (float *);
+ *            variablesSz: number of members in variable (unsigned int);
+ *            areas: variable (float *);
+ *            areasSz: number of members in variable (unsigned int);
+ *            step_factors: variable (float *);
+ *            step_factorsSz: number of members in variable (unsigned int);
+ *            step_factorsC: variable (float *);
+ *            step_factorsCSz: number of members in variable (unsigned int);
+ *            nelr: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *variables = NULL;
+static unsigned int variablesSz = 0;
+static float *areas = NULL;
+static unsigned int areasSz = 0;
+static float *step_factors = NULL;
+static unsigned int step_factorsSz = 0;
+static float *step_factorsC = NULL;
+static unsigned int step_factorsCSz = 0;
+static int nelr;
+
+/* Work sizes */
+static size_t *globalSizeCompute_Step_Factor = NULL;
+static size_t *localSizeCompute_Step_Factor = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(variables),
+	RT_BIND_POINTER(areas),
+	RT_BIND_POINTER_C(step_factors),
+	RT_BIND_VALUE(nelr),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(compute_step_factor, Compute_Step_Factor),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(variables, variablesSz, areas, areasSz, step_factors, step_factorsSz, step_factorsC, step_factorsCSz, nelr);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
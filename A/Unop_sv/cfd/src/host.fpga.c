@@ -95,6 +95,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueCompute_Step_Factor = NULL;
+	cl_command_queue transferQueueCompute_Step_Factor = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -105,6 +106,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimCompute_Step_Factor = 1;
 	size_t globalSizeCompute_Step_Factor[1] = {
 		97152
@@ -155,7 +157,13 @@ int main(void) {
 
 	/* Create command queue for compute_step_factor kernel */
 	PRINT_STEP("Creating command queue for \"compute_step_factor\"...");
-	queueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for compute_step_factor kernel */
+	PRINT_STEP("Creating transfer command queue for \"compute_step_factor\"...");
+	transferQueueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -220,19 +228,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, variablesK, CL_TRUE, 0, 485760 * sizeof(float), variables, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, variablesK, TRANSFER_BLOCKING, 0, 485760 * sizeof(float), variables, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "variables"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (variablesK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, areasK, CL_TRUE, 0, 97152 * sizeof(float), areas, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, areasK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), areas, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "areas"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (areasK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, step_factorsK, CL_TRUE, 0, 97152 * sizeof(float), step_factors, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, step_factorsK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), step_factors, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "step_factors"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (step_factorsK)"));
 		fRet = clSetKernelArg(kernelCompute_Step_Factor, 3, sizeof(int), &nelr);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (nelr)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueCompute_Step_Factor);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueCompute_Step_Factor, kernelCompute_Step_Factor, workDimCompute_Step_Factor, NULL, globalSizeCompute_Step_Factor, localSizeCompute_Step_Factor, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueCompute_Step_Factor, kernelCompute_Step_Factor, workDimCompute_Step_Factor, NULL, globalSizeCompute_Step_Factor, localSizeCompute_Step_Factor, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "compute_step_factor"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueCompute_Step_Factor);
 		gettimeofday(&tNow, NULL);
@@ -240,9 +249,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueCompute_Step_Factor, step_factorsK, CL_TRUE, 0, 97152 * sizeof(float), step_factors, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueCompute_Step_Factor, step_factorsK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), step_factors, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "step_factors"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -253,6 +264,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -270,6 +282,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(variablesK)
 		clReleaseMemObject(variablesK);
@@ -299,6 +314,8 @@ _err:
 	/* Dealloc queues */
 	if(queueCompute_Step_Factor)
 		clReleaseCommandQueue(queueCompute_Step_Factor);
+	if(transferQueueCompute_Step_Factor)
+		clReleaseCommandQueue(transferQueueCompute_Step_Factor);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -95,6 +95,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueCompute_Step_Factor = NULL;
+	cl_command_queue transferQueueCompute_Step_Factor = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -103,8 +104,10 @@ int main(void) {
 	cl_kernel kernelCompute_Step_Factor = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimCompute_Step_Factor = 1;
 	size_t globalSizeCompute_Step_Factor[1] = {
 		97152
@@ -155,7 +158,13 @@ int main(void) {
 
 	/* Create command queue for compute_step_factor kernel */
 	PRINT_STEP("Creating command queue for \"compute_step_factor\"...");
-	queueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for compute_step_factor kernel */
+	PRINT_STEP("Creating transfer command queue for \"compute_step_factor\"...");
+	transferQueueCompute_Step_Factor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -176,18 +185,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create compute_step_factor kernel */
 	PRINT_STEP("Creating kernel \"compute_step_factor\" from program...");
 	kernelCompute_Step_Factor = clCreateKernel(program, "compute_step_factor", &fRet);
@@ -219,19 +241,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, variablesK, CL_TRUE, 0, 485760 * sizeof(float), variables, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, variablesK, TRANSFER_BLOCKING, 0, 485760 * sizeof(float), variables, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "variables"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (variablesK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, areasK, CL_TRUE, 0, 97152 * sizeof(float), areas, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, areasK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), areas, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "areas"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (areasK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Step_Factor, step_factorsK, CL_TRUE, 0, 97152 * sizeof(float), step_factors, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Step_Factor, step_factorsK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), step_factors, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "step_factors"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (step_factorsK)"));
 		fRet = clSetKernelArg(kernelCompute_Step_Factor, 3, sizeof(int), &nelr);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (nelr)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueCompute_Step_Factor);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueCompute_Step_Factor, kernelCompute_Step_Factor, workDimCompute_Step_Factor, NULL, globalSizeCompute_Step_Factor, localSizeCompute_Step_Factor, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueCompute_Step_Factor, kernelCompute_Step_Factor, workDimCompute_Step_Factor, NULL, globalSizeCompute_Step_Factor, localSizeCompute_Step_Factor, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "compute_step_factor"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueCompute_Step_Factor);
 		gettimeofday(&tNow, NULL);
@@ -239,9 +262,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueCompute_Step_Factor, step_factorsK, CL_TRUE, 0, 97152 * sizeof(float), step_factors, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueCompute_Step_Factor, step_factorsK, TRANSFER_BLOCKING, 0, 97152 * sizeof(float), step_factors, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "step_factors"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -252,6 +277,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -269,6 +296,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(variablesK)
 		clReleaseMemObject(variablesK);
@@ -298,6 +328,8 @@ _err:
 	/* Dealloc queues */
 	if(queueCompute_Step_Factor)
 		clReleaseCommandQueue(queueCompute_Step_Factor);
+	if(transferQueueCompute_Step_Factor)
+		clReleaseCommandQueue(transferQueueCompute_Step_Factor);
 
 	/* Last OpenCL variables */
 	if(context)
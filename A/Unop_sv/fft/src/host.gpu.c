@@ -88,6 +88,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueFft1D_512 = NULL;
+	cl_command_queue transferQueueFft1D_512 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -96,8 +97,10 @@ int main(void) {
 	cl_kernel kernelFft1D_512 = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 3);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimFft1D_512 = 1;
 	size_t globalSizeFft1D_512[1] = {
 		8192
@@ -141,7 +144,13 @@ int main(void) {
 
 	/* Create command queue for fft1D_512 kernel */
 	PRINT_STEP("Creating command queue for \"fft1D_512\"...");
-	queueFft1D_512 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueFft1D_512 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for fft1D_512 kernel */
+	PRINT_STEP("Creating transfer command queue for \"fft1D_512\"...");
+	transferQueueFft1D_512 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -162,18 +171,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create fft1D_512 kernel */
 	PRINT_STEP("Creating kernel \"fft1D_512\" from program...");
 	kernelFft1D_512 = clCreateKernel(program, "fft1D_512", &fRet);
@@ -195,13 +217,14 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueFft1D_512, workK, CL_TRUE, 0, 65536 * sizeof(cl_float2), work, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFft1D_512, workK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float2), work, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "work"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (workK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueFft1D_512);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueFft1D_512, kernelFft1D_512, workDimFft1D_512, NULL, globalSizeFft1D_512, localSizeFft1D_512, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueFft1D_512, kernelFft1D_512, workDimFft1D_512, NULL, globalSizeFft1D_512, localSizeFft1D_512, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "fft1D_512"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueFft1D_512);
 		gettimeofday(&tNow, NULL);
@@ -209,9 +232,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueFft1D_512, workK, CL_TRUE, 0, 65536 * sizeof(cl_float2), work, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueFft1D_512, workK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float2), work, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "work"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -222,6 +247,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -230,6 +257,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(workK)
 		clReleaseMemObject(workK);
@@ -252,6 +282,8 @@ _err:
 	/* Dealloc queues */
 	if(queueFft1D_512)
 		clReleaseCommandQueue(queueFft1D_512);
+	if(transferQueueFft1D_512)
+		clReleaseCommandQueue(transferQueueFft1D_512);
 
 	/* Last OpenCL variables */
 	if(context)
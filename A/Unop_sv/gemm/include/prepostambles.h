@@ -18,3 +18,34 @@
 		for(_j = 0; _j < ldc; _j++)\
 			C[_i * ldc + _j] = 0;\
 }
+
+/* Relative error allowed on each element, against the sum of magnitudes of its products */
+#define GEMM_EPSILON 1.0e-5
+
+/* Validate against a host column-major product accumulated in double (C is zeroed by the preamble, so beta does not contribute) */
+#define POSTAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta) {\
+	int _i, _j, _l;\
+	double _expected = 0, _magnitude = 0, _term, _diff = 0;\
+\
+	for(_j = 0; _j < ldc; _j++) {\
+		for(_i = 0; _i < ldc; _i++) {\
+			_expected = 0;\
+			_magnitude = 0;\
+			for(_l = 0; _l < k; _l++) {\
+				_term = alpha * (double) A[_l * lda + _i] * B[_j * ldb + _l];\
+				_expected += _term;\
+				_magnitude += (_term < 0)? -_term : _term;\
+			}\
+\
+			_diff = (C[_j * ldc + _i] > _expected)? C[_j * ldc + _i] - _expected : _expected - C[_j * ldc + _i];\
+			if(_diff > GEMM_EPSILON * _magnitude)\
+				break;\
+		}\
+		if(_i < ldc)\
+			break;\
+	}\
+\
+	if(_j < ldc)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_j == ldc, printf("Variable C[%d]: expected %f got %f.\n", _j * ldc + _i, _expected, (double) C[_j * ldc + _i]); rv = EXIT_FAILURE);\
+}
@@ -0,0 +1,144 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta);
+ *            POSTAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta);
+ *            LOOPPREAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta, loopFlag);
+ *            LOOPPOSTAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta, loopFlag);
+ *            CLEANUP(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta);
+ *        where:
+ *            A: variable (float *);
+ *            ASz: number of members in variable (unsigned int);
+ *            lda: variable (int);
+ *            B: variable (float *);
+ *            BSz: number of members in variable (unsigned int);
+ *            ldb: variable (int);
+ *            C: variable (float *);
+ *            CSz: number of members in variable (unsigned int);
+ *            ldc: variable (int);
+ *            k: variable (int);
+ *            alpha: variable (float);
+ *            beta: variable (float);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *A = NULL;
+static unsigned int ASz = 0;
+static int lda;
+static float *B = NULL;
+static unsigned int BSz = 0;
+static int ldb;
+static float *C = NULL;
+static unsigned int CSz = 0;
+static int ldc;
+static int k;
+static float alpha;
+static float beta;
+
+/* Work sizes */
+static size_t *globalSizeSgemmnn = NULL;
+static size_t *localSizeSgemmnn = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(A),
+	RT_BIND_VALUE(lda),
+	RT_BIND_POINTER(B),
+	RT_BIND_VALUE(ldb),
+	RT_BIND_POINTER(C),
+	RT_BIND_VALUE(ldc),
+	RT_BIND_VALUE(k),
+	RT_BIND_VALUE(alpha),
+	RT_BIND_VALUE(beta),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(sgemmNN, Sgemmnn),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(A, ASz, lda, B, BSz, ldb, C, CSz, ldc, k, alpha, beta);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
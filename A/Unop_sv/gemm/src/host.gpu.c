@@ -98,6 +98,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueSgemmnn = NULL;
+	cl_command_queue transferQueueSgemmnn = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -106,8 +107,10 @@ int main(void) {
 	cl_kernel kernelSgemmnn = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimSgemmnn = 2;
 	size_t globalSizeSgemmnn[2] = {
 		32, 32
@@ -161,7 +164,13 @@ int main(void) {
 
 	/* Create command queue for sgemmNN kernel */
 	PRINT_STEP("Creating command queue for \"sgemmNN\"...");
-	queueSgemmnn = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueSgemmnn = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for sgemmNN kernel */
+	PRINT_STEP("Creating transfer command queue for \"sgemmNN\"...");
+	transferQueueSgemmnn = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -182,18 +191,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create sgemmNN kernel */
 	PRINT_STEP("Creating kernel \"sgemmNN\" from program...");
 	kernelSgemmnn = clCreateKernel(program, "sgemmNN", &fRet);
@@ -235,15 +257,15 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueSgemmnn, AK, CL_TRUE, 0, 16384 * sizeof(float), A, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSgemmnn, AK, TRANSFER_BLOCKING, 0, 16384 * sizeof(float), A, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "A"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (AK)"));
 		fRet = clSetKernelArg(kernelSgemmnn, 1, sizeof(int), &lda);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (lda)"));
-		fRet = clEnqueueWriteBuffer(queueSgemmnn, BK, CL_TRUE, 0, 16384 * sizeof(float), B, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSgemmnn, BK, TRANSFER_BLOCKING, 0, 16384 * sizeof(float), B, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "B"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (BK)"));
 		fRet = clSetKernelArg(kernelSgemmnn, 3, sizeof(int), &ldb);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (ldb)"));
-		fRet = clEnqueueWriteBuffer(queueSgemmnn, CK, CL_TRUE, 0, 16384 * sizeof(float), C, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSgemmnn, CK, TRANSFER_BLOCKING, 0, 16384 * sizeof(float), C, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "C"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (CK)"));
 		fRet = clSetKernelArg(kernelSgemmnn, 5, sizeof(int), &ldc);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (ldc)"));
@@ -256,8 +278,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueSgemmnn);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueSgemmnn, kernelSgemmnn, workDimSgemmnn, NULL, globalSizeSgemmnn, localSizeSgemmnn, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueSgemmnn, kernelSgemmnn, workDimSgemmnn, NULL, globalSizeSgemmnn, localSizeSgemmnn, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "sgemmNN"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueSgemmnn);
 		gettimeofday(&tNow, NULL);
@@ -265,19 +288,27 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueSgemmnn, CK, CL_TRUE, 0, 16384 * sizeof(float), C, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueSgemmnn, CK, TRANSFER_BLOCKING, 0, 16384 * sizeof(float), C, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "C"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
 		i++;
 	} while(loopFlag);
 
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(A, 16384, lda, B, 16384, ldb, C, 16384, ldc, k, alpha, beta);
+	PRINT_SUCCESS();
 
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -286,6 +317,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(AK)
 		clReleaseMemObject(AK);
@@ -314,6 +348,8 @@ _err:
 	/* Dealloc queues */
 	if(queueSgemmnn)
 		clReleaseCommandQueue(queueSgemmnn);
+	if(transferQueueSgemmnn)
+		clReleaseCommandQueue(transferQueueSgemmnn);
 
 	/* Last OpenCL variables */
 	if(context)
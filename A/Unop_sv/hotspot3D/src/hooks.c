@@ -0,0 +1,179 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc);
+ *            POSTAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc);
+ *            LOOPPREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag);
+ *            LOOPPOSTAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag);
+ *            CLEANUP(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc);
+ *        where:
+ *            p: variable (float *);
+ *            pSz: number of members in variable (unsigned int);
+ *            tIn: variable (float *);
+ *            tInSz: number of members in variable (unsigned int);
+ *            tOut: variable (float *);
+ *            tOutSz: number of members in variable (unsigned int);
+ *            tOutC: variable (float *);
+ *            tOutCSz: number of members in variable (unsigned int);
+ *            sdc: variable (float);
+ *            nx: variable (int);
+ *            ny: variable (int);
+ *            nz: variable (int);
+ *            ce: variable (float);
+ *            cw: variable (float);
+ *            cn: variable (float);
+ *            cs: variable (float);
+ *            ct: variable (float);
+ *            cb: variable (float);
+ *            cc: variable (float);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *p = NULL;
+static unsigned int pSz = 0;
+static float *tIn = NULL;
+static unsigned int tInSz = 0;
+static float *tOut = NULL;
+static unsigned int tOutSz = 0;
+static float *tOutC = NULL;
+static unsigned int tOutCSz = 0;
+static float sdc;
+static int nx;
+static int ny;
+static int nz;
+static float ce;
+static float cw;
+static float cn;
+static float cs;
+static float ct;
+static float cb;
+static float cc;
+
+/* Work sizes */
+static size_t *globalSizeHotspotopt1 = NULL;
+static size_t *localSizeHotspotopt1 = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(p),
+	RT_BIND_POINTER(tIn),
+	RT_BIND_POINTER_C(tOut),
+	RT_BIND_VALUE(sdc),
+	RT_BIND_VALUE(nx),
+	RT_BIND_VALUE(ny),
+	RT_BIND_VALUE(nz),
+	RT_BIND_VALUE(ce),
+	RT_BIND_VALUE(cw),
+	RT_BIND_VALUE(cn),
+	RT_BIND_VALUE(cs),
+	RT_BIND_VALUE(ct),
+	RT_BIND_VALUE(cb),
+	RT_BIND_VALUE(cc),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(hotspotOpt1, Hotspotopt1),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc);
+}
@@ -44,3 +44,28 @@
 		fclose(ipf);\
 	}\
 }
+
+/* Full sorter (host.full.c): keys are uniformly distributed between 0 and 1, as in Rodinia's hybridsort */
+#define FULLPREAMBLE(keys, size, seed) {\
+	int _i;\
+\
+	srand(seed);\
+	for(_i = 0; _i < size; _i++)\
+		keys[_i] = rand() / (float) RAND_MAX;\
+}
+
+/* Result must match the qsort reference exactly, since sorting only moves keys */
+#define FULLPOSTAMBLE(result, reference, size) {\
+	int _i;\
+	int _wrong = 0;\
+\
+	for(_i = 0; _i < size; _i++) {\
+		if(result[_i] != reference[_i]) {\
+			if(!_wrong)\
+				fprintf(stderr, "Error: first mismatch at %d: %f (expected %f).\n", _i, result[_i], reference[_i]);\
+			_wrong++;\
+		}\
+	}\
+\
+	ASSERT_CALL(!_wrong, fprintf(stderr, "Error: %d of %d keys are not in place.\n", _wrong, size); rv = EXIT_FAILURE);\
+}
@@ -0,0 +1,126 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount);
+ *            POSTAMBLE(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount);
+ *            LOOPPREAMBLE(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount, loopFlag);
+ *            LOOPPOSTAMBLE(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount, loopFlag);
+ *            CLEANUP(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount);
+ *        where:
+ *            d_Result: variable (unsigned int *);
+ *            d_ResultSz: number of members in variable (unsigned int);
+ *            d_ResultC: variable (unsigned int *);
+ *            d_ResultCSz: number of members in variable (unsigned int);
+ *            d_Data: variable (float *);
+ *            d_DataSz: number of members in variable (unsigned int);
+ *            minimum: variable (float);
+ *            maximum: variable (float);
+ *            dataCount: variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static unsigned int *d_Result = NULL;
+static unsigned int d_ResultSz = 0;
+static unsigned int *d_ResultC = NULL;
+static unsigned int d_ResultCSz = 0;
+static float *d_Data = NULL;
+static unsigned int d_DataSz = 0;
+static float minimum;
+static float maximum;
+static unsigned int dataCount;
+
+/* Work sizes */
+static size_t *globalSizeHistogram1024Kernel = NULL;
+static size_t *localSizeHistogram1024Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(d_Result),
+	RT_BIND_POINTER(d_Data),
+	RT_BIND_VALUE(minimum),
+	RT_BIND_VALUE(maximum),
+	RT_BIND_VALUE(dataCount),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(histogram1024Kernel, Histogram1024Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(d_Result, d_ResultSz, d_ResultC, d_ResultCSz, d_Data, d_DataSz, minimum, maximum, dataCount);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
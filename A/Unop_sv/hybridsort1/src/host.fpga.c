@@ -95,6 +95,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueHistogram1024Kernel = NULL;
+	cl_command_queue transferQueueHistogram1024Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -105,6 +106,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
 	cl_uint workDimHistogram1024Kernel = 1;
 	size_t globalSizeHistogram1024Kernel[1] = {
 		6144
@@ -155,7 +157,13 @@ int main(void) {
 
 	/* Create command queue for histogram1024Kernel kernel */
 	PRINT_STEP("Creating command queue for \"histogram1024Kernel\"...");
-	queueHistogram1024Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueHistogram1024Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for histogram1024Kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"histogram1024Kernel\"...");
+	transferQueueHistogram1024Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -220,9 +228,9 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueHistogram1024Kernel, d_ResultK, CL_TRUE, 0, 1024 * sizeof(unsigned int), d_Result, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueHistogram1024Kernel, d_ResultK, TRANSFER_BLOCKING, 0, 1024 * sizeof(unsigned int), d_Result, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_Result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_ResultK)"));
-		fRet = clEnqueueWriteBuffer(queueHistogram1024Kernel, d_DataK, CL_TRUE, 0, 1000000 * sizeof(float), d_Data, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueHistogram1024Kernel, d_DataK, TRANSFER_BLOCKING, 0, 1000000 * sizeof(float), d_Data, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_Data"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DataK)"));
 		fRet = clSetKernelArg(kernelHistogram1024Kernel, 2, sizeof(float), &minimum);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (minimum)"));
@@ -233,8 +241,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueHistogram1024Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueHistogram1024Kernel, kernelHistogram1024Kernel, workDimHistogram1024Kernel, NULL, globalSizeHistogram1024Kernel, localSizeHistogram1024Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueHistogram1024Kernel, kernelHistogram1024Kernel, workDimHistogram1024Kernel, NULL, globalSizeHistogram1024Kernel, localSizeHistogram1024Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "histogram1024Kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueHistogram1024Kernel);
 		gettimeofday(&tNow, NULL);
@@ -242,9 +251,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueHistogram1024Kernel, d_ResultK, CL_TRUE, 0, 1024 * sizeof(unsigned int), d_Result, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueHistogram1024Kernel, d_ResultK, TRANSFER_BLOCKING, 0, 1024 * sizeof(unsigned int), d_Result, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_Result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -255,6 +266,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -272,6 +284,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_ResultK)
 		clReleaseMemObject(d_ResultK);
@@ -298,6 +313,8 @@ _err:
 	/* Dealloc queues */
 	if(queueHistogram1024Kernel)
 		clReleaseCommandQueue(queueHistogram1024Kernel);
+	if(transferQueueHistogram1024Kernel)
+		clReleaseCommandQueue(transferQueueHistogram1024Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
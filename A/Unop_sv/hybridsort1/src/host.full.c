@@ -0,0 +1,610 @@
+/* ********************************************************************************************* */
+/* * Full Hybrid Sort Host                                                                     * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2017 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            FULLPREAMBLE(keys, size, seed);
+ *            FULLPOSTAMBLE(result, reference, size);
+ *        where:
+ *            keys: keys to be sorted (float *);
+ *            result: keys sorted by the device (float *);
+ *            reference: keys sorted by qsort (float *);
+ *            size: number of keys (int);
+ *            seed: seed of the key generator (unsigned int).
+ */
+#include "prepostambles.h"
+
+/**
+ * @brief Work-group sizes and bucket constants, as in kern.full.cl.
+ */
+#define MINMAX_THREAD_N 256
+#define HISTOGRAM_THREAD_N 96
+#define PIVOT_THREAD_N 256
+#define BIN_COUNT 1024
+#define DIVISIONS 1024
+#define BUCKET_THREAD_N 32
+#define MERGE_FIRST_THREAD_N 256
+#define MERGE_THREAD_N 208
+#define PACK_THREAD_N 256
+
+/**
+ * @brief Number of work-groups of the min/max and histogram kernels.
+ */
+#define MINMAX_GROUPS 64
+#define HISTOGRAM_GROUPS 64
+
+/**
+ * @brief Keys handled by each work-item of bucketcount and bucketsort (as in Rodinia).
+ */
+#define BUCKET_BAND 128
+
+/**
+ * @brief Round @p x up to a multiple of @p y.
+ */
+#define ROUND_UP(x, y) ((((x) + (y) - 1) / (y)) * (y))
+
+/**
+ * @brief Standard statements for function error handling and printing.
+ *
+ * @param funcName Function name that failed.
+ */
+#define FUNCTION_ERROR_STATEMENTS(funcName) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s failed with return code %d.\n", funcName, fRet);\
+}
+
+/**
+ * @brief Standard statements for POSIX error handling and printing.
+ *
+ * @param arg Arbitrary string to the printed at the end of error string.
+ */
+#define POSIX_ERROR_STATEMENTS(arg) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s: %s\n", strerror(errno), arg);\
+}
+
+/**
+ * @brief Set a kernel argument, jumping to _err on failure.
+ */
+#define SET_ARG(kernel, index, type, value) {\
+	fRet = clSetKernelArg(kernel, index, sizeof(type), value);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (" #kernel ", " #value ")"));\
+}
+
+/**
+ * @brief Enqueue a one-dimensional kernel, jumping to _err on failure.
+ */
+#define ENQUEUE_1D(kernel, global, local) {\
+	size_t _globalSize[1] = {global};\
+	size_t _localSize[1] = {local};\
+	fRet = clEnqueueNDRangeKernel(queue, kernel, 1, NULL, _globalSize, _localSize, 0, NULL, NULL);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (" #kernel ")"));\
+}
+
+/**
+ * @brief Kernels of the pipeline, in order of execution.
+ */
+enum {
+	K_MINMAX_PARTIALS,
+	K_MINMAX_FINAL,
+	K_HISTOGRAM,
+	K_PIVOTS,
+	K_BUCKETCOUNT,
+	K_BUCKETPREFIX,
+	K_BUCKETOFFSETS,
+	K_BUCKETSORT,
+	K_MERGEFIRST,
+	K_MERGEPASS,
+	K_MERGEPACK,
+	K_TOTAL
+};
+
+static const char *kernelNames[K_TOTAL] = {
+	"minmaxPartials",
+	"minmaxFinal",
+	"histogramPartials",
+	"pivotPoints",
+	"bucketcount",
+	"bucketprefixoffset",
+	"bucketoffsets",
+	"bucketsort",
+	"mergeSortFirst",
+	"mergeSortPass",
+	"mergepack"
+};
+
+static int compareKeys(const void *a, const void *b) {
+	float x = *((const float *) a);
+	float y = *((const float *) b);
+
+	return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[]) {
+	/* Return variable */
+	int rv = EXIT_SUCCESS;
+
+	/* OpenCL and aux variables */
+	int i, k, opt;
+	cl_uint platformsLen, devicesLen;
+	cl_int fRet;
+	cl_platform_id *platforms = NULL;
+	cl_device_id *devices = NULL;
+	cl_context context = NULL;
+	cl_command_queue queue = NULL;
+	FILE *programFile = NULL;
+	size_t programSz;
+	char *programContent = NULL;
+	cl_program program = NULL;
+	cl_kernel kernels[K_TOTAL];
+	cl_ulong maxAllocSize;
+	struct timeval tThen, tNow, tDelta, tExecTime, tCPUTime;
+	timerclear(&tExecTime);
+#ifdef FULL_PROGRAM_BINARY
+	cl_int programRet;
+#else
+	struct timeval tProgramTime;
+	PROGRAM_CACHE_DECLARE(programCache);
+#endif
+
+	/* Sorter parameters */
+	int size = 1000000;
+	unsigned int seed = 7;
+	int runs = 1;
+	int blocks;
+	int minmaxGroups = MINMAX_GROUPS;
+	int histogramGroups = HISTOGRAM_GROUPS;
+	size_t mergeBufferSz;
+
+	/* Values read back from bucketoffsets: largest padded division and padded list length, in floats */
+	int sizes[2];
+	int listsize;
+	int nrElems;
+	int threadsPerDiv;
+	int cur;
+
+	/* Host and device variables */
+	float *keys = NULL;
+	float *result = NULL;
+	float *reference = NULL;
+	cl_mem keysK = NULL;
+	cl_mem minmaxPartialsK = NULL;
+	cl_mem minmaxK = NULL;
+	cl_mem histogramK = NULL;
+	cl_mem pivotsK = NULL;
+	cl_mem indiceK = NULL;
+	cl_mem prefixOffsetsK = NULL;
+	cl_mem offsetsK = NULL;
+	cl_mem lOffsetsK = NULL;
+	cl_mem constStartAddrK = NULL;
+	cl_mem nullElemsK = NULL;
+	cl_mem finalStartAddrK = NULL;
+	cl_mem sizesK = NULL;
+	cl_mem mergeK[2] = {NULL, NULL};
+	cl_mem resultK = NULL;
+
+	memset(kernels, 0, sizeof(kernels));
+
+	/* Parse command line */
+	while((opt = getopt(argc, argv, "n:s:r:")) != -1) {
+		switch(opt) {
+			case 'n':
+				size = strtol(optarg, NULL, 10);
+				break;
+			case 's':
+				seed = strtoul(optarg, NULL, 10);
+				break;
+			case 'r':
+				runs = strtol(optarg, NULL, 10);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-n KEYS] [-s SEED] [-r RUNS]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	/* Kernels index the padded list with ints */
+	if(size <= 0 || size > INT_MAX - 4 * DIVISIONS || runs <= 0) {
+		fprintf(stderr, "Error: number of keys must be between 1 and %d, and number of runs positive.\n", INT_MAX - 4 * DIVISIONS);
+		return EXIT_FAILURE;
+	}
+	blocks = ((size - 1) / (BUCKET_THREAD_N * BUCKET_BAND)) + 1;
+	/* Padded list, plus the float4 mergeSortPass reads past its end */
+	mergeBufferSz = (ROUND_UP((size_t) size + 3 * DIVISIONS, 4) + 4) * sizeof(float);
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	keys = malloc(size * sizeof(float));
+	ASSERT_CALL(keys, POSIX_ERROR_STATEMENTS("keys"));
+	result = malloc(size * sizeof(float));
+	ASSERT_CALL(result, POSIX_ERROR_STATEMENTS("result"));
+	reference = malloc(size * sizeof(float));
+	ASSERT_CALL(reference, POSIX_ERROR_STATEMENTS("reference"));
+	FULLPREAMBLE(keys, size, seed);
+	PRINT_SUCCESS();
+
+	/* Get platforms IDs */
+	PRINT_STEP("Getting platforms IDs...");
+	fRet = clGetPlatformIDs(0, NULL, &platformsLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	platforms = malloc(platformsLen * sizeof(cl_platform_id));
+	fRet = clGetPlatformIDs(platformsLen, platforms, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	PRINT_SUCCESS();
+
+	/* Get devices IDs for first platform availble */
+	PRINT_STEP("Getting devices IDs for first platform...");
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, NULL, &devicesLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	devices = malloc(devicesLen * sizeof(cl_device_id));
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devicesLen, devices, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	PRINT_SUCCESS();
+
+	/* The padded list is the largest buffer */
+	PRINT_STEP("Checking device memory...");
+	fRet = clGetDeviceInfo(devices[0], CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(cl_ulong), &maxAllocSize, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));
+	ASSERT_CALL(mergeBufferSz <= maxAllocSize, PRINT_FAIL(); fprintf(stderr, "Error: %d keys need buffers of %zu bytes, device allows %llu.\n", size, mergeBufferSz, (unsigned long long) maxAllocSize); rv = EXIT_FAILURE);
+	PRINT_SUCCESS();
+
+	/* Create context for first available device */
+	PRINT_STEP("Creating context...");
+	context = clCreateContext(NULL, 1, devices, NULL, NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateContext"));
+	PRINT_SUCCESS();
+
+	/* Create command queue for first available device */
+	PRINT_STEP("Creating command queue...");
+	queue = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Open program file */
+	PRINT_STEP("Opening program file...");
+#ifdef FULL_PROGRAM_BINARY
+	programFile = fopen("program.full.aocx", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("program.full.aocx"));
+#else
+	programFile = fopen("kern.full.cl", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("kern.full.cl"));
+#endif
+	PRINT_SUCCESS();
+
+	/* Get size and read file */
+	PRINT_STEP("Reading program file...");
+	fseek(programFile, 0, SEEK_END);
+	programSz = ftell(programFile);
+	fseek(programFile, 0, SEEK_SET);
+	programContent = malloc(programSz);
+	fread(programContent, programSz, 1, programFile);
+	fclose(programFile);
+	programFile = NULL;
+	PRINT_SUCCESS();
+
+#ifdef FULL_PROGRAM_BINARY
+	/* Create program from binary file */
+	PRINT_STEP("Creating program from binary...");
+	program = clCreateProgramWithBinary(context, 1, devices, &programSz, (const unsigned char **) &programContent, &programRet, &fRet);
+	ASSERT_CALL(CL_SUCCESS == programRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary (when loading binary)"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary"));
+	PRINT_SUCCESS();
+#else
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
+	PRINT_SUCCESS();
+
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+#endif
+
+	/* Build program */
+	PRINT_STEP("Building program...");
+	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
+	PRINT_SUCCESS();
+
+#ifndef FULL_PROGRAM_BINARY
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+#endif
+
+	/* Create buffers and kernels */
+	PRINT_STEP("Creating buffers and kernels...");
+	keysK = clCreateBuffer(context, CL_MEM_READ_ONLY, size * sizeof(float), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (keysK)"));
+	minmaxPartialsK = clCreateBuffer(context, CL_MEM_READ_WRITE, 2 * MINMAX_GROUPS * sizeof(float), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (minmaxPartialsK)"));
+	minmaxK = clCreateBuffer(context, CL_MEM_READ_WRITE, 2 * sizeof(float), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (minmaxK)"));
+	histogramK = clCreateBuffer(context, CL_MEM_READ_WRITE, HISTOGRAM_GROUPS * BIN_COUNT * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (histogramK)"));
+	pivotsK = clCreateBuffer(context, CL_MEM_READ_WRITE, DIVISIONS * sizeof(float), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (pivotsK)"));
+	indiceK = clCreateBuffer(context, CL_MEM_READ_WRITE, size * sizeof(int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (indiceK)"));
+	prefixOffsetsK = clCreateBuffer(context, CL_MEM_READ_WRITE, (size_t) blocks * DIVISIONS * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (prefixOffsetsK)"));
+	offsetsK = clCreateBuffer(context, CL_MEM_READ_WRITE, DIVISIONS * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (offsetsK)"));
+	lOffsetsK = clCreateBuffer(context, CL_MEM_READ_WRITE, DIVISIONS * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (lOffsetsK)"));
+	constStartAddrK = clCreateBuffer(context, CL_MEM_READ_WRITE, (DIVISIONS + 1) * sizeof(int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (constStartAddrK)"));
+	nullElemsK = clCreateBuffer(context, CL_MEM_READ_WRITE, DIVISIONS * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (nullElemsK)"));
+	finalStartAddrK = clCreateBuffer(context, CL_MEM_READ_WRITE, (DIVISIONS + 1) * sizeof(int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (finalStartAddrK)"));
+	sizesK = clCreateBuffer(context, CL_MEM_READ_WRITE, 2 * sizeof(int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (sizesK)"));
+	for(i = 0; i < 2; i++) {
+		mergeK[i] = clCreateBuffer(context, CL_MEM_READ_WRITE, mergeBufferSz, NULL, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (mergeK)"));
+	}
+	resultK = clCreateBuffer(context, CL_MEM_WRITE_ONLY, size * sizeof(float), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (resultK)"));
+
+	for(k = 0; k < K_TOTAL; k++) {
+		kernels[k] = clCreateKernel(program, kernelNames[k], &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS(kernelNames[k]));
+	}
+	PRINT_SUCCESS();
+
+	/* Only the arguments of mergeSortPass change between passes */
+	PRINT_STEP("Setting kernel arguments...");
+	SET_ARG(kernels[K_MINMAX_PARTIALS], 0, cl_mem, &keysK);
+	SET_ARG(kernels[K_MINMAX_PARTIALS], 1, cl_mem, &minmaxPartialsK);
+	SET_ARG(kernels[K_MINMAX_PARTIALS], 2, int, &size);
+	SET_ARG(kernels[K_MINMAX_FINAL], 0, cl_mem, &minmaxPartialsK);
+	SET_ARG(kernels[K_MINMAX_FINAL], 1, int, &minmaxGroups);
+	SET_ARG(kernels[K_MINMAX_FINAL], 2, cl_mem, &minmaxK);
+	SET_ARG(kernels[K_HISTOGRAM], 0, cl_mem, &histogramK);
+	SET_ARG(kernels[K_HISTOGRAM], 1, cl_mem, &keysK);
+	SET_ARG(kernels[K_HISTOGRAM], 2, cl_mem, &minmaxK);
+	SET_ARG(kernels[K_HISTOGRAM], 3, int, &size);
+	SET_ARG(kernels[K_PIVOTS], 0, cl_mem, &histogramK);
+	SET_ARG(kernels[K_PIVOTS], 1, int, &histogramGroups);
+	SET_ARG(kernels[K_PIVOTS], 2, cl_mem, &minmaxK);
+	SET_ARG(kernels[K_PIVOTS], 3, cl_mem, &pivotsK);
+	SET_ARG(kernels[K_PIVOTS], 4, int, &size);
+	SET_ARG(kernels[K_BUCKETCOUNT], 0, cl_mem, &keysK);
+	SET_ARG(kernels[K_BUCKETCOUNT], 1, cl_mem, &indiceK);
+	SET_ARG(kernels[K_BUCKETCOUNT], 2, cl_mem, &prefixOffsetsK);
+	SET_ARG(kernels[K_BUCKETCOUNT], 3, int, &size);
+	SET_ARG(kernels[K_BUCKETCOUNT], 4, cl_mem, &pivotsK);
+	SET_ARG(kernels[K_BUCKETPREFIX], 0, cl_mem, &prefixOffsetsK);
+	SET_ARG(kernels[K_BUCKETPREFIX], 1, cl_mem, &offsetsK);
+	SET_ARG(kernels[K_BUCKETPREFIX], 2, int, &blocks);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 0, cl_mem, &offsetsK);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 1, cl_mem, &lOffsetsK);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 2, cl_mem, &constStartAddrK);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 3, cl_mem, &nullElemsK);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 4, cl_mem, &finalStartAddrK);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 5, cl_mem, &mergeK[0]);
+	SET_ARG(kernels[K_BUCKETOFFSETS], 6, cl_mem, &sizesK);
+	SET_ARG(kernels[K_BUCKETSORT], 0, cl_mem, &keysK);
+	SET_ARG(kernels[K_BUCKETSORT], 1, cl_mem, &indiceK);
+	SET_ARG(kernels[K_BUCKETSORT], 2, cl_mem, &mergeK[0]);
+	SET_ARG(kernels[K_BUCKETSORT], 3, int, &size);
+	SET_ARG(kernels[K_BUCKETSORT], 4, cl_mem, &prefixOffsetsK);
+	SET_ARG(kernels[K_BUCKETSORT], 5, cl_mem, &lOffsetsK);
+	SET_ARG(kernels[K_MERGEFIRST], 0, cl_mem, &mergeK[0]);
+	SET_ARG(kernels[K_MERGEFIRST], 1, cl_mem, &mergeK[1]);
+	SET_ARG(kernels[K_MERGEPASS], 4, cl_mem, &constStartAddrK);
+	SET_ARG(kernels[K_MERGEPACK], 1, cl_mem, &resultK);
+	SET_ARG(kernels[K_MERGEPACK], 2, cl_mem, &constStartAddrK);
+	SET_ARG(kernels[K_MERGEPACK], 3, cl_mem, &nullElemsK);
+	SET_ARG(kernels[K_MERGEPACK], 4, cl_mem, &finalStartAddrK);
+	PRINT_SUCCESS();
+
+	/* Keys are not modified by the pipeline, so they are written once for all runs */
+	PRINT_STEP("Writing keys...");
+	fRet = clEnqueueWriteBuffer(queue, keysK, CL_TRUE, 0, size * sizeof(float), keys, 0, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (keysK)"));
+	PRINT_SUCCESS();
+
+	for(i = 0; i < runs; i++) {
+		PRINT_STEP("[%d] Running sort pipeline...", i);
+		gettimeofday(&tThen, NULL);
+
+		/* Pivot selection and bucketing never leave the device */
+		ENQUEUE_1D(kernels[K_MINMAX_PARTIALS], MINMAX_GROUPS * MINMAX_THREAD_N, MINMAX_THREAD_N);
+		ENQUEUE_1D(kernels[K_MINMAX_FINAL], 1, 1);
+		ENQUEUE_1D(kernels[K_HISTOGRAM], HISTOGRAM_GROUPS * HISTOGRAM_THREAD_N, HISTOGRAM_THREAD_N);
+		ENQUEUE_1D(kernels[K_PIVOTS], PIVOT_THREAD_N, PIVOT_THREAD_N);
+		ENQUEUE_1D(kernels[K_BUCKETCOUNT], (size_t) blocks * BUCKET_THREAD_N, BUCKET_THREAD_N);
+		ENQUEUE_1D(kernels[K_BUCKETPREFIX], DIVISIONS, BUCKET_THREAD_N);
+		ENQUEUE_1D(kernels[K_BUCKETOFFSETS], 1, 1);
+		ENQUEUE_1D(kernels[K_BUCKETSORT], (size_t) blocks * BUCKET_THREAD_N, BUCKET_THREAD_N);
+
+		/* Merge passes depend on the division sizes, the only values read back */
+		fRet = clEnqueueReadBuffer(queue, sizesK, CL_TRUE, 0, 2 * sizeof(int), sizes, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (sizesK)"));
+
+		listsize = sizes[1] / 4;
+		SET_ARG(kernels[K_MERGEFIRST], 2, int, &listsize);
+		ENQUEUE_1D(kernels[K_MERGEFIRST], ROUND_UP((size_t) listsize, MERGE_FIRST_THREAD_N), MERGE_FIRST_THREAD_N);
+
+		/* Each pass merges pairs of sorted runs of nrElems / 2 float4, until a single work-item covers the largest division */
+		cur = 1;
+		nrElems = 2;
+		do {
+			threadsPerDiv = ((sizes[0] / 4) + nrElems - 1) / nrElems;
+			if(!threadsPerDiv)
+				threadsPerDiv = 1;
+			ASSERT_CALL((size_t) threadsPerDiv * DIVISIONS <= INT_MAX, PRINT_FAIL(); fprintf(stderr, "Error: largest division (%d keys) is too large to be merged.\n", sizes[0]); rv = EXIT_FAILURE);
+
+			SET_ARG(kernels[K_MERGEPASS], 0, cl_mem, &mergeK[cur]);
+			SET_ARG(kernels[K_MERGEPASS], 1, cl_mem, &mergeK[1 - cur]);
+			SET_ARG(kernels[K_MERGEPASS], 2, int, &nrElems);
+			SET_ARG(kernels[K_MERGEPASS], 3, int, &threadsPerDiv);
+			ENQUEUE_1D(kernels[K_MERGEPASS], ROUND_UP((size_t) threadsPerDiv * DIVISIONS, MERGE_THREAD_N), MERGE_THREAD_N);
+
+			cur = 1 - cur;
+			nrElems *= 2;
+		} while(threadsPerDiv > 1);
+
+		/* Drop the padding of every division */
+		{
+			size_t globalSize[2] = {ROUND_UP((size_t) sizes[0], PACK_THREAD_N), DIVISIONS};
+			size_t localSize[2] = {PACK_THREAD_N, 1};
+
+			SET_ARG(kernels[K_MERGEPACK], 0, cl_mem, &mergeK[cur]);
+			fRet = clEnqueueNDRangeKernel(queue, kernels[K_MERGEPACK], 2, NULL, globalSize, localSize, 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (mergepack)"));
+		}
+
+		clFinish(queue);
+		gettimeofday(&tNow, NULL);
+		PRINT_SUCCESS();
+		timersub(&tNow, &tThen, &tDelta);
+		timeradd(&tExecTime, &tDelta, &tExecTime);
+	}
+
+	/* Get sorted keys */
+	PRINT_STEP("Reading sorted keys...");
+	fRet = clEnqueueReadBuffer(queue, resultK, CL_TRUE, 0, size * sizeof(float), result, 0, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (resultK)"));
+	PRINT_SUCCESS();
+
+	/* CPU baseline */
+	PRINT_STEP("Sorting keys with qsort...");
+	memcpy(reference, keys, size * sizeof(float));
+	gettimeofday(&tThen, NULL);
+	qsort(reference, size, sizeof(float), compareKeys);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tCPUTime);
+	PRINT_SUCCESS();
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	FULLPOSTAMBLE(result, reference, size);
+	PRINT_SUCCESS();
+
+	/* Print profiling results */
+	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
+	long cpuTime = (1000000 * tCPUTime.tv_sec) + tCPUTime.tv_usec;
+	printf("Elapsed time spent on kernels: %ld us; Average time per run: %lf us.\n", totalTime, totalTime / (double) runs);
+	if(totalTime)
+		printf("Throughput: %lf keys/s (%d per run).\n", (size * (double) runs * 1000000) / totalTime, size);
+	printf("Elapsed time spent on qsort: %ld us.\n", cpuTime);
+	if(cpuTime)
+		printf("Throughput (qsort): %lf keys/s.\n", (size * 1000000.0) / cpuTime);
+#ifndef FULL_PROGRAM_BINARY
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
+#endif
+
+_err:
+
+	if(queue)
+		clFinish(queue);
+
+	/* Dealloc buffers */
+	if(keysK)
+		clReleaseMemObject(keysK);
+	if(minmaxPartialsK)
+		clReleaseMemObject(minmaxPartialsK);
+	if(minmaxK)
+		clReleaseMemObject(minmaxK);
+	if(histogramK)
+		clReleaseMemObject(histogramK);
+	if(pivotsK)
+		clReleaseMemObject(pivotsK);
+	if(indiceK)
+		clReleaseMemObject(indiceK);
+	if(prefixOffsetsK)
+		clReleaseMemObject(prefixOffsetsK);
+	if(offsetsK)
+		clReleaseMemObject(offsetsK);
+	if(lOffsetsK)
+		clReleaseMemObject(lOffsetsK);
+	if(constStartAddrK)
+		clReleaseMemObject(constStartAddrK);
+	if(nullElemsK)
+		clReleaseMemObject(nullElemsK);
+	if(finalStartAddrK)
+		clReleaseMemObject(finalStartAddrK);
+	if(sizesK)
+		clReleaseMemObject(sizesK);
+	for(i = 0; i < 2; i++) {
+		if(mergeK[i])
+			clReleaseMemObject(mergeK[i]);
+	}
+	if(resultK)
+		clReleaseMemObject(resultK);
+
+	/* Dealloc kernels */
+	for(k = 0; k < K_TOTAL; k++) {
+		if(kernels[k])
+			clReleaseKernel(kernels[k]);
+	}
+
+	/* Dealloc variables */
+	free(keys);
+	free(result);
+	free(reference);
+
+	/* Dealloc program */
+	if(program)
+		clReleaseProgram(program);
+	if(programContent)
+		free(programContent);
+	if(programFile)
+		fclose(programFile);
+
+	/* Last OpenCL variables */
+	if(queue)
+		clReleaseCommandQueue(queue);
+	if(context)
+		clReleaseContext(context);
+	if(devices)
+		free(devices);
+	if(platforms)
+		free(platforms);
+
+	return rv;
+}
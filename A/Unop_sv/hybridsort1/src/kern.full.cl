@@ -0,0 +1,421 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina and others
+ *
+ * Adapted from
+ * rodinia_3.1/opencl/hybridsort/histogram1024.cl
+ * rodinia_3.1/opencl/hybridsort/bucketsort_kernels.cl
+ * rodinia_3.1/opencl/hybridsort/mergesort.cl
+ * Different licensing may apply, please check Rodinia documentation.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Copyright 1993-2009 NVIDIA Corporation.  All rights reserved.
+ *
+ * NVIDIA Corporation and its licensors retain all intellectual property and
+ * proprietary rights in and to this software and related documentation.
+ * Any use, reproduction, disclosure, or distribution of this software
+ * and related documentation without an express license agreement from
+ * NVIDIA Corporation is strictly prohibited.
+ *
+ * Please refer to the applicable NVIDIA end user license agreement (EULA)
+ * associated with this source code for terms and conditions that govern
+ * your use of this NVIDIA software.
+ *
+ */
+
+/*
+ * Full hybrid sort pipeline (host.full.c): min/max, histogram, pivot points, bucket count/prefix/offsets, bucket sort,
+ * merge sort passes and packing. The work-group sizes below are repeated in host.full.c.
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Common definition
+////////////////////////////////////////////////////////////////////////////////
+#define MINMAX_THREAD_N 256
+#define BIN_COUNT (1024)
+#define HISTOGRAM_THREAD_N 96
+//Per-warp sub-histograms reduce contention on the local atomics
+#define WARP_LOG_SIZE 5
+#define WARP_N 3
+#define BLOCK_MEMORY (WARP_N * BIN_COUNT)
+#define PIVOT_THREAD_N 256
+
+#define DIVISIONS               (1 << 10)
+#define LOG_DIVISIONS	(10)
+#define BUCKET_THREAD_N			(32)
+#define BUCKET_BLOCK_MEMORY		(DIVISIONS)
+#define MERGE_FIRST_THREAD_N 256
+#define MERGE_THREAD_N 208
+#define PACK_THREAD_N 256
+
+////////////////////////////////////////////////////////////////////////////////
+// Min/max of the input: one partial pair per work-group, then a single work-item
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((reqd_work_group_size(MINMAX_THREAD_N,1,1)))
+__kernel void minmaxPartials(__global const float *input, __global float *partials, const int size) {
+	__local float s_min[MINMAX_THREAD_N];
+	__local float s_max[MINMAX_THREAD_N];
+	int lid = get_local_id(0);
+	float mn = INFINITY;
+	float mx = -INFINITY;
+
+	for(int pos = get_global_id(0); pos < size; pos += get_global_size(0)) {
+		float elem = input[pos];
+		mn = fmin(mn, elem);
+		mx = fmax(mx, elem);
+	}
+	s_min[lid] = mn;
+	s_max[lid] = mx;
+
+	for(int s = MINMAX_THREAD_N / 2; s > 0; s >>= 1) {
+		barrier(CLK_LOCAL_MEM_FENCE);
+		if(lid < s) {
+			s_min[lid] = fmin(s_min[lid], s_min[lid + s]);
+			s_max[lid] = fmax(s_max[lid], s_max[lid + s]);
+		}
+	}
+
+	if(!lid) {
+		partials[2 * get_group_id(0)] = s_min[0];
+		partials[2 * get_group_id(0) + 1] = s_max[0];
+	}
+}
+
+__kernel void minmaxFinal(__global const float *partials, const int ngroups, __global float *minmax) {
+	float mn = INFINITY;
+	float mx = -INFINITY;
+
+	for(int i = 0; i < ngroups; i++) {
+		mn = fmin(mn, partials[2 * i]);
+		mx = fmax(mx, partials[2 * i + 1]);
+	}
+
+	minmax[0] = mn;
+	minmax[1] = mx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Per-workgroup partial histograms. Differently from histogram1024Kernel, the
+// bins are counted with local atomics (the tagged updates rely on warp-synchronous
+// execution), the maximum falls in the last bin instead of wrapping to the first,
+// and each work-group writes its own histogram, so nothing has to be zeroed.
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((reqd_work_group_size(HISTOGRAM_THREAD_N,1,1)))
+__kernel void histogramPartials(__global uint *d_Partials, __global const float *d_Data, __global const float *d_MinMax, const int dataCount) {
+	__local uint s_Hist[BLOCK_MEMORY];
+	const int warpBase = (get_local_id(0) >> WARP_LOG_SIZE) * BIN_COUNT;
+	const float minimum = d_MinMax[0];
+	const float range = d_MinMax[1] - minimum;
+
+	for(int i = get_local_id(0); i < BLOCK_MEMORY; i += get_local_size(0))
+		s_Hist[i] = 0;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int pos = get_global_id(0); pos < dataCount; pos += get_global_size(0)) {
+		uint data = (range > 0)? (uint) (((d_Data[pos] - minimum) / range) * BIN_COUNT) : 0;
+		atomic_inc(s_Hist + warpBase + min(data, (uint) (BIN_COUNT - 1)));
+	}
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int pos = get_local_id(0); pos < BIN_COUNT; pos += get_local_size(0)) {
+		uint sum = 0;
+		for(int i = 0; i < BLOCK_MEMORY; i += BIN_COUNT)
+			sum += s_Hist[pos + i];
+		d_Partials[get_group_id(0) * BIN_COUNT + pos] = sum;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Pivot points (calcPivotPoints of Rodinia's host, run by a single work-group).
+// Division i gets the elements in [pivot[i - 1], pivot[i]); bucketcount only
+// reads the first DIVISIONS - 1 pivots, which are interpolated linearly within
+// the histogram bins so that every division gets about size / DIVISIONS elements.
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((reqd_work_group_size(PIVOT_THREAD_N,1,1)))
+__kernel void pivotPoints(__global const uint *d_Partials, const int ngroups, __global const float *d_MinMax, __global float *l_pivotpoints, const int size) {
+	__local uint s_Hist[BIN_COUNT];
+	int lid = get_local_id(0);
+
+	for(int pos = lid; pos < BIN_COUNT; pos += PIVOT_THREAD_N) {
+		uint sum = 0;
+		for(int i = 0; i < ngroups; i++)
+			sum += d_Partials[i * BIN_COUNT + pos];
+		s_Hist[pos] = sum;
+	}
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	if(!lid) {
+		const float minimum = d_MinMax[0];
+		const float maximum = d_MinMax[1];
+		const float histoWidth = (maximum - minimum) / BIN_COUNT;
+		const float elemsPerSlice = size / (float) DIVISIONS;
+		float startsAt = minimum;
+		float weNeed = elemsPerSlice;
+		int pIdx = 0;
+
+		for(int i = 0; i < BIN_COUNT; i++) {
+			float count = s_Hist[i];
+			float remaining = count;
+
+			while(remaining > weNeed && pIdx < DIVISIONS - 1) {
+				startsAt += (weNeed / count) * histoWidth;
+				l_pivotpoints[pIdx++] = startsAt;
+				remaining -= weNeed;
+				weNeed = elemsPerSlice;
+			}
+
+			weNeed -= remaining;
+			startsAt = minimum + (i + 1) * histoWidth;
+		}
+
+		while(pIdx < DIVISIONS)
+			l_pivotpoints[pIdx++] = maximum;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bucket count: each element gets its division (lower bits of indice) and its
+// position among the elements of the same division in its work-group (upper bits)
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((reqd_work_group_size(BUCKET_THREAD_N,1,1)))
+__kernel void bucketcount(__global const float *input, __global int *indice, __global uint *d_prefixoffsets, const int size, __global const float *l_pivotpoints) {
+	__local uint s_offset[BUCKET_BLOCK_MEMORY];
+	const int prefixBase = get_group_id(0) * BUCKET_BLOCK_MEMORY;
+
+	for(int i = get_local_id(0); i < BUCKET_BLOCK_MEMORY; i += get_local_size(0))
+		s_offset[i] = 0;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int tid = get_global_id(0); tid < size; tid += get_global_size(0)) {
+		float elem = input[tid];
+		int idx = DIVISIONS / 2 - 1;
+		int jump = DIVISIONS / 4;
+		float piv = l_pivotpoints[idx];
+
+		while(jump >= 1) {
+			idx = (elem < piv)? (idx - jump) : (idx + jump);
+			piv = l_pivotpoints[idx];
+			jump /= 2;
+		}
+		idx = (elem < piv)? idx : (idx + 1);
+
+		indice[tid] = (atomic_inc(&s_offset[idx]) << LOG_DIVISIONS) + idx;
+	}
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int i = get_local_id(0); i < BUCKET_BLOCK_MEMORY; i += get_local_size(0))
+		d_prefixoffsets[prefixBase + i] = s_offset[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bucket prefix: one work-item per division turns the per-group counts into
+// per-group offsets within the division and writes the size of the division
+////////////////////////////////////////////////////////////////////////////////
+__kernel void bucketprefixoffset(__global uint *d_prefixoffsets, __global uint *d_offsets, const int blocks) {
+	const int tid = get_global_id(0);
+	const int size = blocks * BUCKET_BLOCK_MEMORY;
+	uint sum = 0;
+
+	for(int i = tid; i < size; i += DIVISIONS) {
+		uint x = d_prefixoffsets[i];
+		d_prefixoffsets[i] = sum;
+		sum += x;
+	}
+
+	d_offsets[tid] = sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bucket offsets (Rodinia's host bookkeeping, run by a single work-item).
+// Divisions are padded to multiples of 4 with -INFINITY, which merge sort places
+// at their beginning and mergepack skips. sizes[0] is the largest padded division
+// and sizes[1] the padded list length, both in floats.
+////////////////////////////////////////////////////////////////////////////////
+__kernel void bucketoffsets(__global const uint *d_offsets, __global uint *l_offsets, __global int *constStartAddr, __global uint *nullElems,
+	__global int *finalStartAddr, __global float *output, __global int *sizes) {
+	uint padded = 0;
+	uint unpadded = 0;
+	uint largest = 0;
+
+	for(int i = 0; i < DIVISIONS; i++) {
+		uint count = d_offsets[i];
+		uint paddedCount = (count + 3) & ~3U;
+
+		l_offsets[i] = padded;
+		constStartAddr[i] = padded / 4;
+		nullElems[i] = paddedCount - count;
+		finalStartAddr[i] = unpadded;
+		for(uint j = count; j < paddedCount; j++)
+			output[padded + j] = -INFINITY;
+
+		padded += paddedCount;
+		unpadded += count;
+		largest = max(largest, paddedCount);
+	}
+
+	constStartAddr[DIVISIONS] = padded / 4;
+	finalStartAddr[DIVISIONS] = unpadded;
+	sizes[0] = largest;
+	sizes[1] = padded;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bucket sort: scatter every element to its division
+////////////////////////////////////////////////////////////////////////////////
+__attribute__((reqd_work_group_size(BUCKET_THREAD_N,1,1)))
+__kernel void bucketsort(__global const float *input, __global const int *indice, __global float *output, const int size, __global const uint *d_prefixoffsets,
+	__global const uint *l_offsets) {
+	__local uint s_offset[BUCKET_BLOCK_MEMORY];
+	const int prefixBase = get_group_id(0) * BUCKET_BLOCK_MEMORY;
+
+	for(int i = get_local_id(0); i < BUCKET_BLOCK_MEMORY; i += get_local_size(0))
+		s_offset[i] = l_offsets[i] + d_prefixoffsets[prefixBase + i];
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int tid = get_global_id(0); tid < size; tid += get_global_size(0)) {
+		int id = indice[tid];
+		output[s_offset[id & (DIVISIONS - 1)] + (id >> LOG_DIVISIONS)] = input[tid];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Merge sort
+////////////////////////////////////////////////////////////////////////////////
+float4 sortElem(float4 r) {
+	float4 nr;
+
+	nr.x = (r.x > r.y) ? r.y : r.x;
+	nr.y = (r.y > r.x) ? r.y : r.x;
+	nr.z = (r.z > r.w) ? r.w : r.z;
+	nr.w = (r.w > r.z) ? r.w : r.z;
+
+	r.x = (nr.x > nr.z) ? nr.z : nr.x;
+	r.y = (nr.y > nr.w) ? nr.w : nr.y;
+	r.z = (nr.z > nr.x) ? nr.z : nr.x;
+	r.w = (nr.w > nr.y) ? nr.w : nr.y;
+
+	nr.x = r.x;
+	nr.y = (r.y > r.z) ? r.z : r.y;
+	nr.z = (r.z > r.y) ? r.z : r.y;
+	nr.w = r.w;
+	return nr;
+}
+
+float4 getLowest(float4 a, float4 b) {
+	a.x = (a.x < b.w) ? a.x : b.w;
+	a.y = (a.y < b.z) ? a.y : b.z;
+	a.z = (a.z < b.y) ? a.z : b.y;
+	a.w = (a.w < b.x) ? a.w : b.x;
+	return a;
+}
+
+float4 getHighest(float4 a, float4 b) {
+	b.x = (a.w >= b.x) ? a.w : b.x;
+	b.y = (a.z >= b.y) ? a.z : b.y;
+	b.z = (a.y >= b.z) ? a.y : b.z;
+	b.w = (a.x >= b.w) ? a.x : b.w;
+	return b;
+}
+
+__attribute__((reqd_work_group_size(MERGE_FIRST_THREAD_N,1,1)))
+__kernel void mergeSortFirst(__global const float4 *input, __global float4 *result, const int listsize) {
+	int bx = get_global_id(0);
+
+	if(bx < listsize)
+		result[bx] = sortElem(input[bx]);
+}
+
+// Reads one float4 past the end of the list, so buffers must have this slack
+__attribute__((reqd_work_group_size(MERGE_THREAD_N,1,1)))
+__kernel void mergeSortPass(__global const float4 *input, __global float4 *result, const int nrElems, int threadsPerDiv, __global const int *constStartAddr) {
+	int gid = get_global_id(0);
+	// The division to work on
+	int division = gid / threadsPerDiv;
+	if(division >= DIVISIONS) return;
+	// The block within the division
+	int int_gid = gid - division * threadsPerDiv;
+	int Astart = constStartAddr[division] + int_gid * nrElems;
+	int Bstart = Astart + nrElems / 2;
+	int end = constStartAddr[division + 1];
+	__global float4 *resStart = &(result[Astart]);
+
+	if(Astart >= end)
+		return;
+	if(Bstart >= end) {
+		for(int i = 0; i < (end - Astart); i++)
+			resStart[i] = input[Astart + i];
+		return;
+	}
+
+	int aidx = 0;
+	int bidx = 0;
+	int outidx = 0;
+	float4 a, b;
+	a = input[Astart + aidx];
+	b = input[Bstart + bidx];
+
+	while(true) {
+		float4 nextA = input[Astart + aidx + 1];
+		float4 nextB = input[Bstart + bidx + 1];
+
+		float4 na = getLowest(a, b);
+		float4 nb = getHighest(a, b);
+		a = sortElem(na);
+		b = sortElem(nb);
+		// Now, a contains the lowest four elements, sorted
+		resStart[outidx++] = a;
+
+		// Astart + aidx + 1 is always less than division border
+		bool elemsLeftInA = (aidx + 1 < nrElems / 2);
+		bool elemsLeftInB = (bidx + 1 < nrElems / 2) && (Bstart + bidx + 1 < end);
+
+		if(elemsLeftInA) {
+			if(elemsLeftInB) {
+				if(nextA.x < nextB.x) { aidx += 1; a = nextA; }
+				else { bidx += 1; a = nextB; }
+			}
+			else {
+				aidx += 1; a = nextA;
+			}
+		}
+		else {
+			if(elemsLeftInB) {
+				bidx += 1; a = nextB;
+			}
+			else {
+				break;
+			}
+		}
+	}
+	resStart[outidx++] = b;
+}
+
+// Second dimension is the division, dropping its padding
+__attribute__((reqd_work_group_size(PACK_THREAD_N,1,1)))
+__kernel void mergepack(__global const float *orig, __global float *result, __global const int *constStartAddr, __global const uint *nullElems,
+	__global const int *finalStartAddr) {
+	int idx = get_global_id(0);
+	int division = get_global_id(1);
+
+	if((finalStartAddr[division] + idx) >= finalStartAddr[division + 1])
+		return;
+	result[finalStartAddr[division] + idx] = orig[constStartAddr[division] * 4 + nullElems[division] + idx];
+}
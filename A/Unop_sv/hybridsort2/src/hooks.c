@@ -0,0 +1,135 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz);
+ *            POSTAMBLE(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz);
+ *            LOOPPREAMBLE(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz, loopFlag);
+ *            LOOPPOSTAMBLE(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz, loopFlag);
+ *            CLEANUP(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz);
+ *        where:
+ *            input: variable (float *);
+ *            inputSz: number of members in variable (unsigned int);
+ *            indice: variable (int *);
+ *            indiceSz: number of members in variable (unsigned int);
+ *            output: variable (float *);
+ *            outputSz: number of members in variable (unsigned int);
+ *            outputC: variable (float *);
+ *            outputCSz: number of members in variable (unsigned int);
+ *            size: variable (int);
+ *            d_prefixoffsets: variable (unsigned int *);
+ *            d_prefixoffsetsSz: number of members in variable (unsigned int);
+ *            l_offsets: variable (unsigned int *);
+ *            l_offsetsSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *input = NULL;
+static unsigned int inputSz = 0;
+static int *indice = NULL;
+static unsigned int indiceSz = 0;
+static float *output = NULL;
+static unsigned int outputSz = 0;
+static float *outputC = NULL;
+static unsigned int outputCSz = 0;
+static int size;
+static unsigned int *d_prefixoffsets = NULL;
+static unsigned int d_prefixoffsetsSz = 0;
+static unsigned int *l_offsets = NULL;
+static unsigned int l_offsetsSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeBucketsort = NULL;
+static size_t *localSizeBucketsort = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(input),
+	RT_BIND_POINTER(indice),
+	RT_BIND_POINTER_C(output),
+	RT_BIND_VALUE(size),
+	RT_BIND_POINTER(d_prefixoffsets),
+	RT_BIND_POINTER(l_offsets),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(bucketsort, Bucketsort),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(input, inputSz, indice, indiceSz, output, outputSz, outputC, outputCSz, size, d_prefixoffsets, d_prefixoffsetsSz, l_offsets, l_offsetsSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
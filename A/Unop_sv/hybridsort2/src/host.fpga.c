@@ -99,6 +99,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBucketsort = NULL;
+	cl_command_queue transferQueueBucketsort = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,6 +110,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimBucketsort = 3;
 	size_t globalSizeBucketsort[3] = {
 		7840, 1, 1
@@ -162,7 +164,13 @@ int main(void) {
 
 	/* Create command queue for bucketsort kernel */
 	PRINT_STEP("Creating command queue for \"bucketsort\"...");
-	queueBucketsort = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBucketsort = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bucketsort kernel */
+	PRINT_STEP("Creating transfer command queue for \"bucketsort\"...");
+	transferQueueBucketsort = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -235,23 +243,24 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBucketsort, inputK, CL_TRUE, 0, 1004096 * sizeof(float), input, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBucketsort, inputK, TRANSFER_BLOCKING, 0, 1004096 * sizeof(float), input, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (inputK)"));
-		fRet = clEnqueueWriteBuffer(queueBucketsort, indiceK, CL_TRUE, 0, 1000000 * sizeof(int), indice, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBucketsort, indiceK, TRANSFER_BLOCKING, 0, 1000000 * sizeof(int), indice, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "indice"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (indiceK)"));
-		fRet = clEnqueueWriteBuffer(queueBucketsort, outputK, CL_TRUE, 0, 1004096 * sizeof(float), output, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBucketsort, outputK, TRANSFER_BLOCKING, 0, 1004096 * sizeof(float), output, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "output"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outputK)"));
 		fRet = clSetKernelArg(kernelBucketsort, 3, sizeof(int), &size);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (size)"));
-		fRet = clEnqueueWriteBuffer(queueBucketsort, d_prefixoffsetsK, CL_TRUE, 0, 250880 * sizeof(unsigned int), d_prefixoffsets, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBucketsort, d_prefixoffsetsK, TRANSFER_BLOCKING, 0, 250880 * sizeof(unsigned int), d_prefixoffsets, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_prefixoffsets"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_prefixoffsetsK)"));
-		fRet = clEnqueueWriteBuffer(queueBucketsort, l_offsetsK, CL_TRUE, 0, 1024 * sizeof(unsigned int), l_offsets, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBucketsort, l_offsetsK, TRANSFER_BLOCKING, 0, 1024 * sizeof(unsigned int), l_offsets, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "l_offsets"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (l_offsetsK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBucketsort);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBucketsort, kernelBucketsort, workDimBucketsort, NULL, globalSizeBucketsort, localSizeBucketsort, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBucketsort, kernelBucketsort, workDimBucketsort, NULL, globalSizeBucketsort, localSizeBucketsort, ASYNC_WAIT_LIST(profileEvents, 0, 5), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bucketsort"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBucketsort);
 		gettimeofday(&tNow, NULL);
@@ -259,9 +268,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBucketsort, outputK, CL_TRUE, 0, 1004096 * sizeof(float), output, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBucketsort, outputK, TRANSFER_BLOCKING, 0, 1004096 * sizeof(float), output, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "output"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 6, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -272,6 +283,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -289,6 +301,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(inputK)
 		clReleaseMemObject(inputK);
@@ -324,6 +339,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBucketsort)
 		clReleaseCommandQueue(queueBucketsort);
+	if(transferQueueBucketsort)
+		clReleaseCommandQueue(transferQueueBucketsort);
 
 	/* Last OpenCL variables */
 	if(context)
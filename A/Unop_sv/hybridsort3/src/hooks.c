@@ -0,0 +1,128 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz);
+ *            POSTAMBLE(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz);
+ *            LOOPPREAMBLE(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz, loopFlag);
+ *            LOOPPOSTAMBLE(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz, loopFlag);
+ *            CLEANUP(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz);
+ *        where:
+ *            input: variable (cl_float4 *);
+ *            inputSz: number of members in variable (unsigned int);
+ *            result: variable (cl_float4 *);
+ *            resultSz: number of members in variable (unsigned int);
+ *            resultC: variable (cl_float4 *);
+ *            resultCSz: number of members in variable (unsigned int);
+ *            nrElems: variable (int);
+ *            threadsPerDiv: variable (int);
+ *            constStartAddr: variable (int *);
+ *            constStartAddrSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static cl_float4 *input = NULL;
+static unsigned int inputSz = 0;
+static cl_float4 *result = NULL;
+static unsigned int resultSz = 0;
+static cl_float4 *resultC = NULL;
+static unsigned int resultCSz = 0;
+static int nrElems;
+static int threadsPerDiv;
+static int *constStartAddr = NULL;
+static unsigned int constStartAddrSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeMergesortpass = NULL;
+static size_t *localSizeMergesortpass = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(input),
+	RT_BIND_POINTER_C(result),
+	RT_BIND_VALUE(nrElems),
+	RT_BIND_VALUE(threadsPerDiv),
+	RT_BIND_POINTER(constStartAddr),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(mergeSortPass, Mergesortpass),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(input, inputSz, result, resultSz, resultC, resultCSz, nrElems, threadsPerDiv, constStartAddr, constStartAddrSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
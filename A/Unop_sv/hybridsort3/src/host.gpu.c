@@ -96,6 +96,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueMergesortpass = NULL;
+	cl_command_queue transferQueueMergesortpass = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -104,8 +105,10 @@ int main(void) {
 	cl_kernel kernelMergesortpass = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimMergesortpass = 3;
 	size_t globalSizeMergesortpass[3] = {
 		248976, 1, 1
@@ -156,7 +159,13 @@ int main(void) {
 
 	/* Create command queue for mergeSortPass kernel */
 	PRINT_STEP("Creating command queue for \"mergeSortPass\"...");
-	queueMergesortpass = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueMergesortpass = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for mergeSortPass kernel */
+	PRINT_STEP("Creating transfer command queue for \"mergeSortPass\"...");
+	transferQueueMergesortpass = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -177,18 +186,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create mergeSortPass kernel */
 	PRINT_STEP("Creating kernel \"mergeSortPass\" from program...");
 	kernelMergesortpass = clCreateKernel(program, "mergeSortPass", &fRet);
@@ -222,21 +244,22 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueMergesortpass, inputK, CL_TRUE, 0, 250383 * sizeof(cl_float4), input, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueMergesortpass, inputK, TRANSFER_BLOCKING, 0, 250383 * sizeof(cl_float4), input, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (inputK)"));
-		fRet = clEnqueueWriteBuffer(queueMergesortpass, resultK, CL_TRUE, 0, 250383 * sizeof(cl_float4), result, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueMergesortpass, resultK, TRANSFER_BLOCKING, 0, 250383 * sizeof(cl_float4), result, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (resultK)"));
 		fRet = clSetKernelArg(kernelMergesortpass, 2, sizeof(int), &nrElems);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (nrElems)"));
 		fRet = clSetKernelArg(kernelMergesortpass, 3, sizeof(int), &threadsPerDiv);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (threadsPerDiv)"));
-		fRet = clEnqueueWriteBuffer(queueMergesortpass, constStartAddrK, CL_TRUE, 0, 1025 * sizeof(int), constStartAddr, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueMergesortpass, constStartAddrK, TRANSFER_BLOCKING, 0, 1025 * sizeof(int), constStartAddr, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "constStartAddr"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (constStartAddrK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueMergesortpass);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueMergesortpass, kernelMergesortpass, workDimMergesortpass, NULL, globalSizeMergesortpass, localSizeMergesortpass, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueMergesortpass, kernelMergesortpass, workDimMergesortpass, NULL, globalSizeMergesortpass, localSizeMergesortpass, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "mergeSortPass"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueMergesortpass);
 		gettimeofday(&tNow, NULL);
@@ -244,9 +267,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueMergesortpass, resultK, CL_TRUE, 0, 250383 * sizeof(cl_float4), result, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueMergesortpass, resultK, TRANSFER_BLOCKING, 0, 250383 * sizeof(cl_float4), result, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -257,6 +282,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -276,6 +303,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(inputK)
 		clReleaseMemObject(inputK);
@@ -305,6 +335,8 @@ _err:
 	/* Dealloc queues */
 	if(queueMergesortpass)
 		clReleaseCommandQueue(queueMergesortpass);
+	if(transferQueueMergesortpass)
+		clReleaseCommandQueue(transferQueueMergesortpass);
 
 	/* Last OpenCL variables */
 	if(context)
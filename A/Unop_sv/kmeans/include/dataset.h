@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Text lines hold a point identifier followed by its features, as read by fgets into a buffer of this size */
+#define DATASET_MAX_LINE 1024
+
+/* Converter threads are capped, and each one parses at least DATASET_MIN_CHUNK bytes of text */
+#define DATASET_MAX_THREADS 64
+#define DATASET_MIN_CHUNK 1048576
+
+#define DATASET_MAGIC "KMFEAT1"
+
+/* Cache header, followed by the features in column-major order */
+typedef struct {
+	char magic[8];
+	unsigned int npoints;
+	unsigned int nfeatures;
+	long long sourceSize;
+	long long sourceMtime;
+} dataset_header_t;
+
+/* Features are column-major (data[f * npoints + p]), either mapped from the cache or converted from text */
+typedef struct {
+	unsigned int npoints;
+	unsigned int nfeatures;
+	float *data;
+	void *mapping;
+	size_t mappingSz;
+	bool cached;
+} dataset_t;
+
+dataset_t *dataset_load(const char *textFile, const char *cacheFile, unsigned int npoints, unsigned int nfeatures);
+void dataset_destroy(dataset_t **dataset);
+
+#endif
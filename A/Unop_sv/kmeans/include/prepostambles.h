@@ -1,8 +1,13 @@
+#include <math.h>
+
+#include "dataset.h"
+
 #define NCLUSTERS 5
 #define THRESHOLD 0.001
+#define FEATURES_FILENAME "kmeans30000"
+#define FEATURES_CACHE_FILENAME "kmeans30000.cache"
 
-float *gTmpBuf = NULL;
-float **gFeatures = NULL;
+dataset_t *gFeatures = NULL;
 float **gClusterCentres = NULL;
 int *gMembershipOrig = NULL;
 float **gClusters = NULL;
@@ -12,47 +17,22 @@ int *gNewCentresLen = NULL;
 float **gNewCentres = NULL;
 
 #define PREAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size) {\
+	LOADPREAMBLE(FEATURES_FILENAME, FEATURES_CACHE_FILENAME, npoints, nclusters, nfeatures);\
+	memcpy(feature, gFeatures->data, npoints * nfeatures * sizeof(float));\
+}
+
+/* Loads the features into gFeatures (without copying them) and picks the initial centres */
+#define LOADPREAMBLE(featuresFile, cacheFile, npoints, nclusters, nfeatures) {\
 	int _i, _j, _k;\
 	int _temp;\
-	FILE *_inFile;\
-	char _line[1024];\
-\
-	_inFile = fopen("kmeans30000", "r");\
-	ASSERT_CALL(_inFile, rv = EXIT_FAILURE);\
-\
-	gTmpBuf = malloc(npoints * nfeatures * sizeof(float));\
-	gFeatures = malloc(npoints * sizeof(float *));\
-	gFeatures[0] = malloc(npoints * nfeatures * sizeof(float));\
-\
-	for(_i = 1; _i < npoints; _i++)\
-		gFeatures[_i] = gFeatures[_i - 1] + nfeatures;\
-\
-	_i = 0;\
-	while(fgets(_line, 1024, _inFile)) {\
-		if(!strtok(_line, " \t\n"))\
-			continue;\
-		for(_j = 0; _j < nfeatures; _j++) {\
-			gTmpBuf[_i] = atof(strtok(NULL, " ,\t\n"));\
-			_i++;\
-		}\
-	}\
-\
-	fclose(_inFile);\
 \
 	ASSERT_CALL(npoints >= NCLUSTERS, rv = EXIT_FAILURE);\
 \
-	srand(7);\
-	memcpy(gFeatures[0], gTmpBuf, npoints * nfeatures * sizeof(float));\
-	free(gTmpBuf);\
-	gTmpBuf = NULL;\
-\
-	gClusterCentres = NULL;\
+	/* Features come already transposed (as by the kmeans_swap kernel) from the binary cache or its converter */\
+	gFeatures = dataset_load(featuresFile, cacheFile, npoints, nfeatures);\
+	ASSERT_CALL(gFeatures, rv = EXIT_FAILURE);\
 \
-	/* This is the kmeans_swap kernel translated to plain C */\
-	for(_i = 0; _i < npoints; _i++) {\
-		for(_j = 0; _j < nfeatures; _j++)\
-			feature[_j * npoints + _i] = gFeatures[0][_i * nfeatures + _j];\
-	}\
+	srand(7);\
 \
 	gMembershipOrig = malloc(npoints * sizeof(int));\
 \
@@ -62,14 +42,14 @@ float **gNewCentres = NULL;
 		gClusters[_i] = gClusters[_i - 1] + nfeatures;\
 \
 	gInitial = malloc(npoints * sizeof(int));\
-	for(_i = 1; _i < npoints; _i++)\
+	for(_i = 0; _i < npoints; _i++)\
 		gInitial[_i] = _i;\
 	gInitialPoints = npoints;\
 \
 	_k = 0;\
 	for(_i = 0; _i < nclusters && gInitialPoints >= 0; _i++) {\
 		for(_j = 0; _j < nfeatures; _j++)\
-			gClusters[_i][_j] = gFeatures[gInitial[_k]][_j];\
+			gClusters[_i][_j] = gFeatures->data[_j * npoints + gInitial[_k]];\
 \
 		_temp = gInitial[_k];\
 		gInitial[_k] = gInitial[gInitialPoints - 1];\
@@ -97,16 +77,120 @@ float **gNewCentres = NULL;
 	int _delta = 0;\
 \
 	for(_i = 0; _i < npoints; _i++) {\
-		int _clusterId = membership[_i];\
-		gNewCentresLen[_clusterId]++;\
+		gNewCentresLen[membership[_i]]++;\
 \
 		if(gMembershipOrig[_i] != membership[_i]) {\
 			_delta++;\
 			gMembershipOrig[_i] = membership[_i];\
 		}\
+	}\
 \
-		for(_j = 0; _j < nfeatures; _j++)\
-			gNewCentres[_clusterId][_j] += gFeatures[_i][_j];\
+	/* Features are column-major, so they are accumulated one feature at a time */\
+	for(_j = 0; _j < nfeatures; _j++) {\
+		for(_i = 0; _i < npoints; _i++)\
+			gNewCentres[membership[_i]][_j] += gFeatures->data[_j * npoints + _i];\
+	}\
+\
+	for(_i = 0; _i < nclusters; _i++) {\
+		for(_j = 0; _j < nfeatures; _j++) {\
+			if(gNewCentresLen[_i] > 0)\
+				gClusters[_i][_j] = gNewCentres[_i][_j] / gNewCentresLen[_i];\
+			gNewCentres[_i][_j] = 0;\
+		}\
+		gNewCentresLen[_i] = 0;\
+	}\
+\
+	loopFlag = (_delta > THRESHOLD) && (i < 500);\
+}
+
+#define LLOYDPREAMBLE(feature, featureSz, clusters, clustersSz, prevMembership, prevMembershipSz, npoints, nclusters, nfeatures, offset, size) {\
+	int _i;\
+\
+	PREAMBLE(feature, featureSz, clusters, clustersSz, prevMembership, prevMembershipSz, npoints, nclusters, nfeatures, offset, size);\
+\
+	/* Initial centres and memberships are uploaded once, then only updated on the device */\
+	memcpy(clusters, gClusters[0], nclusters * nfeatures * sizeof(float));\
+	for(_i = 0; _i < npoints; _i++)\
+		prevMembership[_i] = -1;\
+}
+
+#define LLOYDLOOPPOSTAMBLE(delta, loopFlag) {\
+	loopFlag = (delta > THRESHOLD) && (i < 500);\
+}
+
+/* Relative error allowed on the centres (against the mean magnitude of their features) and on the distance of a point to its centre */
+#define LLOYD_EPSILON 1.0e-4
+
+/* Validate the device Lloyd loop with a host Lloyd iteration from its final state: the centres must be the means of the final
+   memberships and, once no point changed cluster (delta is 0), every point must already be in the cluster of its nearest centre */
+#define LLOYDPOSTAMBLE(feature, clusters, membership, npoints, nclusters, nfeatures, delta) {\
+	int _i, _j, _c, _nearest = 0;\
+	double _dist, _min = 0, _own = 0, _expected = 0, _diff;\
+	double *_sums = calloc(2 * nclusters * nfeatures, sizeof(double));\
+	double *_magnitudes = _sums + nclusters * nfeatures;\
+	int *_counts = calloc(nclusters, sizeof(int));\
+\
+	ASSERT_CALL(_sums && _counts, fprintf(stderr, "Error: could not allocate reference centres.\n"); free(_sums); free(_counts); rv = EXIT_FAILURE);\
+\
+	for(_i = 0; (_i < npoints) && (membership[_i] >= 0) && (membership[_i] < nclusters); _i++) {\
+		_counts[membership[_i]]++;\
+		for(_j = 0; _j < nfeatures; _j++) {\
+			_sums[membership[_i] * nfeatures + _j] += feature[_j * npoints + _i];\
+			_magnitudes[membership[_i] * nfeatures + _j] += fabs(feature[_j * npoints + _i]);\
+		}\
+	}\
+	if(_i < npoints)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_i == npoints, printf("Variable membership[%d]: cluster %d out of range.\n", _i, membership[_i]); free(_sums); free(_counts); rv = EXIT_FAILURE);\
+\
+	/* Empty clusters keep their previous centre */\
+	for(_c = 0; _c < nclusters * nfeatures; _c++) {\
+		if(!_counts[_c / nfeatures])\
+			continue;\
+		_expected = _sums[_c] / _counts[_c / nfeatures];\
+		_diff = fabs(clusters[_c] - _expected);\
+		if(_diff > LLOYD_EPSILON * _magnitudes[_c] / _counts[_c / nfeatures])\
+			break;\
+	}\
+	if(_c < nclusters * nfeatures)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_c == nclusters * nfeatures, printf("Variable clusters[%d]: expected %f got %f.\n", _c, _expected, clusters[_c]); free(_sums); free(_counts); rv = EXIT_FAILURE);\
+\
+	for(_i = 0; !delta && (_i < npoints); _i++) {\
+		for(_c = 0; _c < nclusters; _c++) {\
+			_dist = 0;\
+			for(_j = 0; _j < nfeatures; _j++)\
+				_dist += (feature[_j * npoints + _i] - clusters[_c * nfeatures + _j]) * (double) (feature[_j * npoints + _i] - clusters[_c * nfeatures + _j]);\
+			if(!_c || (_dist < _min)) {\
+				_min = _dist;\
+				_nearest = _c;\
+			}\
+			if(_c == membership[_i])\
+				_own = _dist;\
+		}\
+		if(_own - _min > LLOYD_EPSILON * _own)\
+			break;\
+	}\
+	free(_sums);\
+	free(_counts);\
+	if(!delta && (_i < npoints))\
+		PRINT_FAIL();\
+	ASSERT_CALL(delta || (_i == npoints), printf("Variable membership[%d]: expected %d got %d.\n", _i, _nearest, membership[_i]); rv = EXIT_FAILURE);\
+}
+
+#define STREAMLOOPPOSTAMBLE(clusters, sums, counts, deltas, slots, nclusters, nfeatures, loopFlag) {\
+	int _i, _j;\
+	unsigned int _s;\
+	int _delta = 0;\
+\
+	/* Each slot holds the sums of the chunks streamed through it */\
+	for(_s = 0; _s < slots; _s++) {\
+		for(_i = 0; _i < nclusters; _i++) {\
+			gNewCentresLen[_i] += counts[_s * nclusters + _i];\
+			for(_j = 0; _j < nfeatures; _j++)\
+				gNewCentres[_i][_j] += sums[(_s * nclusters + _i) * nfeatures + _j];\
+		}\
+		_delta += deltas[_s];\
 	}\
 \
 	for(_i = 0; _i < nclusters; _i++) {\
@@ -117,6 +201,7 @@ float **gNewCentres = NULL;
 		}\
 		gNewCentresLen[_i] = 0;\
 	}\
+	memcpy(clusters, gClusters[0], nclusters * nfeatures * sizeof(float));\
 \
 	loopFlag = (_delta > THRESHOLD) && (i < 500);\
 }
@@ -146,11 +231,6 @@ float **gNewCentres = NULL;
 	if(gMembershipOrig)\
 		free(gMembershipOrig);\
 \
-	if(gFeatures) {\
-		free(gFeatures[0]);\
-		free(gFeatures);\
-	}\
-\
-	if(gTmpBuf)\
-		free(gTmpBuf);\
+	if(gFeatures)\
+		dataset_destroy(&gFeatures);\
 }
@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dataset.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+	const char *text;
+	size_t first;
+	size_t last;
+	unsigned int firstPoint;
+	unsigned int points;
+	float *data;
+	unsigned int npoints;
+	unsigned int nfeatures;
+	bool invalid;
+} dataset_chunk_t;
+
+/**
+ * @brief Copy the line starting at pos into line (truncated as fgets would) and return the position of the next line.
+ */
+size_t _dataset_getLine(const char *text, size_t pos, size_t last, char *line) {
+	size_t end = pos;
+	size_t len;
+
+	while(end < last && '\n' != text[end])
+		end++;
+
+	len = end - pos;
+	if(len > DATASET_MAX_LINE - 1)
+		len = DATASET_MAX_LINE - 1;
+	memcpy(line, text + pos, len);
+	line[len] = '\0';
+
+	return (end < last)? end + 1 : end;
+}
+
+/**
+ * @brief Count the lines holding at least one token, which are the ones holding points.
+ */
+void *_dataset_countChunk(void *arg) {
+	dataset_chunk_t *chunk = arg;
+	size_t pos;
+	bool hasToken = false;
+
+	chunk->points = 0;
+	for(pos = chunk->first; pos < chunk->last; pos++) {
+		char ch = chunk->text[pos];
+
+		if('\n' == ch) {
+			chunk->points += hasToken;
+			hasToken = false;
+		}
+		else if(' ' != ch && '\t' != ch) {
+			hasToken = true;
+		}
+	}
+	chunk->points += hasToken;
+
+	return NULL;
+}
+
+/**
+ * @brief Parse the points of a chunk, storing them transposed. The identifier of each point is skipped and features are
+ *        converted by atof, as the original text parser did.
+ */
+void *_dataset_parseChunk(void *arg) {
+	dataset_chunk_t *chunk = arg;
+	size_t pos = chunk->first;
+	unsigned int p = chunk->firstPoint;
+	unsigned int f;
+	char line[DATASET_MAX_LINE];
+	char *save;
+
+	while(pos < chunk->last && p < chunk->npoints) {
+		pos = _dataset_getLine(chunk->text, pos, chunk->last, line);
+		if(!strtok_r(line, " \t\n", &save))
+			continue;
+
+		for(f = 0; f < chunk->nfeatures; f++) {
+			char *token = strtok_r(NULL, " ,\t\n", &save);
+
+			if(!token) {
+				chunk->invalid = true;
+				return NULL;
+			}
+			chunk->data[f * chunk->npoints + p] = atof(token);
+		}
+		p++;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Run fn over all chunks. The first chunk runs on the calling thread, as well as any chunk whose thread could not be created.
+ */
+void _dataset_runChunks(void *(*fn)(void *), dataset_chunk_t *chunks, unsigned int chunksLen) {
+	unsigned int t;
+	pthread_t threads[DATASET_MAX_THREADS];
+	bool started[DATASET_MAX_THREADS] = {false};
+
+	for(t = 1; t < chunksLen; t++)
+		started[t] = !pthread_create(&threads[t], NULL, fn, &chunks[t]);
+	fn(&chunks[0]);
+	for(t = 1; t < chunksLen; t++) {
+		if(started[t])
+			pthread_join(threads[t], NULL);
+		else
+			fn(&chunks[t]);
+	}
+}
+
+bool _dataset_convert(dataset_t *dataset, const char *textFile, struct stat *textSt) {
+	unsigned int t, chunksLen, points = 0;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	dataset_chunk_t chunks[DATASET_MAX_THREADS];
+	char *text = NULL;
+	size_t textSz = textSt->st_size;
+	int fd = open(textFile, O_RDONLY);
+	bool valid = false;
+
+	if(-1 == fd) {
+		fprintf(stderr, "Error: %s: %s\n", strerror(errno), textFile);
+		return false;
+	}
+
+	if(textSz) {
+		text = mmap(NULL, textSz, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(MAP_FAILED == text) {
+			fprintf(stderr, "Error: %s: %s\n", strerror(errno), textFile);
+			close(fd);
+			return false;
+		}
+	}
+	close(fd);
+
+	dataset->data = malloc((size_t) dataset->npoints * dataset->nfeatures * sizeof(float));
+	if(!dataset->data) {
+		fprintf(stderr, "Error: %s: %s\n", strerror(errno), textFile);
+		goto _err;
+	}
+
+	/* Text is split in chunks of whole lines, one per thread */
+	chunksLen = textSz / DATASET_MIN_CHUNK;
+	if((cpus > 0) && (chunksLen > (unsigned long) cpus))
+		chunksLen = cpus;
+	if(chunksLen > DATASET_MAX_THREADS)
+		chunksLen = DATASET_MAX_THREADS;
+	if(!chunksLen)
+		chunksLen = 1;
+
+	for(t = 0; t < chunksLen; t++) {
+		chunks[t].text = text;
+		chunks[t].first = t? chunks[t - 1].last : 0;
+		chunks[t].last = (t == chunksLen - 1)? textSz : (textSz * (t + 1)) / chunksLen;
+		while(chunks[t].last < textSz && chunks[t].last > 0 && '\n' != text[chunks[t].last - 1])
+			chunks[t].last++;
+		if(chunks[t].last < chunks[t].first)
+			chunks[t].last = chunks[t].first;
+		chunks[t].data = dataset->data;
+		chunks[t].npoints = dataset->npoints;
+		chunks[t].nfeatures = dataset->nfeatures;
+		chunks[t].invalid = false;
+	}
+
+	/* Points are first counted, so that each chunk knows the index of its first point */
+	_dataset_runChunks(_dataset_countChunk, chunks, chunksLen);
+	for(t = 0; t < chunksLen; t++) {
+		chunks[t].firstPoint = points;
+		points += chunks[t].points;
+	}
+	if(points < dataset->npoints) {
+		fprintf(stderr, "Error: %s holds %u points, %u expected.\n", textFile, points, dataset->npoints);
+		goto _err;
+	}
+
+	_dataset_runChunks(_dataset_parseChunk, chunks, chunksLen);
+	for(t = 0; t < chunksLen; t++) {
+		if(chunks[t].invalid) {
+			fprintf(stderr, "Error: %s holds points with less than %u features.\n", textFile, dataset->nfeatures);
+			goto _err;
+		}
+	}
+
+	valid = true;
+
+_err:
+	if(text)
+		munmap(text, textSz);
+
+	return valid;
+}
+
+bool _dataset_map(dataset_t *dataset, const char *cacheFile, struct stat *textSt) {
+	struct stat st;
+	dataset_header_t *header;
+	int fd = open(cacheFile, O_RDONLY);
+
+	if(-1 == fd)
+		return false;
+
+	if(-1 == fstat(fd, &st) || (size_t) st.st_size != sizeof(dataset_header_t) + (size_t) dataset->npoints * dataset->nfeatures * sizeof(float)) {
+		close(fd);
+		return false;
+	}
+
+	dataset->mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(MAP_FAILED == dataset->mapping) {
+		dataset->mapping = NULL;
+		return false;
+	}
+	dataset->mappingSz = st.st_size;
+
+	/* A cache is only used if it was converted from the current text file */
+	header = dataset->mapping;
+	if(memcmp(header->magic, DATASET_MAGIC, sizeof(header->magic)) || (header->npoints != dataset->npoints) || (header->nfeatures != dataset->nfeatures) ||
+		(header->sourceSize != (long long) textSt->st_size) || (header->sourceMtime != (long long) textSt->st_mtime)) {
+		munmap(dataset->mapping, dataset->mappingSz);
+		dataset->mapping = NULL;
+		return false;
+	}
+
+	dataset->data = (float *) (header + 1);
+	return true;
+}
+
+/**
+ * @brief Store converted features in the cache. Failing to store is not an error, the cache is simply not created.
+ *        Data is first written to a temporary file and then renamed, so that concurrent executions never read partial files.
+ */
+void _dataset_store(dataset_t *dataset, const char *cacheFile, struct stat *textSt) {
+	dataset_header_t header;
+	size_t tmpPathSz = strlen(cacheFile) + 5;
+	char *tmpPath = malloc(tmpPathSz);
+	FILE *tmpFile;
+	bool written;
+
+	if(!tmpPath)
+		return;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, DATASET_MAGIC, sizeof(header.magic));
+	header.npoints = dataset->npoints;
+	header.nfeatures = dataset->nfeatures;
+	header.sourceSize = textSt->st_size;
+	header.sourceMtime = textSt->st_mtime;
+
+	snprintf(tmpPath, tmpPathSz, "%s.tmp", cacheFile);
+	tmpFile = fopen(tmpPath, "wb");
+	if(tmpFile) {
+		written = (1 == fwrite(&header, sizeof(header), 1, tmpFile));
+		written = written && (1 == fwrite(dataset->data, (size_t) dataset->npoints * dataset->nfeatures * sizeof(float), 1, tmpFile));
+		written = !fclose(tmpFile) && written;
+
+		if(!written || rename(tmpPath, cacheFile))
+			remove(tmpPath);
+	}
+
+	free(tmpPath);
+}
+
+dataset_t *dataset_load(const char *textFile, const char *cacheFile, unsigned int npoints, unsigned int nfeatures) {
+	struct stat textSt;
+	dataset_t *dataset = calloc(1, sizeof(dataset_t));
+
+	if(!dataset || -1 == stat(textFile, &textSt)) {
+		fprintf(stderr, "Error: %s: %s\n", strerror(errno), textFile);
+		free(dataset);
+		return NULL;
+	}
+
+	dataset->npoints = npoints;
+	dataset->nfeatures = nfeatures;
+
+	dataset->cached = _dataset_map(dataset, cacheFile, &textSt);
+	if(!dataset->cached) {
+		if(!_dataset_convert(dataset, textFile, &textSt)) {
+			dataset_destroy(&dataset);
+			return NULL;
+		}
+
+		_dataset_store(dataset, cacheFile, &textSt);
+	}
+
+	return dataset;
+}
+
+void dataset_destroy(dataset_t **dataset) {
+	if((*dataset)->mapping)
+		munmap((*dataset)->mapping, (*dataset)->mappingSz);
+	else
+		free((*dataset)->data);
+
+	free(*dataset);
+	*dataset = NULL;
+}
@@ -0,0 +1,209 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+ *            POSTAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+ *            LOOPPREAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size, loopFlag);
+ *            LOOPPOSTAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size, loopFlag);
+ *            CLEANUP(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+ *        and, when running the device-side Lloyd loop description (kern.lloyd.xml):
+ *            LLOYDPREAMBLE(feature, featureSz, clusters, clustersSz, prevMembership, prevMembershipSz, npoints, nclusters, nfeatures, offset, size);
+ *            LLOYDLOOPPOSTAMBLE(delta, loopFlag);
+ *            LLOYDPOSTAMBLE(feature, clusters, membership, npoints, nclusters, nfeatures, delta);
+ *        where:
+ *            feature: variable (float *);
+ *            featureSz: number of members in variable (unsigned int);
+ *            clusters: variable (float *);
+ *            clustersSz: number of members in variable (unsigned int);
+ *            membership: variable (int *);
+ *            membershipSz: number of members in variable (unsigned int);
+ *            npoints: variable (int);
+ *            nclusters: variable (int);
+ *            nfeatures: variable (int);
+ *            offset: variable (int);
+ *            size: variable (int);
+ *            prevMembership: variable (int *);
+ *            prevMembershipSz: number of members in variable (unsigned int);
+ *            delta: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *feature = NULL;
+static unsigned int featureSz = 0;
+static float *clusters = NULL;
+static unsigned int clustersSz = 0;
+static int *membership = NULL;
+static unsigned int membershipSz = 0;
+static int npoints;
+static int nclusters;
+static int nfeatures;
+static int offset;
+static int size;
+
+/* Device-side Lloyd loop description (kern.lloyd.xml) variables */
+static int *prevMembership = NULL;
+static unsigned int prevMembershipSz = 0;
+static float *partialSums = NULL;
+static unsigned int partialSumsSz = 0;
+static int *partialCounts = NULL;
+static unsigned int partialCountsSz = 0;
+static int *partialDeltas = NULL;
+static unsigned int partialDeltasSz = 0;
+static int delta;
+static int ngroups;
+
+/* Work sizes */
+static size_t *globalSizeKmeans_Kernel_C = NULL;
+static size_t *localSizeKmeans_Kernel_C = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(feature),
+	RT_BIND_POINTER(clusters),
+	RT_BIND_POINTER(membership),
+	RT_BIND_VALUE(npoints),
+	RT_BIND_VALUE(nclusters),
+	RT_BIND_VALUE(nfeatures),
+	RT_BIND_VALUE(offset),
+	RT_BIND_VALUE(size),
+	RT_BIND_POINTER(prevMembership),
+	RT_BIND_POINTER(partialSums),
+	RT_BIND_POINTER(partialCounts),
+	RT_BIND_POINTER(partialDeltas),
+	RT_BIND_VALUE(delta),
+	RT_BIND_VALUE(ngroups),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(kmeans_kernel_c, Kmeans_Kernel_C),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	if(prevMembership) {
+		LLOYDPREAMBLE(feature, featureSz, clusters, clustersSz, prevMembership, prevMembershipSz, npoints, nclusters, nfeatures, offset, size);
+	}
+	else {
+		PREAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Centres stay on the device */
+	if(prevMembership)
+		return EXIT_SUCCESS;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	if(prevMembership) {
+		LLOYDLOOPPOSTAMBLE(delta, loopFlag);
+	}
+	else {
+		LOOPPOSTAMBLE(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size, loopFlag);
+	}
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Only the device-side Lloyd loop is validated by a postamble */
+	if(!prevMembership)
+		return rv;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	LLOYDPOSTAMBLE(feature, clusters, membership, npoints, nclusters, nfeatures, delta);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+}
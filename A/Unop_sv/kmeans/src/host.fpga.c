@@ -97,6 +97,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueKmeans_Kernel_C = NULL;
+	cl_command_queue transferQueueKmeans_Kernel_C = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,6 +108,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimKmeans_Kernel_C = 1;
 	size_t globalSizeKmeans_Kernel_C[1] = {
 		30208
@@ -159,7 +161,13 @@ int main(void) {
 
 	/* Create command queue for kmeans_kernel_c kernel */
 	PRINT_STEP("Creating command queue for \"kmeans_kernel_c\"...");
-	queueKmeans_Kernel_C = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueKmeans_Kernel_C = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for kmeans_kernel_c kernel */
+	PRINT_STEP("Creating transfer command queue for \"kmeans_kernel_c\"...");
+	transferQueueKmeans_Kernel_C = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -229,6 +237,13 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (size)"));
 	PRINT_SUCCESS();
 
+	/* Setting loop-invariant input buffers (uploaded only once) */
+	PRINT_STEP("Setting loop-invariant buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueKmeans_Kernel_C, featureK, CL_TRUE, 0, 1020000 * sizeof(float), feature, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "feature"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (featureK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
 		/* Calling loop preamble function */
 		PRINT_STEP("[%d] Calling loop preamble function...", i);
@@ -237,12 +252,8 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueKmeans_Kernel_C, featureK, CL_TRUE, 0, 1020000 * sizeof(float), feature, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (featureK)"));
-		fRet = clEnqueueWriteBuffer(queueKmeans_Kernel_C, clustersK, CL_TRUE, 0, 170 * sizeof(float), clusters, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKmeans_Kernel_C, clustersK, TRANSFER_BLOCKING, 0, 170 * sizeof(float), clusters, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "clusters"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (clustersK)"));
-		fRet = clEnqueueWriteBuffer(queueKmeans_Kernel_C, membershipK, CL_TRUE, 0, 30000 * sizeof(int), membership, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (membershipK)"));
 		fRet = clSetKernelArg(kernelKmeans_Kernel_C, 3, sizeof(int), &npoints);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (npoints)"));
 		fRet = clSetKernelArg(kernelKmeans_Kernel_C, 4, sizeof(int), &nclusters);
@@ -256,8 +267,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueKmeans_Kernel_C);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueKmeans_Kernel_C, kernelKmeans_Kernel_C, workDimKmeans_Kernel_C, NULL, globalSizeKmeans_Kernel_C, localSizeKmeans_Kernel_C, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueKmeans_Kernel_C, kernelKmeans_Kernel_C, workDimKmeans_Kernel_C, NULL, globalSizeKmeans_Kernel_C, localSizeKmeans_Kernel_C, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "kmeans_kernel_c"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueKmeans_Kernel_C);
 		gettimeofday(&tNow, NULL);
@@ -265,9 +277,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueKmeans_Kernel_C, membershipK, CL_TRUE, 0, 30000 * sizeof(int), membership, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueKmeans_Kernel_C, membershipK, TRANSFER_BLOCKING, 0, 30000 * sizeof(int), membership, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "membership"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -282,6 +296,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -290,6 +305,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(featureK)
 		clReleaseMemObject(featureK);
@@ -318,6 +336,8 @@ _err:
 	/* Dealloc queues */
 	if(queueKmeans_Kernel_C)
 		clReleaseCommandQueue(queueKmeans_Kernel_C);
+	if(transferQueueKmeans_Kernel_C)
+		clReleaseCommandQueue(transferQueueKmeans_Kernel_C);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,560 @@
+/* ********************************************************************************************* */
+/* * Out-of-core Streaming Host for K-means                                                    * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2017 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            LOADPREAMBLE(featuresFile, cacheFile, npoints, nclusters, nfeatures);
+ *            STREAMLOOPPOSTAMBLE(clusters, sums, counts, deltas, slots, nclusters, nfeatures, loopFlag);
+ *            CLEANUP(feature, featureSz, clusters, clustersSz, membership, membershipSz, npoints, nclusters, nfeatures, offset, size);
+ *        where:
+ *            featuresFile: text file holding the features (const char *);
+ *            cacheFile: binary cache of the features (const char *);
+ *            clusters: variable (float *);
+ *            sums: per-cluster feature sums of each slot (float *);
+ *            counts: per-cluster point counts of each slot (int *);
+ *            deltas: number of points that changed cluster, for each slot (int *);
+ *            slots: number of slots used (unsigned int);
+ *            npoints: variable (int);
+ *            nclusters: variable (int);
+ *            nfeatures: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/**
+ * @brief Number of slots chunks are streamed through. Each slot has its own buffers and command queue, so that transfers of
+ *        one chunk overlap the kernels of the other.
+ */
+#define STREAM_SLOTS 2
+
+/**
+ * @brief Work-group size of all kernels (WG_SIZE_0 and UPDATE_GROUP_SIZE in kern.cl). Chunks are multiples of it.
+ */
+#define STREAM_GROUP_SIZE 256
+
+/**
+ * @brief Fraction of the device global memory taken by the buffers of all slots, when the chunk size is not given.
+ */
+#define STREAM_MEMORY_FRACTION 0.5
+
+/**
+ * @brief Standard statements for function error handling and printing.
+ *
+ * @param funcName Function name that failed.
+ */
+#define FUNCTION_ERROR_STATEMENTS(funcName) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s failed with return code %d.\n", funcName, fRet);\
+}
+
+/**
+ * @brief Standard statements for POSIX error handling and printing.
+ *
+ * @param arg Arbitrary string to the printed at the end of error string.
+ */
+#define POSIX_ERROR_STATEMENTS(arg) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s: %s\n", strerror(errno), arg);\
+}
+
+/**
+ * @brief Create a buffer, jumping to _err on failure.
+ */
+#define CREATE_BUFFER(buffer, flags, size) {\
+	buffer = clCreateBuffer(context, flags, size, NULL, &fRet);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (" #buffer ")"));\
+}
+
+/**
+ * @brief Set a kernel argument, jumping to _err on failure.
+ */
+#define SET_ARG(kernel, index, type, value) {\
+	fRet = clSetKernelArg(kernel, index, sizeof(type), value);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (" #kernel ", " #value ")"));\
+}
+
+/**
+ * @brief Buffers, kernels and queue of one slot.
+ *        feature holds the chunk column-major (as the whole dataset, with the chunk length as stride), prevMembership is
+ *        uploaded from and downloaded back to the host memberships, sums, counts and delta accumulate over all chunks of the slot.
+ */
+typedef struct {
+	cl_command_queue queue;
+	cl_kernel kernelAssign;
+	cl_kernel kernelPartials;
+	cl_kernel kernelAccumulate;
+	cl_mem featureK;
+	cl_mem membershipK;
+	cl_mem prevMembershipK;
+	cl_mem partialSumsK;
+	cl_mem partialCountsK;
+	cl_mem partialDeltasK;
+	cl_mem sumsK;
+	cl_mem countsK;
+	cl_mem deltaK;
+} stream_slot_t;
+
+/**
+ * @brief Release whatever was created for a slot.
+ *
+ * @param slot Slot to be released.
+ */
+static void releaseSlot(stream_slot_t *slot) {
+	if(slot->featureK)
+		clReleaseMemObject(slot->featureK);
+	if(slot->membershipK)
+		clReleaseMemObject(slot->membershipK);
+	if(slot->prevMembershipK)
+		clReleaseMemObject(slot->prevMembershipK);
+	if(slot->partialSumsK)
+		clReleaseMemObject(slot->partialSumsK);
+	if(slot->partialCountsK)
+		clReleaseMemObject(slot->partialCountsK);
+	if(slot->partialDeltasK)
+		clReleaseMemObject(slot->partialDeltasK);
+	if(slot->sumsK)
+		clReleaseMemObject(slot->sumsK);
+	if(slot->countsK)
+		clReleaseMemObject(slot->countsK);
+	if(slot->deltaK)
+		clReleaseMemObject(slot->deltaK);
+	if(slot->kernelAssign)
+		clReleaseKernel(slot->kernelAssign);
+	if(slot->kernelPartials)
+		clReleaseKernel(slot->kernelPartials);
+	if(slot->kernelAccumulate)
+		clReleaseKernel(slot->kernelAccumulate);
+	if(slot->queue)
+		clReleaseCommandQueue(slot->queue);
+}
+
+int main(int argc, char *argv[]) {
+	/* Return variable */
+	int rv = EXIT_SUCCESS;
+
+	/* OpenCL and aux variables */
+	int i = 0, opt;
+	unsigned int c, s, nchunks, nslots;
+	cl_uint platformsLen, devicesLen;
+	cl_int fRet;
+	cl_platform_id *platforms = NULL;
+	cl_device_id *devices = NULL;
+	cl_context context = NULL;
+	FILE *programFile = NULL;
+	size_t programSz;
+	char *programContent = NULL;
+	cl_program program = NULL;
+	cl_ulong memSize, maxAllocSize;
+	stream_slot_t slots[STREAM_SLOTS];
+	bool loopFlag = false;
+	struct timeval tThen, tNow, tDelta, tExecTime;
+	timerclear(&tExecTime);
+#ifdef STREAM_PROGRAM_BINARY
+	cl_int programRet;
+#else
+	struct timeval tProgramTime;
+	PROGRAM_CACHE_DECLARE(programCache);
+#endif
+	size_t localSize[1] = {STREAM_GROUP_SIZE};
+	size_t globalSize[1];
+
+	/* Dataset and chunking */
+	const char *featuresFile = FEATURES_FILENAME;
+	char cacheFile[FILENAME_MAX];
+	int npoints = 30000;
+	int nclusters = NCLUSTERS;
+	int nfeatures = 34;
+	unsigned int chunk = 0;
+	int offset;
+	int size;
+	int ngroups;
+	int first;
+
+	/* Host side of cluster centres and per-slot accumulators */
+	float *clusters = NULL;
+	cl_mem clustersK = NULL;
+	float *sums = NULL;
+	int *counts = NULL;
+	int *deltas = NULL;
+
+	memset(slots, 0, sizeof(slots));
+
+	/* Parse command line */
+	while((opt = getopt(argc, argv, "f:n:m:c:")) != -1) {
+		switch(opt) {
+			case 'f':
+				featuresFile = optarg;
+				break;
+			case 'n':
+				npoints = strtol(optarg, NULL, 10);
+				break;
+			case 'm':
+				nfeatures = strtol(optarg, NULL, 10);
+				break;
+			case 'c':
+				chunk = strtoul(optarg, NULL, 10);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-f FEATURES -n NPOINTS -m NFEATURES] [-c CHUNK]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	if(npoints < 1 || nfeatures < 1) {
+		fprintf(stderr, "Error: NPOINTS and NFEATURES must be positive.\n");
+		return EXIT_FAILURE;
+	}
+	snprintf(cacheFile, sizeof(cacheFile), "%s.cache", featuresFile);
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	LOADPREAMBLE(featuresFile, cacheFile, npoints, nclusters, nfeatures);
+	clusters = malloc(nclusters * nfeatures * sizeof(float));
+	ASSERT_CALL(clusters, POSIX_ERROR_STATEMENTS("clusters"));
+	memcpy(clusters, gClusters[0], nclusters * nfeatures * sizeof(float));
+	PRINT_SUCCESS();
+
+	/* Get platforms IDs */
+	PRINT_STEP("Getting platforms IDs...");
+	fRet = clGetPlatformIDs(0, NULL, &platformsLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	platforms = malloc(platformsLen * sizeof(cl_platform_id));
+	fRet = clGetPlatformIDs(platformsLen, platforms, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	PRINT_SUCCESS();
+
+	/* Get devices IDs for first platform availble */
+	PRINT_STEP("Getting devices IDs for first platform...");
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, NULL, &devicesLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	devices = malloc(devicesLen * sizeof(cl_device_id));
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devicesLen, devices, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	PRINT_SUCCESS();
+
+	/* Chunk size is derived from device memory, unless given */
+	PRINT_STEP("Choosing chunk size...");
+	fRet = clGetDeviceInfo(devices[0], CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(cl_ulong), &memSize, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));
+	fRet = clGetDeviceInfo(devices[0], CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(cl_ulong), &maxAllocSize, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));
+	if(!chunk) {
+		/* Each point of a chunk takes its features and two memberships */
+		cl_ulong perSlot = (memSize * STREAM_MEMORY_FRACTION) / STREAM_SLOTS;
+		cl_ulong points = perSlot / ((nfeatures + 2) * sizeof(float));
+
+		if(points * nfeatures * sizeof(float) > maxAllocSize)
+			points = maxAllocSize / (nfeatures * sizeof(float));
+		chunk = (points < (cl_ulong) npoints)? points : (cl_ulong) npoints;
+	}
+	if(!chunk)
+		chunk = STREAM_GROUP_SIZE;
+	/* Kernels index the chunk with ints */
+	if((unsigned long long) chunk * nfeatures > 0x7fffffffULL)
+		chunk = 0x7fffffff / nfeatures;
+	chunk = ((chunk + STREAM_GROUP_SIZE - 1) / STREAM_GROUP_SIZE) * STREAM_GROUP_SIZE;
+	if(chunk > (unsigned int) (0x7fffffff / nfeatures))
+		chunk -= STREAM_GROUP_SIZE;
+	nchunks = (npoints + chunk - 1) / chunk;
+	nslots = (nchunks < STREAM_SLOTS)? nchunks : STREAM_SLOTS;
+	PRINT_SUCCESS();
+	printf("Streaming %u chunk(s) of up to %u points (%.3lf MiB of features each) through %u slot(s).\n",
+		nchunks, chunk, (chunk * (double) nfeatures * sizeof(float)) / 1048576.0, nslots);
+
+	/* Create context for first available device */
+	PRINT_STEP("Creating context...");
+	context = clCreateContext(NULL, 1, devices, NULL, NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateContext"));
+	PRINT_SUCCESS();
+
+	/* Create one command queue per slot */
+	PRINT_STEP("Creating command queues...");
+	for(s = 0; s < nslots; s++) {
+		slots[s].queue = clCreateCommandQueue(context, devices[0], 0, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	}
+	PRINT_SUCCESS();
+
+	/* Open program file */
+	PRINT_STEP("Opening program file...");
+#ifdef STREAM_PROGRAM_BINARY
+	programFile = fopen("program.aocx", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("program.aocx"));
+#else
+	programFile = fopen("kern.cl", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("kern.cl"));
+#endif
+	PRINT_SUCCESS();
+
+	/* Get size and read file */
+	PRINT_STEP("Reading program file...");
+	fseek(programFile, 0, SEEK_END);
+	programSz = ftell(programFile);
+	fseek(programFile, 0, SEEK_SET);
+	programContent = malloc(programSz);
+	fread(programContent, programSz, 1, programFile);
+	fclose(programFile);
+	programFile = NULL;
+	PRINT_SUCCESS();
+
+#ifdef STREAM_PROGRAM_BINARY
+	/* Create program from binary file */
+	PRINT_STEP("Creating program from binary...");
+	program = clCreateProgramWithBinary(context, 1, devices, &programSz, (const unsigned char **) &programContent, &programRet, &fRet);
+	ASSERT_CALL(CL_SUCCESS == programRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary (when loading binary)"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary"));
+	PRINT_SUCCESS();
+#else
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
+	PRINT_SUCCESS();
+
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+#endif
+
+	/* Build program */
+	PRINT_STEP("Building program...");
+	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
+	PRINT_SUCCESS();
+
+#ifndef STREAM_PROGRAM_BINARY
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+#endif
+
+	/* Create buffers and kernels. Centres are shared by all slots */
+	PRINT_STEP("Creating buffers and kernels...");
+	ngroups = chunk / STREAM_GROUP_SIZE;
+	CREATE_BUFFER(clustersK, CL_MEM_READ_ONLY, nclusters * nfeatures * sizeof(float));
+	for(s = 0; s < nslots; s++) {
+		stream_slot_t *slot = &slots[s];
+
+		CREATE_BUFFER(slot->featureK, CL_MEM_READ_ONLY, (size_t) chunk * nfeatures * sizeof(float));
+		CREATE_BUFFER(slot->membershipK, CL_MEM_READ_WRITE, chunk * sizeof(int));
+		CREATE_BUFFER(slot->prevMembershipK, CL_MEM_READ_WRITE, chunk * sizeof(int));
+		CREATE_BUFFER(slot->partialSumsK, CL_MEM_READ_WRITE, ngroups * nclusters * nfeatures * sizeof(float));
+		CREATE_BUFFER(slot->partialCountsK, CL_MEM_READ_WRITE, ngroups * nclusters * sizeof(int));
+		CREATE_BUFFER(slot->partialDeltasK, CL_MEM_READ_WRITE, ngroups * sizeof(int));
+		CREATE_BUFFER(slot->sumsK, CL_MEM_READ_WRITE, nclusters * nfeatures * sizeof(float));
+		CREATE_BUFFER(slot->countsK, CL_MEM_READ_WRITE, nclusters * sizeof(int));
+		CREATE_BUFFER(slot->deltaK, CL_MEM_READ_WRITE, sizeof(int));
+
+		slot->kernelAssign = clCreateKernel(program, "kmeans_kernel_c", &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (kmeans_kernel_c)"));
+		slot->kernelPartials = clCreateKernel(program, "kmeans_partials", &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (kmeans_partials)"));
+		slot->kernelAccumulate = clCreateKernel(program, "kmeans_accumulate", &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (kmeans_accumulate)"));
+	}
+	sums = malloc(nslots * nclusters * nfeatures * sizeof(float));
+	ASSERT_CALL(sums, POSIX_ERROR_STATEMENTS("sums"));
+	counts = malloc(nslots * nclusters * sizeof(int));
+	ASSERT_CALL(counts, POSIX_ERROR_STATEMENTS("counts"));
+	deltas = malloc(nslots * sizeof(int));
+	ASSERT_CALL(deltas, POSIX_ERROR_STATEMENTS("deltas"));
+	PRINT_SUCCESS();
+
+	/* Buffer arguments never change, chunk-dependent values are set for every chunk */
+	PRINT_STEP("Setting kernel arguments...");
+	for(s = 0; s < nslots; s++) {
+		stream_slot_t *slot = &slots[s];
+
+		SET_ARG(slot->kernelAssign, 0, cl_mem, &(slot->featureK));
+		SET_ARG(slot->kernelAssign, 1, cl_mem, &clustersK);
+		SET_ARG(slot->kernelAssign, 2, cl_mem, &(slot->membershipK));
+		SET_ARG(slot->kernelAssign, 4, int, &nclusters);
+		SET_ARG(slot->kernelAssign, 5, int, &nfeatures);
+
+		SET_ARG(slot->kernelPartials, 0, cl_mem, &(slot->featureK));
+		SET_ARG(slot->kernelPartials, 1, cl_mem, &(slot->membershipK));
+		SET_ARG(slot->kernelPartials, 2, cl_mem, &(slot->prevMembershipK));
+		SET_ARG(slot->kernelPartials, 3, cl_mem, &(slot->partialSumsK));
+		SET_ARG(slot->kernelPartials, 4, cl_mem, &(slot->partialCountsK));
+		SET_ARG(slot->kernelPartials, 5, cl_mem, &(slot->partialDeltasK));
+		SET_ARG(slot->kernelPartials, 7, int, &nclusters);
+		SET_ARG(slot->kernelPartials, 8, int, &nfeatures);
+
+		SET_ARG(slot->kernelAccumulate, 0, cl_mem, &(slot->partialSumsK));
+		SET_ARG(slot->kernelAccumulate, 1, cl_mem, &(slot->partialCountsK));
+		SET_ARG(slot->kernelAccumulate, 2, cl_mem, &(slot->partialDeltasK));
+		SET_ARG(slot->kernelAccumulate, 3, cl_mem, &(slot->sumsK));
+		SET_ARG(slot->kernelAccumulate, 4, cl_mem, &(slot->countsK));
+		SET_ARG(slot->kernelAccumulate, 5, cl_mem, &(slot->deltaK));
+		SET_ARG(slot->kernelAccumulate, 7, int, &nclusters);
+		SET_ARG(slot->kernelAccumulate, 8, int, &nfeatures);
+	}
+	PRINT_SUCCESS();
+
+	do {
+		PRINT_STEP("[%d] Streaming chunks...", i);
+		gettimeofday(&tThen, NULL);
+
+		/* Centres are written once per iteration; being blocking, every slot sees them */
+		fRet = clEnqueueWriteBuffer(slots[0].queue, clustersK, CL_TRUE, 0, nclusters * nfeatures * sizeof(float), clusters, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (clustersK)"));
+
+		/* Chunks alternate between slots, so that each in-order queue chains transfers and kernels of its own chunks only */
+		for(c = 0; c < nchunks; c++) {
+			stream_slot_t *slot = &slots[c % nslots];
+			size_t bufferOrigin[3] = {0, 0, 0};
+			size_t hostOrigin[3];
+			size_t region[3];
+
+			offset = c * chunk;
+			size = ((npoints - offset) < (int) chunk)? (npoints - offset) : (int) chunk;
+			ngroups = (size + STREAM_GROUP_SIZE - 1) / STREAM_GROUP_SIZE;
+			first = (c < nslots);
+			globalSize[0] = ngroups * STREAM_GROUP_SIZE;
+
+			/* The chunk is the same range of every column of the column-major dataset, packed with its own length as stride */
+			hostOrigin[0] = offset * sizeof(float);
+			hostOrigin[1] = 0;
+			hostOrigin[2] = 0;
+			region[0] = size * sizeof(float);
+			region[1] = nfeatures;
+			region[2] = 1;
+			fRet = clEnqueueWriteBufferRect(slot->queue, slot->featureK, CL_FALSE, bufferOrigin, hostOrigin, region,
+				size * sizeof(float), 0, npoints * sizeof(float), 0, gFeatures->data, 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBufferRect (featureK)"));
+			fRet = clEnqueueWriteBuffer(slot->queue, slot->prevMembershipK, CL_FALSE, 0, size * sizeof(int), &gMembershipOrig[offset], 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (prevMembershipK)"));
+
+			/* As far as the kernels are concerned, the chunk is the whole dataset */
+			SET_ARG(slot->kernelAssign, 3, int, &size);
+			SET_ARG(slot->kernelAssign, 6, int, &offset);
+			SET_ARG(slot->kernelAssign, 7, int, &size);
+			SET_ARG(slot->kernelPartials, 6, int, &size);
+			SET_ARG(slot->kernelAccumulate, 6, int, &ngroups);
+			SET_ARG(slot->kernelAccumulate, 9, int, &first);
+
+			fRet = clEnqueueNDRangeKernel(slot->queue, slot->kernelAssign, 1, NULL, globalSize, localSize, 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (kmeans_kernel_c)"));
+			fRet = clEnqueueNDRangeKernel(slot->queue, slot->kernelPartials, 1, NULL, globalSize, localSize, 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (kmeans_partials)"));
+			fRet = clEnqueueNDRangeKernel(slot->queue, slot->kernelAccumulate, 1, NULL, localSize, localSize, 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (kmeans_accumulate)"));
+
+			/* kmeans_partials leaves the new memberships in prevMembership */
+			fRet = clEnqueueReadBuffer(slot->queue, slot->prevMembershipK, CL_FALSE, 0, size * sizeof(int), &gMembershipOrig[offset], 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (prevMembershipK)"));
+			clFlush(slot->queue);
+		}
+
+		/* Get accumulators of every slot */
+		for(s = 0; s < nslots; s++) {
+			fRet = clEnqueueReadBuffer(slots[s].queue, slots[s].sumsK, CL_FALSE, 0, nclusters * nfeatures * sizeof(float), &sums[s * nclusters * nfeatures], 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (sumsK)"));
+			fRet = clEnqueueReadBuffer(slots[s].queue, slots[s].countsK, CL_FALSE, 0, nclusters * sizeof(int), &counts[s * nclusters], 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (countsK)"));
+			fRet = clEnqueueReadBuffer(slots[s].queue, slots[s].deltaK, CL_FALSE, 0, sizeof(int), &deltas[s], 0, NULL, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (deltaK)"));
+		}
+		for(s = 0; s < nslots; s++)
+			clFinish(slots[s].queue);
+		gettimeofday(&tNow, NULL);
+		PRINT_SUCCESS();
+
+		/* Calling loop postamble function */
+		PRINT_STEP("[%d] Calling loop postamble function...", i);
+		STREAMLOOPPOSTAMBLE(clusters, sums, counts, deltas, nslots, nclusters, nfeatures, loopFlag);
+		PRINT_SUCCESS();
+		timersub(&tNow, &tThen, &tDelta);
+		timeradd(&tExecTime, &tDelta, &tExecTime);
+		i++;
+	} while(loopFlag);
+
+	/* Print profiling results. Streaming overlaps transfers and kernels, so both are accounted */
+	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
+	printf("Elapsed time spent on transfers and kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	if(totalTime)
+		printf("Throughput: %lf points/s (%d per iteration).\n", (npoints * (double) i * 1000000) / totalTime, npoints);
+#ifndef STREAM_PROGRAM_BINARY
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
+#endif
+
+_err:
+
+	/* Pending transfers may still read from the dataset or write to the memberships */
+	for(s = 0; s < STREAM_SLOTS; s++) {
+		if(slots[s].queue)
+			clFinish(slots[s].queue);
+	}
+
+	/* Dealloc slots */
+	for(s = 0; s < STREAM_SLOTS; s++)
+		releaseSlot(&slots[s]);
+	if(clustersK)
+		clReleaseMemObject(clustersK);
+
+	/* Dealloc variables */
+	free(clusters);
+	free(sums);
+	free(counts);
+	free(deltas);
+
+	/* Dealloc program */
+	if(program)
+		clReleaseProgram(program);
+	if(programContent)
+		free(programContent);
+	if(programFile)
+		fclose(programFile);
+
+	/* Last OpenCL variables */
+	if(context)
+		clReleaseContext(context);
+	if(devices)
+		free(devices);
+	if(platforms)
+		free(platforms);
+
+	/* Calling cleanup function */
+	CLEANUP(NULL, 0, clusters, nclusters * nfeatures, gMembershipOrig, npoints, npoints, nclusters, nfeatures, 0, chunk);
+
+	return rv;
+}
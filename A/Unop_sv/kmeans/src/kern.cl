@@ -28,7 +28,23 @@
 #define FLT_MAX 3.40282347e+38
 #endif
 
-__attribute__((reqd_work_group_size(256,1,1)))
+#ifndef WG_SIZE_0
+#define WG_SIZE_0 256
+#endif
+
+// Work-group size of the centroid update kernels (kmeans_partials and
+// kmeans_update)
+#define UPDATE_GROUP_SIZE 256
+
+// When split across devices by the shared runtime, membership only holds the
+// partition of this device, which starts at the global offset
+#ifdef RT_SPLIT
+#define SPLIT_OFFSET get_global_offset(0)
+#else
+#define SPLIT_OFFSET 0
+#endif
+
+__attribute__((reqd_work_group_size(WG_SIZE_0,1,1)))
 __kernel void
 kmeans_kernel_c(__global float  *feature,   
 			  __global float  *clusters,
@@ -63,8 +79,168 @@ kmeans_kernel_c(__global float  *feature,
 				}
 			}
 		  //printf("%d\n", index);
-		  membership[point_id] = index;
+		  membership[point_id - SPLIT_OFFSET] = index;
 		}	
 	
 	return;
 }
+
+// Accumulates the per-cluster feature sums and point counts of the points
+// assigned to this work-group, and counts how many points changed cluster
+// since the previous iteration (prevMembership starts as -1). Sums are
+// stored cluster-major, as in clusters.
+__attribute__((reqd_work_group_size(UPDATE_GROUP_SIZE,1,1)))
+__kernel void kmeans_partials(__global float *feature,
+							  __global int *membership,
+							  __global int *prevMembership,
+							  __global float *partialSums,
+							  __global int *partialCounts,
+							  __global int *partialDeltas,
+							  int npoints,
+							  int nclusters,
+							  int nfeatures) {
+	__local int tile[UPDATE_GROUP_SIZE];
+	__local int changed[UPDATE_GROUP_SIZE];
+	int lid = get_local_id(0);
+	int group = get_group_id(0);
+	int first = group * UPDATE_GROUP_SIZE;
+	int point_id = first + lid;
+	int tileLen = min(UPDATE_GROUP_SIZE, npoints - first);
+
+	if (point_id < npoints) {
+		int index = membership[point_id];
+		changed[lid] = (index != prevMembership[point_id]);
+		prevMembership[point_id] = index;
+		tile[lid] = index;
+	}
+	else {
+		changed[lid] = 0;
+		tile[lid] = -1;
+	}
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	// Each work-item owns one or more (cluster, feature) sums
+	for (int a = lid; a < nclusters * nfeatures; a += UPDATE_GROUP_SIZE) {
+		int c = a / nfeatures;
+		int l = a % nfeatures;
+		float sum = 0;
+
+		for (int p = 0; p < tileLen; p++) {
+			if (tile[p] == c)
+				sum += feature[l * npoints + first + p];
+		}
+		partialSums[group * nclusters * nfeatures + a] = sum;
+	}
+
+	for (int c = lid; c < nclusters; c += UPDATE_GROUP_SIZE) {
+		int count = 0;
+
+		for (int p = 0; p < tileLen; p++)
+			count += (tile[p] == c);
+		partialCounts[group * nclusters + c] = count;
+	}
+
+	for (int s = UPDATE_GROUP_SIZE / 2; s > 0; s >>= 1) {
+		if (lid < s)
+			changed[lid] += changed[lid + s];
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+
+	if (0 == lid)
+		partialDeltas[group] = changed[0];
+}
+
+// Reduces the partials of all ngroups work-groups of kmeans_partials into the
+// new cluster centres (clusters without points keep their centre) and the
+// number of points that changed cluster. Must be launched as a single
+// work-group.
+__attribute__((reqd_work_group_size(UPDATE_GROUP_SIZE,1,1)))
+__kernel void kmeans_update(__global float *partialSums,
+							__global int *partialCounts,
+							__global int *partialDeltas,
+							__global float *clusters,
+							__global int *delta,
+							int ngroups,
+							int nclusters,
+							int nfeatures) {
+	__local int changed[UPDATE_GROUP_SIZE];
+	int lid = get_local_id(0);
+	int sum = 0;
+
+	for (int a = lid; a < nclusters * nfeatures; a += UPDATE_GROUP_SIZE) {
+		int c = a / nfeatures;
+		float total = 0;
+		int count = 0;
+
+		for (int g = 0; g < ngroups; g++) {
+			total += partialSums[g * nclusters * nfeatures + a];
+			count += partialCounts[g * nclusters + c];
+		}
+		if (count > 0)
+			clusters[a] = total / count;
+	}
+
+	for (int g = lid; g < ngroups; g += UPDATE_GROUP_SIZE)
+		sum += partialDeltas[g];
+	changed[lid] = sum;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for (int s = UPDATE_GROUP_SIZE / 2; s > 0; s >>= 1) {
+		if (lid < s)
+			changed[lid] += changed[lid + s];
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+
+	if (0 == lid)
+		*delta = changed[0];
+}
+
+// Adds the partials of the ngroups work-groups of kmeans_partials that
+// processed one chunk of points to the running sums, counts and number of
+// changed points of a streaming slot (assigned instead when first is set).
+// Must be launched as a single work-group.
+__attribute__((reqd_work_group_size(UPDATE_GROUP_SIZE,1,1)))
+__kernel void kmeans_accumulate(__global float *partialSums,
+								__global int *partialCounts,
+								__global int *partialDeltas,
+								__global float *sums,
+								__global int *counts,
+								__global int *delta,
+								int ngroups,
+								int nclusters,
+								int nfeatures,
+								int first) {
+	__local int changed[UPDATE_GROUP_SIZE];
+	int lid = get_local_id(0);
+	int sum = 0;
+
+	for (int a = lid; a < nclusters * nfeatures; a += UPDATE_GROUP_SIZE) {
+		float total = 0;
+
+		for (int g = 0; g < ngroups; g++)
+			total += partialSums[g * nclusters * nfeatures + a];
+		sums[a] = first? total : sums[a] + total;
+	}
+
+	for (int c = lid; c < nclusters; c += UPDATE_GROUP_SIZE) {
+		int count = 0;
+
+		for (int g = 0; g < ngroups; g++)
+			count += partialCounts[g * nclusters + c];
+		counts[c] = first? count : counts[c] + count;
+	}
+
+	for (int g = lid; g < ngroups; g += UPDATE_GROUP_SIZE)
+		sum += partialDeltas[g];
+	changed[lid] = sum;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for (int s = UPDATE_GROUP_SIZE / 2; s > 0; s >>= 1) {
+		if (lid < s)
+			changed[lid] += changed[lid + s];
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+
+	if (0 == lid)
+		*delta = first? changed[0] : *delta + changed[0];
+}
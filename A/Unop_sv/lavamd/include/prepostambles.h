@@ -1,14 +1,13 @@
+#include <math.h>
 #include <stdlib.h>
 #include <time.h>
 
-#define BOXES1D 10
 #define ALPHA 0.5
-#define NUMBER_BOXES BOXES1D * BOXES1D * BOXES1D
 #define NUMBER_PAR_PER_BOX 100
-#define SPACE_ELEM NUMBER_BOXES * NUMBER_PAR_PER_BOX
-#define SPACE_MEM SPACE_ELEM * sizeof(cl_float4)
-#define SPACE_MEM2 SPACE_ELEM * sizeof(float)
-#define BOX_MEM NUMBER_BOXES * sizeof(box_str)
+
+/* Boxes whose forces are recomputed on the host, spread evenly over the cube, and the relative error allowed on them */
+#define CHECKED_BOXES 16
+#define FORCE_EPSILON 1.0e-4
 
 typedef struct {
 	cl_int3 xyz; // unused
@@ -30,14 +29,16 @@ typedef struct {
 		d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz\
 	) {\
 	int _i, _j, _k, _l, _m, _n;\
-	box_str _boxCpu[NUMBER_BOXES];\
+	/* Boxes form a cube, whose side is derived from the number of boxes */\
+	int _boxes1d = (int) round(cbrt(d_dim_gpu_number_boxes));\
+	box_str *_boxCpu = calloc(d_dim_gpu_number_boxes, sizeof(box_str));\
 	int _nh = 0;\
 \
 	d_par_gpu_alpha = ALPHA;\
 \
-	for(_i = 0; _i < BOXES1D; _i++) {\
-		for(_j = 0; _j < BOXES1D; _j++) {\
-			for(_k = 0; _k < BOXES1D; _k++) {\
+	for(_i = 0; _i < _boxes1d; _i++) {\
+		for(_j = 0; _j < _boxes1d; _j++) {\
+			for(_k = 0; _k < _boxes1d; _k++) {\
 				_boxCpu[_nh].xyz.x = _k;\
 				_boxCpu[_nh].xyz.y = _j;\
 				_boxCpu[_nh].xyz.z = _i;\
@@ -49,13 +50,13 @@ typedef struct {
 				for(_l = -1; _l < 2; _l++) {\
 					for(_m = -1; _m < 2; _m++) {\
 						for(_n = -1; _n < 2; _n++) {\
-							if(((_i + _l >= 0 && _j + _m >= 0 && _k + _n >= 0) && (_i + _l < BOXES1D && _j + _m < BOXES1D && _k + _n < BOXES1D)) && !(!_l && !_m && !_n)) {\
+							if(((_i + _l >= 0 && _j + _m >= 0 && _k + _n >= 0) && (_i + _l < _boxes1d && _j + _m < _boxes1d && _k + _n < _boxes1d)) && !(!_l && !_m && !_n)) {\
 								_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.x = _k + _n;\
 								_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.y = _j + _m;\
 								_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.z = _i + _l;\
 								_boxCpu[_nh].nei[_boxCpu[_nh].nn].number =\
-									(_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.z * BOXES1D * BOXES1D) +\
-									(_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.y * BOXES1D) +\
+									(_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.z * _boxes1d * _boxes1d) +\
+									(_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.y * _boxes1d) +\
 									_boxCpu[_nh].nei[_boxCpu[_nh].nn].xyz.x;\
 								_boxCpu[_nh].nei[_boxCpu[_nh].nn].offset =\
 									_boxCpu[_nh].nei[_boxCpu[_nh].nn].number * NUMBER_PAR_PER_BOX;\
@@ -71,27 +72,28 @@ typedef struct {
 		}\
 	}\
 \
-	for(_i = 0; _i < NUMBER_BOXES; _i++) {\
+	for(_i = 0; _i < d_dim_gpu_number_boxes; _i++) {\
 		d_box_gpu_offset[_i] = _boxCpu[_i].offset;\
 		d_box_gpu_nn[_i] = _boxCpu[_i].nn;\
 \
 		for(_j = 0; _j < 26; _j++)\
 			d_box_gpu_nei_number[_i * 26 + _j] = _boxCpu[_i].nei[_j].number;\
 	}\
+	free(_boxCpu);\
 \
 	srand(0);\
 \
-	for(_i = 0; _i < SPACE_ELEM; _i++) {\
+	for(_i = 0; _i < d_rv_gpuSz; _i++) {\
 		d_rv_gpu[_i].w = (rand() % 10 + 1) / 10.0;\
 		d_rv_gpu[_i].x = (rand() % 10 + 1) / 10.0;\
 		d_rv_gpu[_i].y = (rand() % 10 + 1) / 10.0;\
 		d_rv_gpu[_i].z = (rand() % 10 + 1) / 10.0;\
 	}\
 \
-	for(_i = 0; _i < SPACE_ELEM; _i++)\
+	for(_i = 0; _i < d_qv_gpuSz; _i++)\
 		d_qv_gpu[_i] = (rand() % 10 + 1) / 10.0;\
 \
-	for(_i = 0; _i < SPACE_ELEM; _i++) {\
+	for(_i = 0; _i < d_fv_gpuSz; _i++) {\
 		d_fv_gpu[_i].w = 0;\
 		d_fv_gpu[_i].x = 0;\
 		d_fv_gpu[_i].y = 0;\
@@ -103,11 +105,64 @@ typedef struct {
 		d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz,\
 		d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz\
 	) {\
-	int _i;\
+	int _i, _j, _k, _c, _pointer;\
+	long _b, _stride = (d_dim_gpu_number_boxes > CHECKED_BOXES)? d_dim_gpu_number_boxes / CHECKED_BOXES : 1;\
+	double _a2 = 2.0 * d_par_gpu_alpha * d_par_gpu_alpha;\
+	double _r2, _vij, _term[4], _expected[4], _magnitude[4], _got[4], _diff = 0;\
+	cl_float4 *_rA, *_rB;\
 \
 	FILE *_opf = fopen("result", "w");\
-	for(_i = 0; _i < SPACE_ELEM; _i++)\
+	for(_i = 0; _i < d_fv_gpuSz; _i++)\
 		fprintf(_opf, "%.2f, %.2f, %.2f, %.2f\n", d_fv_gpu[_i].w, d_fv_gpu[_i].x, d_fv_gpu[_i].y, d_fv_gpu[_i].z);\
 \
 	fclose(_opf);\
+\
+	/* Validate the particles of a sample of boxes against their forces accumulated in double on the host */\
+	for(_b = 0; _b < d_dim_gpu_number_boxes; _b += _stride) {\
+		for(_i = 0; _i < NUMBER_PAR_PER_BOX; _i++) {\
+			_rA = &d_rv_gpu[d_box_gpu_offset[_b] + _i];\
+			for(_c = 0; _c < 4; _c++) {\
+				_expected[_c] = 0;\
+				_magnitude[_c] = 0;\
+			}\
+\
+			/* Home box first, then its neighbours */\
+			for(_k = 0; _k < 1 + d_box_gpu_nn[_b]; _k++) {\
+				_pointer = _k? d_box_gpu_nei_number[26 * _b + _k - 1] : _b;\
+				for(_j = 0; _j < NUMBER_PAR_PER_BOX; _j++) {\
+					_rB = &d_rv_gpu[d_box_gpu_offset[_pointer] + _j];\
+					_r2 = _rA->w + _rB->w - (_rA->x * (double) _rB->x + _rA->y * (double) _rB->y + _rA->z * (double) _rB->z);\
+					_vij = exp(-_a2 * _r2);\
+					_term[0] = _vij;\
+					_term[1] = 2 * _vij * (_rA->x - (double) _rB->x);\
+					_term[2] = 2 * _vij * (_rA->y - (double) _rB->y);\
+					_term[3] = 2 * _vij * (_rA->z - (double) _rB->z);\
+					for(_c = 0; _c < 4; _c++) {\
+						_term[_c] *= d_qv_gpu[d_box_gpu_offset[_pointer] + _j];\
+						_expected[_c] += _term[_c];\
+						_magnitude[_c] += (_term[_c] < 0)? -_term[_c] : _term[_c];\
+					}\
+				}\
+			}\
+\
+			_got[0] = d_fv_gpu[d_box_gpu_offset[_b] + _i].w;\
+			_got[1] = d_fv_gpu[d_box_gpu_offset[_b] + _i].x;\
+			_got[2] = d_fv_gpu[d_box_gpu_offset[_b] + _i].y;\
+			_got[3] = d_fv_gpu[d_box_gpu_offset[_b] + _i].z;\
+			for(_c = 0; _c < 4; _c++) {\
+				_diff = (_got[_c] > _expected[_c])? _got[_c] - _expected[_c] : _expected[_c] - _got[_c];\
+				if(_diff > FORCE_EPSILON * _magnitude[_c])\
+					break;\
+			}\
+			if(_c < 4)\
+				break;\
+		}\
+		if(_i < NUMBER_PAR_PER_BOX)\
+			break;\
+	}\
+\
+	if(_b < d_dim_gpu_number_boxes)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_b >= d_dim_gpu_number_boxes, printf("Variable d_fv_gpu[%ld]: expected (%f, %f, %f, %f) got (%f, %f, %f, %f).\n", d_box_gpu_offset[_b] + _i,\
+		_expected[0], _expected[1], _expected[2], _expected[3], _got[0], _got[1], _got[2], _got[3]); rv = EXIT_FAILURE);\
 }
@@ -0,0 +1,147 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz);
+ *            POSTAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz);
+ *            LOOPPREAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz, loopFlag);
+ *            LOOPPOSTAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz, loopFlag);
+ *            CLEANUP(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz);
+ *        where:
+ *            d_par_gpu_alpha: variable (float);
+ *            d_dim_gpu_number_boxes: variable (long);
+ *            d_box_gpu_offset: variable (long *);
+ *            d_box_gpu_offsetSz: number of members in variable (unsigned int);
+ *            d_box_gpu_nn: variable (int *);
+ *            d_box_gpu_nnSz: number of members in variable (unsigned int);
+ *            d_box_gpu_nei_number: variable (int *);
+ *            d_box_gpu_nei_numberSz: number of members in variable (unsigned int);
+ *            d_rv_gpu: variable (cl_float4 *);
+ *            d_rv_gpuSz: number of members in variable (unsigned int);
+ *            d_qv_gpu: variable (float *);
+ *            d_qv_gpuSz: number of members in variable (unsigned int);
+ *            d_fv_gpu: variable (cl_float4 *);
+ *            d_fv_gpuSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float d_par_gpu_alpha;
+static long d_dim_gpu_number_boxes;
+static long *d_box_gpu_offset = NULL;
+static unsigned int d_box_gpu_offsetSz = 0;
+static int *d_box_gpu_nn = NULL;
+static unsigned int d_box_gpu_nnSz = 0;
+static int *d_box_gpu_nei_number = NULL;
+static unsigned int d_box_gpu_nei_numberSz = 0;
+static cl_float4 *d_rv_gpu = NULL;
+static unsigned int d_rv_gpuSz = 0;
+static float *d_qv_gpu = NULL;
+static unsigned int d_qv_gpuSz = 0;
+static cl_float4 *d_fv_gpu = NULL;
+static unsigned int d_fv_gpuSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeKernel_Gpu_Opencl = NULL;
+static size_t *localSizeKernel_Gpu_Opencl = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(d_par_gpu_alpha),
+	RT_BIND_VALUE(d_dim_gpu_number_boxes),
+	RT_BIND_POINTER(d_box_gpu_offset),
+	RT_BIND_POINTER(d_box_gpu_nn),
+	RT_BIND_POINTER(d_box_gpu_nei_number),
+	RT_BIND_POINTER(d_rv_gpu),
+	RT_BIND_POINTER(d_qv_gpu),
+	RT_BIND_POINTER(d_fv_gpu),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(kernel_gpu_opencl, Kernel_Gpu_Opencl),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(d_par_gpu_alpha, d_dim_gpu_number_boxes, d_box_gpu_offset, d_box_gpu_offsetSz, d_box_gpu_nn, d_box_gpu_nnSz, d_box_gpu_nei_number, d_box_gpu_nei_numberSz, d_rv_gpu, d_rv_gpuSz, d_qv_gpu, d_qv_gpuSz, d_fv_gpu, d_fv_gpuSz);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
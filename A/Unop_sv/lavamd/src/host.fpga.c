@@ -100,6 +100,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueKernel_Gpu_Opencl = NULL;
+	cl_command_queue transferQueueKernel_Gpu_Opencl = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -110,6 +111,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 8);
 	cl_uint workDimKernel_Gpu_Opencl = 1;
 	size_t globalSizeKernel_Gpu_Opencl[1] = {
 		128000
@@ -165,7 +167,13 @@ int main(void) {
 
 	/* Create command queue for kernel_gpu_opencl kernel */
 	PRINT_STEP("Creating command queue for \"kernel_gpu_opencl\"...");
-	queueKernel_Gpu_Opencl = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueKernel_Gpu_Opencl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for kernel_gpu_opencl kernel */
+	PRINT_STEP("Creating transfer command queue for \"kernel_gpu_opencl\"...");
+	transferQueueKernel_Gpu_Opencl = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -248,23 +256,24 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_par_gpu_alpha)"));
 		fRet = clSetKernelArg(kernelKernel_Gpu_Opencl, 1, sizeof(long), &d_dim_gpu_number_boxes);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_dim_gpu_number_boxes)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_box_gpu_offsetK, CL_TRUE, 0, 1000 * sizeof(long), d_box_gpu_offset, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_box_gpu_offsetK, TRANSFER_BLOCKING, 0, 1000 * sizeof(long), d_box_gpu_offset, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_box_gpu_offset"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_box_gpu_offsetK)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_box_gpu_nnK, CL_TRUE, 0, 1000 * sizeof(int), d_box_gpu_nn, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_box_gpu_nnK, TRANSFER_BLOCKING, 0, 1000 * sizeof(int), d_box_gpu_nn, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_box_gpu_nn"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_box_gpu_nnK)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_box_gpu_nei_numberK, CL_TRUE, 0, 26000 * sizeof(int), d_box_gpu_nei_number, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_box_gpu_nei_numberK, TRANSFER_BLOCKING, 0, 26000 * sizeof(int), d_box_gpu_nei_number, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_box_gpu_nei_number"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_box_gpu_nei_numberK)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_rv_gpuK, CL_TRUE, 0, 100000 * sizeof(cl_float4), d_rv_gpu, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_rv_gpuK, TRANSFER_BLOCKING, 0, 100000 * sizeof(cl_float4), d_rv_gpu, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_rv_gpu"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_rv_gpuK)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_qv_gpuK, CL_TRUE, 0, 100000 * sizeof(float), d_qv_gpu, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_qv_gpuK, TRANSFER_BLOCKING, 0, 100000 * sizeof(float), d_qv_gpu, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_qv_gpu"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_qv_gpuK)"));
-		fRet = clEnqueueWriteBuffer(queueKernel_Gpu_Opencl, d_fv_gpuK, CL_TRUE, 0, 100000 * sizeof(cl_float4), d_fv_gpu, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueKernel_Gpu_Opencl, d_fv_gpuK, TRANSFER_BLOCKING, 0, 100000 * sizeof(cl_float4), d_fv_gpu, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_fv_gpu"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_fv_gpuK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueKernel_Gpu_Opencl);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueKernel_Gpu_Opencl, kernelKernel_Gpu_Opencl, workDimKernel_Gpu_Opencl, NULL, globalSizeKernel_Gpu_Opencl, localSizeKernel_Gpu_Opencl, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueKernel_Gpu_Opencl, kernelKernel_Gpu_Opencl, workDimKernel_Gpu_Opencl, NULL, globalSizeKernel_Gpu_Opencl, localSizeKernel_Gpu_Opencl, ASYNC_WAIT_LIST(profileEvents, 0, 6), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "kernel_gpu_opencl"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueKernel_Gpu_Opencl);
 		gettimeofday(&tNow, NULL);
@@ -272,9 +281,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueKernel_Gpu_Opencl, d_fv_gpuK, CL_TRUE, 0, 100000 * sizeof(cl_float4), d_fv_gpu, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueKernel_Gpu_Opencl, d_fv_gpuK, TRANSFER_BLOCKING, 0, 100000 * sizeof(cl_float4), d_fv_gpu, ASYNC_WAIT_LIST(profileEvents, 6, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_fv_gpu"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 7, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -289,6 +300,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -297,6 +309,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_box_gpu_offsetK)
 		clReleaseMemObject(d_box_gpu_offsetK);
@@ -334,6 +349,8 @@ _err:
 	/* Dealloc queues */
 	if(queueKernel_Gpu_Opencl)
 		clReleaseCommandQueue(queueKernel_Gpu_Opencl);
+	if(transferQueueKernel_Gpu_Opencl)
+		clReleaseCommandQueue(transferQueueKernel_Gpu_Opencl);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -44,6 +44,13 @@ extern "C" {
 
 #define DOT(A,B) ((A.x)*(B.x)+(A.y)*(B.y)+(A.z)*(B.z))	// STABLE
 
+// When split across devices by the shared runtime, d_fv_gpu only holds the particles of the boxes of this device, from the box at the global offset on
+#ifdef RT_SPLIT
+#define SPLIT_FIRST_PARTICLE d_box_gpu_offset[get_global_offset(0) / get_local_size(0)]
+#else
+#define SPLIT_FIRST_PARTICLE 0
+#endif
+
 //========================================================================================================================================================================================================200
 //	kernel_gpu_opencl KERNEL
 //========================================================================================================================================================================================================200
@@ -65,7 +72,7 @@ __kernel void kernel_gpu_opencl(
 	//	THREAD PARAMETERS
 	//--------------------------------------------------------------------------------------------------------------------------------------------------------------------------180
 
-	int bx = get_group_id(0);															// get current horizontal block index (0-n)
+	int bx = get_global_id(0) / get_local_size(0);															// get current horizontal block index (0-n)
 	int tx = get_local_id(0);															// get current horizontal thread index (0-n)
 	int wtx = tx;
 	// (enable the line below only if wanting to use shared memory)
@@ -212,10 +219,10 @@ __kernel void kernel_gpu_opencl(
 					fyij=fs*d.y;
 					d.z = rA_shared[wtx].z  - rB_shared[j].z;
 					fzij=fs*d.z;
-					d_fv_gpu[first_i+wtx].w +=  qB_shared[j]*vij;
-					d_fv_gpu[first_i+wtx].x +=  qB_shared[j]*fxij;
-					d_fv_gpu[first_i+wtx].y +=  qB_shared[j]*fyij;
-					d_fv_gpu[first_i+wtx].z +=  qB_shared[j]*fzij;
+					d_fv_gpu[first_i-SPLIT_FIRST_PARTICLE+wtx].w +=  qB_shared[j]*vij;
+					d_fv_gpu[first_i-SPLIT_FIRST_PARTICLE+wtx].x +=  qB_shared[j]*fxij;
+					d_fv_gpu[first_i-SPLIT_FIRST_PARTICLE+wtx].y +=  qB_shared[j]*fyij;
+					d_fv_gpu[first_i-SPLIT_FIRST_PARTICLE+wtx].z +=  qB_shared[j]*fzij;
 
 				}
 
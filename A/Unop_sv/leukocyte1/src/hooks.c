@@ -0,0 +1,151 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height);
+ *            POSTAMBLE(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height);
+ *            LOOPPREAMBLE(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height, loopFlag);
+ *            LOOPPOSTAMBLE(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height, loopFlag);
+ *            CLEANUP(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height);
+ *        where:
+ *            grad_m: variable (int);
+ *            grad_x: variable (float *);
+ *            grad_xSz: number of members in variable (unsigned int);
+ *            grad_y: variable (float *);
+ *            grad_ySz: number of members in variable (unsigned int);
+ *            c_sin_angle: variable (float *);
+ *            c_sin_angleSz: number of members in variable (unsigned int);
+ *            c_cos_angle: variable (float *);
+ *            c_cos_angleSz: number of members in variable (unsigned int);
+ *            c_tX: variable (int *);
+ *            c_tXSz: number of members in variable (unsigned int);
+ *            c_tY: variable (int *);
+ *            c_tYSz: number of members in variable (unsigned int);
+ *            gicov: variable (float *);
+ *            gicovSz: number of members in variable (unsigned int);
+ *            gicovC: variable (float *);
+ *            gicovCSz: number of members in variable (unsigned int);
+ *            width: variable (int);
+ *            height: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int grad_m;
+static float *grad_x = NULL;
+static unsigned int grad_xSz = 0;
+static float *grad_y = NULL;
+static unsigned int grad_ySz = 0;
+static float *c_sin_angle = NULL;
+static unsigned int c_sin_angleSz = 0;
+static float *c_cos_angle = NULL;
+static unsigned int c_cos_angleSz = 0;
+static int *c_tX = NULL;
+static unsigned int c_tXSz = 0;
+static int *c_tY = NULL;
+static unsigned int c_tYSz = 0;
+static float *gicov = NULL;
+static unsigned int gicovSz = 0;
+static float *gicovC = NULL;
+static unsigned int gicovCSz = 0;
+static int width;
+static int height;
+
+/* Work sizes */
+static size_t *globalSizeGicov_Kernel = NULL;
+static size_t *localSizeGicov_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(grad_m),
+	RT_BIND_POINTER(grad_x),
+	RT_BIND_POINTER(grad_y),
+	RT_BIND_POINTER(c_sin_angle),
+	RT_BIND_POINTER(c_cos_angle),
+	RT_BIND_POINTER(c_tX),
+	RT_BIND_POINTER(c_tY),
+	RT_BIND_POINTER_C(gicov),
+	RT_BIND_VALUE(width),
+	RT_BIND_VALUE(height),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(GICOV_kernel, Gicov_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(grad_m, grad_x, grad_xSz, grad_y, grad_ySz, c_sin_angle, c_sin_angleSz, c_cos_angle, c_cos_angleSz, c_tX, c_tXSz, c_tY, c_tYSz, gicov, gicovSz, gicovC, gicovCSz, width, height);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
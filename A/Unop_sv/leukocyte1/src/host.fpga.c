@@ -105,6 +105,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueGicov_Kernel = NULL;
+	cl_command_queue transferQueueGicov_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -115,6 +116,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 9);
 	cl_uint workDimGicov_Kernel = 1;
 	size_t globalSizeGicov_Kernel[1] = {
 		104448
@@ -175,7 +177,13 @@ int main(void) {
 
 	/* Create command queue for GICOV_kernel kernel */
 	PRINT_STEP("Creating command queue for \"GICOV_kernel\"...");
-	queueGicov_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueGicov_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for GICOV_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"GICOV_kernel\"...");
+	transferQueueGicov_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -262,19 +270,19 @@ int main(void) {
 		PRINT_STEP("[%d] Setting buffers...", i);
 		fRet = clSetKernelArg(kernelGicov_Kernel, 0, sizeof(int), &grad_m);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (grad_m)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, grad_xK, CL_TRUE, 0, 140160 * sizeof(float), grad_x, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, grad_xK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), grad_x, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "grad_x"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (grad_xK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, grad_yK, CL_TRUE, 0, 140160 * sizeof(float), grad_y, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, grad_yK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), grad_y, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "grad_y"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (grad_yK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_sin_angleK, CL_TRUE, 0, 150 * sizeof(float), c_sin_angle, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_sin_angleK, TRANSFER_BLOCKING, 0, 150 * sizeof(float), c_sin_angle, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_sin_angle"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_sin_angleK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_cos_angleK, CL_TRUE, 0, 150 * sizeof(float), c_cos_angle, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_cos_angleK, TRANSFER_BLOCKING, 0, 150 * sizeof(float), c_cos_angle, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_cos_angle"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_cos_angleK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_tXK, CL_TRUE, 0, 1050 * sizeof(int), c_tX, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_tXK, TRANSFER_BLOCKING, 0, 1050 * sizeof(int), c_tX, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_tX"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_tXK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_tYK, CL_TRUE, 0, 1050 * sizeof(int), c_tY, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_tYK, TRANSFER_BLOCKING, 0, 1050 * sizeof(int), c_tY, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_tY"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_tYK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, gicovK, CL_TRUE, 0, 140160 * sizeof(float), gicov, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, gicovK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), gicov, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "gicov"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (gicovK)"));
 		fRet = clSetKernelArg(kernelGicov_Kernel, 8, sizeof(int), &width);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (width)"));
@@ -283,8 +291,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueGicov_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueGicov_Kernel, kernelGicov_Kernel, workDimGicov_Kernel, NULL, globalSizeGicov_Kernel, localSizeGicov_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueGicov_Kernel, kernelGicov_Kernel, workDimGicov_Kernel, NULL, globalSizeGicov_Kernel, localSizeGicov_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 7), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "GICOV_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueGicov_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -292,9 +301,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueGicov_Kernel, gicovK, CL_TRUE, 0, 140160 * sizeof(float), gicov, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueGicov_Kernel, gicovK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), gicov, ASYNC_WAIT_LIST(profileEvents, 7, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "gicov"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 8, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -305,6 +316,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -322,6 +334,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(grad_xK)
 		clReleaseMemObject(grad_xK);
@@ -363,6 +378,8 @@ _err:
 	/* Dealloc queues */
 	if(queueGicov_Kernel)
 		clReleaseCommandQueue(queueGicov_Kernel);
+	if(transferQueueGicov_Kernel)
+		clReleaseCommandQueue(transferQueueGicov_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
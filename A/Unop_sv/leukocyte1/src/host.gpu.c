@@ -105,6 +105,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueGicov_Kernel = NULL;
+	cl_command_queue transferQueueGicov_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -113,8 +114,10 @@ int main(void) {
 	cl_kernel kernelGicov_Kernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 9);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimGicov_Kernel = 1;
 	size_t globalSizeGicov_Kernel[1] = {
 		104448
@@ -175,7 +178,13 @@ int main(void) {
 
 	/* Create command queue for GICOV_kernel kernel */
 	PRINT_STEP("Creating command queue for \"GICOV_kernel\"...");
-	queueGicov_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueGicov_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for GICOV_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"GICOV_kernel\"...");
+	transferQueueGicov_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -196,18 +205,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create GICOV_kernel kernel */
 	PRINT_STEP("Creating kernel \"GICOV_kernel\" from program...");
 	kernelGicov_Kernel = clCreateKernel(program, "GICOV_kernel", &fRet);
@@ -261,19 +283,19 @@ int main(void) {
 		PRINT_STEP("[%d] Setting buffers...", i);
 		fRet = clSetKernelArg(kernelGicov_Kernel, 0, sizeof(int), &grad_m);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (grad_m)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, grad_xK, CL_TRUE, 0, 140160 * sizeof(float), grad_x, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, grad_xK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), grad_x, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "grad_x"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (grad_xK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, grad_yK, CL_TRUE, 0, 140160 * sizeof(float), grad_y, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, grad_yK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), grad_y, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "grad_y"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (grad_yK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_sin_angleK, CL_TRUE, 0, 150 * sizeof(float), c_sin_angle, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_sin_angleK, TRANSFER_BLOCKING, 0, 150 * sizeof(float), c_sin_angle, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_sin_angle"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_sin_angleK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_cos_angleK, CL_TRUE, 0, 150 * sizeof(float), c_cos_angle, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_cos_angleK, TRANSFER_BLOCKING, 0, 150 * sizeof(float), c_cos_angle, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_cos_angle"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_cos_angleK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_tXK, CL_TRUE, 0, 1050 * sizeof(int), c_tX, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_tXK, TRANSFER_BLOCKING, 0, 1050 * sizeof(int), c_tX, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_tX"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_tXK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, c_tYK, CL_TRUE, 0, 1050 * sizeof(int), c_tY, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, c_tYK, TRANSFER_BLOCKING, 0, 1050 * sizeof(int), c_tY, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_tY"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_tYK)"));
-		fRet = clEnqueueWriteBuffer(queueGicov_Kernel, gicovK, CL_TRUE, 0, 140160 * sizeof(float), gicov, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueGicov_Kernel, gicovK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), gicov, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "gicov"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (gicovK)"));
 		fRet = clSetKernelArg(kernelGicov_Kernel, 8, sizeof(int), &width);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (width)"));
@@ -282,8 +304,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueGicov_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueGicov_Kernel, kernelGicov_Kernel, workDimGicov_Kernel, NULL, globalSizeGicov_Kernel, localSizeGicov_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueGicov_Kernel, kernelGicov_Kernel, workDimGicov_Kernel, NULL, globalSizeGicov_Kernel, localSizeGicov_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 7), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "GICOV_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueGicov_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -291,9 +314,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueGicov_Kernel, gicovK, CL_TRUE, 0, 140160 * sizeof(float), gicov, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueGicov_Kernel, gicovK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), gicov, ASYNC_WAIT_LIST(profileEvents, 7, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "gicov"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 8, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -304,6 +329,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -321,6 +348,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(grad_xK)
 		clReleaseMemObject(grad_xK);
@@ -362,6 +392,8 @@ _err:
 	/* Dealloc queues */
 	if(queueGicov_Kernel)
 		clReleaseCommandQueue(queueGicov_Kernel);
+	if(transferQueueGicov_Kernel)
+		clReleaseCommandQueue(transferQueueGicov_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,134 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz);
+ *            POSTAMBLE(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz);
+ *            LOOPPREAMBLE(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz, loopFlag);
+ *            LOOPPOSTAMBLE(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz, loopFlag);
+ *            CLEANUP(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz);
+ *        where:
+ *            img_m: variable (int);
+ *            img_n: variable (int);
+ *            strel_m: variable (int);
+ *            strel_n: variable (int);
+ *            c_strel: variable (float *);
+ *            c_strelSz: number of members in variable (unsigned int);
+ *            img: variable (float *);
+ *            imgSz: number of members in variable (unsigned int);
+ *            dilated: variable (float *);
+ *            dilatedSz: number of members in variable (unsigned int);
+ *            dilatedC: variable (float *);
+ *            dilatedCSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int img_m;
+static int img_n;
+static int strel_m;
+static int strel_n;
+static float *c_strel = NULL;
+static unsigned int c_strelSz = 0;
+static float *img = NULL;
+static unsigned int imgSz = 0;
+static float *dilated = NULL;
+static unsigned int dilatedSz = 0;
+static float *dilatedC = NULL;
+static unsigned int dilatedCSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeDilate_Kernel = NULL;
+static size_t *localSizeDilate_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(img_m),
+	RT_BIND_VALUE(img_n),
+	RT_BIND_VALUE(strel_m),
+	RT_BIND_VALUE(strel_n),
+	RT_BIND_POINTER(c_strel),
+	RT_BIND_POINTER(img),
+	RT_BIND_POINTER_C(dilated),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(dilate_kernel, Dilate_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(img_m, img_n, strel_m, strel_n, c_strel, c_strelSz, img, imgSz, dilated, dilatedSz, dilatedC, dilatedCSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
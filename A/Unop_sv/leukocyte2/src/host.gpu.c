@@ -98,6 +98,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueDilate_Kernel = NULL;
+	cl_command_queue transferQueueDilate_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -106,8 +107,10 @@ int main(void) {
 	cl_kernel kernelDilate_Kernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimDilate_Kernel = 1;
 	size_t globalSizeDilate_Kernel[1] = {
 		140272
@@ -161,7 +164,13 @@ int main(void) {
 
 	/* Create command queue for dilate_kernel kernel */
 	PRINT_STEP("Creating command queue for \"dilate_kernel\"...");
-	queueDilate_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueDilate_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for dilate_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"dilate_kernel\"...");
+	transferQueueDilate_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -182,18 +191,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create dilate_kernel kernel */
 	PRINT_STEP("Creating kernel \"dilate_kernel\" from program...");
 	kernelDilate_Kernel = clCreateKernel(program, "dilate_kernel", &fRet);
@@ -239,17 +261,18 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (strel_m)"));
 		fRet = clSetKernelArg(kernelDilate_Kernel, 3, sizeof(int), &strel_n);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (strel_n)"));
-		fRet = clEnqueueWriteBuffer(queueDilate_Kernel, c_strelK, CL_TRUE, 0, 625 * sizeof(float), c_strel, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDilate_Kernel, c_strelK, TRANSFER_BLOCKING, 0, 625 * sizeof(float), c_strel, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c_strel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (c_strelK)"));
-		fRet = clEnqueueWriteBuffer(queueDilate_Kernel, imgK, CL_TRUE, 0, 140160 * sizeof(float), img, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDilate_Kernel, imgK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), img, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "img"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (imgK)"));
-		fRet = clEnqueueWriteBuffer(queueDilate_Kernel, dilatedK, CL_TRUE, 0, 140160 * sizeof(float), dilated, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDilate_Kernel, dilatedK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), dilated, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "dilated"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dilatedK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueDilate_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueDilate_Kernel, kernelDilate_Kernel, workDimDilate_Kernel, NULL, globalSizeDilate_Kernel, localSizeDilate_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueDilate_Kernel, kernelDilate_Kernel, workDimDilate_Kernel, NULL, globalSizeDilate_Kernel, localSizeDilate_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "dilate_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueDilate_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -257,9 +280,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueDilate_Kernel, dilatedK, CL_TRUE, 0, 140160 * sizeof(float), dilated, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueDilate_Kernel, dilatedK, TRANSFER_BLOCKING, 0, 140160 * sizeof(float), dilated, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "dilated"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -270,6 +295,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -287,6 +314,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(c_strelK)
 		clReleaseMemObject(c_strelK);
@@ -316,6 +346,8 @@ _err:
 	/* Dealloc queues */
 	if(queueDilate_Kernel)
 		clReleaseCommandQueue(queueDilate_Kernel);
+	if(transferQueueDilate_Kernel)
+		clReleaseCommandQueue(transferQueueDilate_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -43,3 +43,82 @@
 	offset += BLOCK_SIZE;\
 }
 #endif
+
+/* Full factorisation description (kern.full.xml): the matrix is generated as in Rodinia's create_matrix, for any multiple of BLOCK_SIZE */
+#define FULLMATRIX(_i, _j) (10 * exp(-0.001 * (((_i) > (_j))? (_i) - (_j) : (_j) - (_i))))
+
+#define FULLPREAMBLE(m, matrix_dim, offset) {\
+	int _i, _j;\
+\
+	ASSERT_CALL((matrix_dim > 0) && !(matrix_dim % BLOCK_SIZE), fprintf(stderr, "Error: matrix dimension %d is not a multiple of %d.\n", matrix_dim, BLOCK_SIZE); rv = EXIT_FAILURE);\
+\
+	for(_i = 0; _i < matrix_dim; _i++)\
+		for(_j = 0; _j < matrix_dim; _j++)\
+			m[_i * matrix_dim + _j] = FULLMATRIX(_i, _j);\
+\
+	offset = 0;\
+\
+	/* We are using another logic to break loop */\
+	loopFlag = true;\
+}
+
+/* The last offset only factorises the diagonal block, so perimeter and internal get a single (idle) work-group */
+#define FULLLOOPPREAMBLE(matrix_dim, offset, loopFlag) {\
+	int _blocks;\
+\
+	if(offset >= matrix_dim)\
+		break;\
+\
+	_blocks = (matrix_dim - offset) / BLOCK_SIZE - 1;\
+	if(!_blocks)\
+		_blocks = 1;\
+	globalSizeLud_Perimeter[0] = BLOCK_SIZE * 2 * _blocks;\
+	globalSizeLud_Internal[0] = BLOCK_SIZE * _blocks;\
+	globalSizeLud_Internal[1] = BLOCK_SIZE * _blocks;\
+}
+
+#define FULLLOOPPOSTAMBLE(matrix_dim, offset, loopFlag) {\
+	offset += BLOCK_SIZE;\
+}
+
+/* Check that L * (U * v) matches M * v within epsilon times |L| * (|U| * |v|), in O(n^2) instead of multiplying L and U */
+#define FULLPOSTAMBLE(m, matrix_dim, epsilon) {\
+	int _i, _j, _invalid = 0;\
+	double *_uv = malloc(matrix_dim * sizeof(double));\
+	double *_uvAbs = malloc(matrix_dim * sizeof(double));\
+	double _luv, _luvAbs, _mv, _diff;\
+\
+	for(_i = 0; _i < matrix_dim; _i++) {\
+		_uv[_i] = _uvAbs[_i] = 0;\
+		for(_j = _i; _j < matrix_dim; _j++) {\
+			_uv[_i] += m[_i * matrix_dim + _j] * (1.0 + _j % 7);\
+			_uvAbs[_i] += fabs(m[_i * matrix_dim + _j]) * (1.0 + _j % 7);\
+		}\
+	}\
+\
+	for(_i = 0; _i < matrix_dim; _i++) {\
+		/* L has an implicit unit diagonal */\
+		_luv = _uv[_i];\
+		_luvAbs = _uvAbs[_i];\
+		_mv = 0;\
+		for(_j = 0; _j < _i; _j++) {\
+			_luv += m[_i * matrix_dim + _j] * _uv[_j];\
+			_luvAbs += fabs(m[_i * matrix_dim + _j]) * _uvAbs[_j];\
+		}\
+		for(_j = 0; _j < matrix_dim; _j++)\
+			_mv += FULLMATRIX(_i, _j) * (1.0 + _j % 7);\
+\
+		_diff = fabs(_luv - _mv);\
+		if(_diff > epsilon * _luvAbs) {\
+			if(!_invalid)\
+				PRINT_FAIL();\
+			if(_invalid < 10)\
+				printf("Row %d: expected %f got %f.\n", _i, _mv, _luv);\
+			_invalid++;\
+		}\
+	}\
+\
+	free(_uv);\
+	free(_uvAbs);\
+	ASSERT_CALL(!_invalid, fprintf(stderr, "Error: %d of %d rows are invalid.\n", _invalid, matrix_dim); rv = EXIT_FAILURE);\
+}
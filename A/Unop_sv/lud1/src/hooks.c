@@ -0,0 +1,173 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(m, mSz, mC, mCSz, matrix_dim, offset);
+ *            POSTAMBLE(m, mSz, mC, mCSz, matrix_dim, offset);
+ *            LOOPPREAMBLE(m, mSz, mC, mCSz, matrix_dim, offset, loopFlag);
+ *            LOOPPOSTAMBLE(m, mSz, mC, mCSz, matrix_dim, offset, loopFlag);
+ *            CLEANUP(m, mSz, mC, mCSz, matrix_dim, offset);
+ *        and, when running the full factorisation description (kern.full.xml):
+ *            FULLPREAMBLE(m, matrix_dim, offset);
+ *            FULLLOOPPREAMBLE(matrix_dim, offset, loopFlag);
+ *            FULLLOOPPOSTAMBLE(matrix_dim, offset, loopFlag);
+ *            FULLPOSTAMBLE(m, matrix_dim, epsilon);
+ *        where:
+ *            m: variable (float *);
+ *            mSz: number of members in variable (unsigned int);
+ *            mC: variable (float *);
+ *            mCSz: number of members in variable (unsigned int);
+ *            matrix_dim: variable (int);
+ *            offset: variable (int);
+ *            epsilon: error accepted relative to |L| * (|U| * |v|) (double);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *m = NULL;
+static unsigned int mSz = 0;
+static float *mC = NULL;
+static unsigned int mCSz = 0;
+static int matrix_dim;
+static int offset;
+
+/* Work sizes */
+static size_t *globalSizeLud_Diagonal = NULL;
+static size_t *localSizeLud_Diagonal = NULL;
+static size_t *globalSizeLud_Perimeter = NULL;
+static size_t *localSizeLud_Perimeter = NULL;
+static size_t *globalSizeLud_Internal = NULL;
+static size_t *localSizeLud_Internal = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(m),
+	RT_BIND_VALUE(matrix_dim),
+	RT_BIND_VALUE(offset),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(lud_diagonal, Lud_Diagonal),
+	RT_NDRANGE(lud_perimeter, Lud_Perimeter),
+	RT_NDRANGE(lud_internal, Lud_Internal),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	if(globalSizeLud_Internal) {
+		FULLPREAMBLE(m, matrix_dim, offset);
+	}
+	else {
+		PREAMBLE(m, mSz, mC, mCSz, matrix_dim, offset);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	if(!globalSizeLud_Internal)
+		return rv;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		FULLLOOPPREAMBLE(matrix_dim, offset, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	if(!globalSizeLud_Internal)
+		return rv;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	FULLLOOPPOSTAMBLE(matrix_dim, offset, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	if(!globalSizeLud_Internal)
+		return rv;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	FULLPOSTAMBLE(m, matrix_dim, 1e-5);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina and others
+ *
+ * Adapted from
+ * rodinia_3.1/opencl/lud/ocl/lud_kernel.cl
+ * Different licensing may apply, please check Rodinia documentation.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// lud_diagonal, lud_perimeter and lud_internal (from lud1, lud2 and lud3),
+// chained over every block offset by kern.full.xml. On the last offset only
+// the diagonal block is left, and the single work-group launched for
+// lud_perimeter and lud_internal returns immediately.
+
+#define BLOCK_SIZE 16
+
+__attribute__((reqd_work_group_size(16,1,1)))
+__kernel void 
+lud_diagonal(__global float *m, 
+			 __local  float *shadow,
+			 int   matrix_dim, 
+			 int   offset)
+{ 
+	int i,j;
+	int tx = get_local_id(0);
+
+	int array_offset = offset*matrix_dim+offset;
+	for(i=0; i < BLOCK_SIZE; i++){
+		shadow[i * BLOCK_SIZE + tx]=m[array_offset + tx];
+		array_offset += matrix_dim;
+	}
+  
+	barrier(CLK_LOCAL_MEM_FENCE);
+  
+	for(i=0; i < BLOCK_SIZE-1; i++) {
+
+    if (tx>i){
+      for(j=0; j < i; j++)
+        shadow[tx * BLOCK_SIZE + i] -= shadow[tx * BLOCK_SIZE + j] * shadow[j * BLOCK_SIZE + i];
+		shadow[tx * BLOCK_SIZE + i] /= shadow[i * BLOCK_SIZE + i];
+    }
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+    if (tx>i){
+
+      for(j=0; j < i+1; j++)
+        shadow[(i+1) * BLOCK_SIZE + tx] -= shadow[(i+1) * BLOCK_SIZE + j]*shadow[j * BLOCK_SIZE + tx];
+    }
+    
+	barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    array_offset = (offset+1)*matrix_dim+offset;
+    for(i=1; i < BLOCK_SIZE; i++){
+      m[array_offset+tx]=shadow[i * BLOCK_SIZE + tx];
+      array_offset += matrix_dim;
+    }
+  
+}
+
+__attribute__((reqd_work_group_size(32,1,1)))
+__kernel void
+lud_perimeter(__global float *m, 
+			  __local  float *dia,
+			  __local  float *peri_row,
+			  __local  float *peri_col,
+			  int matrix_dim, 
+			  int offset)
+{
+    int i,j, array_offset;
+    int idx;
+
+    int  bx = get_group_id(0);	
+    int  tx = get_local_id(0);
+
+    if (offset + BLOCK_SIZE >= matrix_dim)
+      return;
+
+    if (tx < BLOCK_SIZE) {
+      idx = tx;
+      array_offset = offset*matrix_dim+offset;
+      for (i=0; i < BLOCK_SIZE/2; i++){
+      dia[i * BLOCK_SIZE + idx]=m[array_offset+idx];
+      array_offset += matrix_dim;
+      }
+    
+    array_offset = offset*matrix_dim+offset;
+    for (i=0; i < BLOCK_SIZE; i++) {
+      peri_row[i * BLOCK_SIZE+ idx]=m[array_offset+(bx+1)*BLOCK_SIZE+idx];
+      array_offset += matrix_dim;
+    }
+
+    } else {
+    idx = tx-BLOCK_SIZE;
+    
+    array_offset = (offset+BLOCK_SIZE/2)*matrix_dim+offset;
+    for (i=BLOCK_SIZE/2; i < BLOCK_SIZE; i++){
+      dia[i * BLOCK_SIZE + idx]=m[array_offset+idx];
+      array_offset += matrix_dim;
+    }
+    
+    array_offset = (offset+(bx+1)*BLOCK_SIZE)*matrix_dim+offset;
+    for (i=0; i < BLOCK_SIZE; i++) {
+      peri_col[i * BLOCK_SIZE + idx] = m[array_offset+idx];
+      array_offset += matrix_dim;
+    }
+  
+   }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (tx < BLOCK_SIZE) { //peri-row
+     idx=tx;
+      for(i=1; i < BLOCK_SIZE; i++){
+      for (j=0; j < i; j++)
+        peri_row[i * BLOCK_SIZE + idx]-=dia[i * BLOCK_SIZE+ j]*peri_row[j * BLOCK_SIZE + idx];
+    }
+    } else { //peri-col
+     idx=tx - BLOCK_SIZE;
+     for(i=0; i < BLOCK_SIZE; i++){
+      for(j=0; j < i; j++)
+        peri_col[idx * BLOCK_SIZE + i]-=peri_col[idx * BLOCK_SIZE+ j]*dia[j * BLOCK_SIZE + i];
+      peri_col[idx * BLOCK_SIZE + i] /= dia[i * BLOCK_SIZE+ i];
+     }
+   }
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+    
+  if (tx < BLOCK_SIZE) { //peri-row
+    idx=tx;
+    array_offset = (offset+1)*matrix_dim+offset;
+    for(i=1; i < BLOCK_SIZE; i++){
+      m[array_offset+(bx+1)*BLOCK_SIZE+idx] = peri_row[i*BLOCK_SIZE+idx];
+      array_offset += matrix_dim;
+    }
+  } else { //peri-col
+    idx=tx - BLOCK_SIZE;
+    array_offset = (offset+(bx+1)*BLOCK_SIZE)*matrix_dim+offset;
+    for(i=0; i < BLOCK_SIZE; i++){
+      m[array_offset+idx] =  peri_col[i*BLOCK_SIZE+idx];
+      array_offset += matrix_dim;
+    }
+  }
+
+}
+
+__attribute__((reqd_work_group_size(16,16,1)))
+__kernel void
+lud_internal(__global float *m, 
+			 __local  float *peri_row,
+			 __local  float *peri_col,
+			int matrix_dim, 
+			int offset)
+{
+  
+  int  bx = get_group_id(0);	
+  int  by = get_group_id(1);	
+  
+  int  tx = get_local_id(0);
+  int  ty = get_local_id(1);
+
+  int i;
+  float sum;
+
+  if (offset + BLOCK_SIZE >= matrix_dim)
+    return;
+
+  int global_row_id = offset + (by+1)*BLOCK_SIZE;
+  int global_col_id = offset + (bx+1)*BLOCK_SIZE;
+
+  peri_row[ty * BLOCK_SIZE + tx] = m[(offset+ty)*matrix_dim+global_col_id+tx];
+  peri_col[ty * BLOCK_SIZE + tx] = m[(global_row_id+ty)*matrix_dim+offset+tx];
+
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  sum = 0;
+  for (i=0; i < BLOCK_SIZE; i++)
+    sum += peri_col[ty * BLOCK_SIZE + i] * peri_row[i * BLOCK_SIZE + tx];
+  m[(global_row_id+ty)*matrix_dim+global_col_id+tx] -= sum;
+
+
+}
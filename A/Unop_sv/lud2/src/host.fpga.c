@@ -92,6 +92,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueLud_Perimeter = NULL;
+	cl_command_queue transferQueueLud_Perimeter = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -102,6 +103,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 3);
 	cl_uint workDimLud_Perimeter = 3;
 	size_t globalSizeLud_Perimeter[3] = {
 		1984, 1, 1
@@ -149,7 +151,13 @@ int main(void) {
 
 	/* Create command queue for lud_perimeter kernel */
 	PRINT_STEP("Creating command queue for \"lud_perimeter\"...");
-	queueLud_Perimeter = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueLud_Perimeter = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for lud_perimeter kernel */
+	PRINT_STEP("Creating transfer command queue for \"lud_perimeter\"...");
+	transferQueueLud_Perimeter = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -214,7 +222,7 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueLud_Perimeter, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLud_Perimeter, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (mK)"));
 		fRet = clSetKernelArg(kernelLud_Perimeter, 4, sizeof(int), &matrix_dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (matrix_dim)"));
@@ -223,8 +231,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueLud_Perimeter);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueLud_Perimeter, kernelLud_Perimeter, workDimLud_Perimeter, NULL, globalSizeLud_Perimeter, localSizeLud_Perimeter, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueLud_Perimeter, kernelLud_Perimeter, workDimLud_Perimeter, NULL, globalSizeLud_Perimeter, localSizeLud_Perimeter, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "lud_perimeter"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueLud_Perimeter);
 		gettimeofday(&tNow, NULL);
@@ -232,9 +241,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueLud_Perimeter, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueLud_Perimeter, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -245,6 +256,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -262,6 +274,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(mK)
 		clReleaseMemObject(mK);
@@ -285,6 +300,8 @@ _err:
 	/* Dealloc queues */
 	if(queueLud_Perimeter)
 		clReleaseCommandQueue(queueLud_Perimeter);
+	if(transferQueueLud_Perimeter)
+		clReleaseCommandQueue(transferQueueLud_Perimeter);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -92,6 +92,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueLud_Perimeter = NULL;
+	cl_command_queue transferQueueLud_Perimeter = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -100,8 +101,10 @@ int main(void) {
 	cl_kernel kernelLud_Perimeter = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 3);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimLud_Perimeter = 3;
 	size_t globalSizeLud_Perimeter[3] = {
 		1984, 1, 1
@@ -149,7 +152,13 @@ int main(void) {
 
 	/* Create command queue for lud_perimeter kernel */
 	PRINT_STEP("Creating command queue for \"lud_perimeter\"...");
-	queueLud_Perimeter = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueLud_Perimeter = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for lud_perimeter kernel */
+	PRINT_STEP("Creating transfer command queue for \"lud_perimeter\"...");
+	transferQueueLud_Perimeter = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -170,18 +179,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create lud_perimeter kernel */
 	PRINT_STEP("Creating kernel \"lud_perimeter\" from program...");
 	kernelLud_Perimeter = clCreateKernel(program, "lud_perimeter", &fRet);
@@ -213,7 +235,7 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueLud_Perimeter, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLud_Perimeter, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (mK)"));
 		fRet = clSetKernelArg(kernelLud_Perimeter, 4, sizeof(int), &matrix_dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (matrix_dim)"));
@@ -222,8 +244,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueLud_Perimeter);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueLud_Perimeter, kernelLud_Perimeter, workDimLud_Perimeter, NULL, globalSizeLud_Perimeter, localSizeLud_Perimeter, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueLud_Perimeter, kernelLud_Perimeter, workDimLud_Perimeter, NULL, globalSizeLud_Perimeter, localSizeLud_Perimeter, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "lud_perimeter"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueLud_Perimeter);
 		gettimeofday(&tNow, NULL);
@@ -231,9 +254,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueLud_Perimeter, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueLud_Perimeter, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -244,6 +269,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -261,6 +288,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(mK)
 		clReleaseMemObject(mK);
@@ -284,6 +314,8 @@ _err:
 	/* Dealloc queues */
 	if(queueLud_Perimeter)
 		clReleaseCommandQueue(queueLud_Perimeter);
+	if(transferQueueLud_Perimeter)
+		clReleaseCommandQueue(transferQueueLud_Perimeter);
 
 	/* Last OpenCL variables */
 	if(context)
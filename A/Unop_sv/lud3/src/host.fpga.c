@@ -92,6 +92,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueLud_Internal = NULL;
+	cl_command_queue transferQueueLud_Internal = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -102,6 +103,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 3);
 	cl_uint workDimLud_Internal = 3;
 	size_t globalSizeLud_Internal[3] = {
 		992, 992, 1
@@ -149,7 +151,13 @@ int main(void) {
 
 	/* Create command queue for lud_internal kernel */
 	PRINT_STEP("Creating command queue for \"lud_internal\"...");
-	queueLud_Internal = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueLud_Internal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for lud_internal kernel */
+	PRINT_STEP("Creating transfer command queue for \"lud_internal\"...");
+	transferQueueLud_Internal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -212,7 +220,7 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueLud_Internal, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLud_Internal, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (mK)"));
 		fRet = clSetKernelArg(kernelLud_Internal, 3, sizeof(int), &matrix_dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (matrix_dim)"));
@@ -221,8 +229,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueLud_Internal);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueLud_Internal, kernelLud_Internal, workDimLud_Internal, NULL, globalSizeLud_Internal, localSizeLud_Internal, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueLud_Internal, kernelLud_Internal, workDimLud_Internal, NULL, globalSizeLud_Internal, localSizeLud_Internal, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "lud_internal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueLud_Internal);
 		gettimeofday(&tNow, NULL);
@@ -230,9 +239,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueLud_Internal, mK, CL_TRUE, 0, 1048576 * sizeof(float), m, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueLud_Internal, mK, TRANSFER_BLOCKING, 0, 1048576 * sizeof(float), m, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "m"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -243,6 +254,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -260,6 +272,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(mK)
 		clReleaseMemObject(mK);
@@ -283,6 +298,8 @@ _err:
 	/* Dealloc queues */
 	if(queueLud_Internal)
 		clReleaseCommandQueue(queueLud_Internal);
+	if(transferQueueLud_Internal)
+		clReleaseCommandQueue(transferQueueLud_Internal);
 
 	/* Last OpenCL variables */
 	if(context)
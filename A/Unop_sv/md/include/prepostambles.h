@@ -1,11 +1,15 @@
 #include <float.h>
+#include <math.h>
 #include <stdlib.h>
 #include <time.h>
 
-#include "list.h"
-
 #define DOMAIN_EDGE 20.0
 
+/* Cells of the neighbor list builder are never smaller than the cutoff, and there are at most this many per dimension */
+#define CELL_MAX_PER_DIM 64
+
+int *gNeighborCounts = NULL;
+
 float distance(cl_float3 *position, int i, int j) {
 	cl_float3 iPos = position[i];
 	cl_float3 jPos = position[j];
@@ -16,66 +20,200 @@ float distance(cl_float3 *position, int i, int j) {
 	return delX * delX + delY * delY + delZ * delZ;
 }
 
-void insertInOrder(list_t *currDist, list_t *currList, int j, float distIJ, int maxNeighbors) {
-	int i;
-	float currMax = flist_back(currDist);
+void siftDown(float *currDist, int *currList, int currSize, int pos) {
+	float distIJ = currDist[pos];
+	int j = currList[pos];
 
-	if(distIJ > currMax)
-		return;
+	while(2 * pos + 1 < currSize) {
+		int child = 2 * pos + 1;
 
-	for(i = 0; i < flist_size(currDist); i++) {
-		if(distIJ < flist_get(currDist, i)) {
-			flist_insert(currDist, i, distIJ);
-			dlist_insert(currList, i, j);
+		if(child + 1 < currSize && currDist[child + 1] > currDist[child])
+			child++;
+		if(!(currDist[child] > distIJ))
+			break;
 
-			flist_trim(&currDist, maxNeighbors);
-			dlist_trim(&currList, maxNeighbors);
+		currDist[pos] = currDist[child];
+		currList[pos] = currList[child];
+		pos = child;
+	}
 
+	currDist[pos] = distIJ;
+	currList[pos] = j;
+}
+
+/**
+ * @brief Keep the maxNeighbors nearest atoms found so far in a max-heap, farthest atom at the root.
+ */
+void insertNearest(float *currDist, int *currList, int *currSize, int j, float distIJ, int maxNeighbors) {
+	int pos;
+
+	if(*currSize == maxNeighbors) {
+		if(!(distIJ < currDist[0]))
 			return;
-		}
+
+		currDist[0] = distIJ;
+		currList[0] = j;
+		siftDown(currDist, currList, *currSize, 0);
+		return;
+	}
+
+	for(pos = (*currSize)++; pos && currDist[(pos - 1) / 2] < distIJ; pos = (pos - 1) / 2) {
+		currDist[pos] = currDist[(pos - 1) / 2];
+		currList[pos] = currList[(pos - 1) / 2];
+	}
+	currDist[pos] = distIJ;
+	currList[pos] = j;
+}
+
+/**
+ * @brief Sort the heap in place, nearest atom first.
+ */
+void sortNearest(float *currDist, int *currList, int currSize) {
+	int last;
+
+	for(last = currSize - 1; last > 0; last--) {
+		float tmpDist = currDist[0];
+		int tmpList = currList[0];
+
+		currDist[0] = currDist[last];
+		currList[0] = currList[last];
+		currDist[last] = tmpDist;
+		currList[last] = tmpList;
+		siftDown(currDist, currList, last, 0);
 	}
 }
 
-int populateNeighborList(list_t *currDist, list_t *currList, int i, int nAtom, int *neighborList, float cutsq) {
+int populateNeighborList(float *currDist, int *currList, int currSize, int i, int nAtom, int *neighborList, int maxNeighbors, float cutsq) {
 	int idx;
 	int validPairs = 0;
 
-	for(idx = 0; idx < dlist_size(currList); idx++) {
-		neighborList[(idx * nAtom) + i] = dlist_get(currList, idx);
+	for(idx = 0; idx < maxNeighbors; idx++) {
+		neighborList[(idx * nAtom) + i] = (idx < currSize)? currList[idx] : -1;
 
-		if(flist_get(currDist, idx) < cutsq)
+		if(idx < currSize && currDist[idx] < cutsq)
 			validPairs++;
 	}
 
 	return validPairs;
 }
 
-int buildNeighborList(int nAtom, cl_float3 *position, int *neighborList, int maxNeighbors, float cutsq) {
-	int i, j;
+int cellCoord(float x, float origin, float edge, int dim) {
+	int c = (int) ((x - origin) / edge);
+
+	return (c < 0)? 0 : ((c >= dim)? dim - 1 : c);
+}
+
+/**
+ * @brief Build the list of the maxNeighbors nearest atoms of every atom, stored column-wise as read by compute_lj_force.
+ *        Atoms are binned into cells with edge no smaller than the cutoff, so that every pair within the cutoff is found in
+ *        the 27 cells around an atom. Entries beyond the cutoff do not contribute to the force and only pad the list with
+ *        the nearest atoms of these cells, or of all atoms if the surrounding cells have less than maxNeighbors atoms.
+ *        Atoms are processed in parallel if OpenMP is enabled. The number of neighbors within the cutoff of each atom is
+ *        stored in counts, if not NULL.
+ */
+int buildNeighborList(int nAtom, cl_float3 *position, int *neighborList, int maxNeighbors, float cutsq, int *counts) {
+	int i, d;
 	int totalPairs = 0;
+	float lo[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+	float hi[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+	float edge[3];
+	int dim[3];
+	int nCells;
+	int *cellStart;
+	int *cellAtoms;
+	int *cellOf;
 
 	for(i = 0; i < nAtom; i++) {
-		list_t *currList = dlist_create();
-		list_t *currDist = flist_create();
-		for(j = 0; j < maxNeighbors; j++) {
-			dlist_pushBack(currList, -1);
-			flist_pushBack(currDist, DBL_MAX);
+		float p[3] = {position[i].x, position[i].y, position[i].z};
+
+		for(d = 0; d < 3; d++) {
+			lo[d] = (p[d] < lo[d])? p[d] : lo[d];
+			hi[d] = (p[d] > hi[d])? p[d] : hi[d];
 		}
+	}
 
-		for(j = 0; j < nAtom; j++) {
-			if(i == j)
-				continue;
+	for(d = 0; d < 3; d++) {
+		float extent = hi[d] - lo[d];
+		float cutoff = sqrtf(cutsq);
 
-			float distIJ = distance(position, i, j);
-			insertInOrder(currDist, currList, j, distIJ, maxNeighbors);
-		}
+		dim[d] = (cutoff > 0 && extent > cutoff)? (int) (extent / cutoff) : 1;
+		if(dim[d] > CELL_MAX_PER_DIM)
+			dim[d] = CELL_MAX_PER_DIM;
+		edge[d] = (extent > 0)? extent / dim[d] : 1;
+	}
+	nCells = dim[0] * dim[1] * dim[2];
+
+	/* Counting sort of atoms by cell */
+	cellStart = calloc(nCells + 1, sizeof(int));
+	cellAtoms = malloc(nAtom * sizeof(int));
+	cellOf = malloc(nAtom * sizeof(int));
+	for(i = 0; i < nAtom; i++) {
+		cellOf[i] = (cellCoord(position[i].z, lo[2], edge[2], dim[2]) * dim[1] + cellCoord(position[i].y, lo[1], edge[1], dim[1])) * dim[0] +
+			cellCoord(position[i].x, lo[0], edge[0], dim[0]);
+		cellStart[cellOf[i] + 1]++;
+	}
+	for(i = 0; i < nCells; i++)
+		cellStart[i + 1] += cellStart[i];
+	for(i = 0; i < nAtom; i++)
+		cellAtoms[cellStart[cellOf[i]]++] = i;
+	for(i = nCells; i > 0; i--)
+		cellStart[i] = cellStart[i - 1];
+	cellStart[0] = 0;
+
+#pragma omp parallel private(i) reduction(+: totalPairs)
+	{
+		float *currDist = malloc(maxNeighbors * sizeof(float));
+		int *currList = malloc(maxNeighbors * sizeof(int));
+
+#pragma omp for schedule(dynamic, 64)
+		for(i = 0; i < nAtom; i++) {
+			int currSize = 0;
+			int cx = cellOf[i] % dim[0];
+			int cy = (cellOf[i] / dim[0]) % dim[1];
+			int cz = cellOf[i] / (dim[0] * dim[1]);
+			int x, y, z, c, j, pass, validPairs;
+
+			/* Pairs within cutoff first, so that most candidates are rejected before sorting. Out of cutoff pairs only pad the list */
+			for(pass = 0; pass < 2 && currSize < maxNeighbors; pass++) {
+				for(z = (cz? cz - 1 : 0); z <= cz + 1 && z < dim[2]; z++) {
+					for(y = (cy? cy - 1 : 0); y <= cy + 1 && y < dim[1]; y++) {
+						for(x = (cx? cx - 1 : 0); x <= cx + 1 && x < dim[0]; x++) {
+							c = (z * dim[1] + y) * dim[0] + x;
+							for(j = cellStart[c]; j < cellStart[c + 1]; j++) {
+								float distIJ = distance(position, i, cellAtoms[j]);
 
-		totalPairs += populateNeighborList(currDist, currList, i, nAtom, neighborList, cutsq);
+								if(cellAtoms[j] != i && (distIJ < cutsq) == !pass)
+									insertNearest(currDist, currList, &currSize, cellAtoms[j], distIJ, maxNeighbors);
+							}
+						}
+					}
+				}
+			}
 
-		dlist_destroy(&currList);
-		flist_destroy(&currDist);
+			/* Not enough atoms around, the remaining (out of cutoff) entries come from the whole domain */
+			if(currSize < maxNeighbors && currSize < nAtom - 1) {
+				currSize = 0;
+				for(j = 0; j < nAtom; j++) {
+					if(j != i)
+						insertNearest(currDist, currList, &currSize, j, distance(position, i, j), maxNeighbors);
+				}
+			}
+
+			sortNearest(currDist, currList, currSize);
+			validPairs = populateNeighborList(currDist, currList, currSize, i, nAtom, neighborList, maxNeighbors, cutsq);
+			if(counts)
+				counts[i] = validPairs;
+			totalPairs += validPairs;
+		}
+
+		free(currDist);
+		free(currList);
 	}
 
+	free(cellStart);
+	free(cellAtoms);
+	free(cellOf);
+
 	return totalPairs;
 }
 
@@ -95,19 +233,30 @@ int buildNeighborList(int nAtom, cl_float3 *position, int *neighborList, int max
 		forceC[_i].z = 0;\
 	}\
 \
-	buildNeighborList(nAtom, position, neighborList, maxNeighbors, cutsq);\
+	gNeighborCounts = malloc(nAtom * sizeof(int));\
+	ASSERT_CALL(gNeighborCounts, fprintf(stderr, "Error: %s: %s\n", strerror(errno), "gNeighborCounts"); rv = EXIT_FAILURE);\
+	buildNeighborList(nAtom, position, neighborList, maxNeighbors, cutsq, gNeighborCounts);\
 }
 
 #define POSTAMBLE(force, forceSz, forceC, forceCSz,\
 	position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom) {\
 	int _i, _j;\
+	int _mismatches = 0;\
 \
 	for(_i = 0; _i < nAtom; _i++) {\
 		cl_float3 _iPos = position[_i];\
-		cl_float3 _f = {0, 0, 0};\
+		cl_float3 _f = {{0, 0, 0}};\
+		int _count = 0;\
+		bool _valid = true;\
 \
 		for(_j = 0; _j < maxNeighbors; _j++) {\
 			int _jIdx = neighborList[_j * nAtom + _i];\
+			if(_jIdx < 0 || _jIdx >= nAtom || _jIdx == _i) {\
+				/* Lists are only padded with -1 when there are not enough atoms */\
+				if(_jIdx != -1 || _j < nAtom - 1)\
+					_valid = false;\
+				continue;\
+			}\
 			cl_float3 _jPos = position[_jIdx];\
 \
 			float _delX = _iPos.x - _jPos.x;\
@@ -117,6 +266,7 @@ int buildNeighborList(int nAtom, cl_float3 *position, int *neighborList, int max
 			float _r2Inv = _delX * _delX + _delY * _delY + _delZ * _delZ;\
 \
 			if(_r2Inv < cutsq) {\
+				_count++;\
 				_r2Inv = 1.0 / _r2Inv;\
 				float _r6Inv = _r2Inv * _r2Inv * _r2Inv;\
 				float _force = _r2Inv * _r6Inv * (lj1 * _r6Inv - lj2);\
@@ -131,5 +281,20 @@ int buildNeighborList(int nAtom, cl_float3 *position, int *neighborList, int max
 		force[_i].x = (force[_i].x - _f.x) / force[_i].x;\
 		force[_i].y = (force[_i].y - _f.y) / force[_i].y;\
 		force[_i].z = (force[_i].z - _f.z) / force[_i].z;\
+\
+		/* Neighbor list may have been built on device: it must have the same pairs within cutoff as the host one */\
+		if(!_valid || _count != gNeighborCounts[_i])\
+			_mismatches++;\
 	}\
+\
+	if(_mismatches)\
+		PRINT_FAIL();\
+	ASSERT_CALL(!_mismatches, fprintf(stderr, "Neighbor list mismatch for %d atom(s).\n", _mismatches); rv = EXIT_FAILURE);\
+}
+
+/* Host neighbor counts are kept until the end, so that they are released even if the execution fails before POSTAMBLE */
+#define CLEANUP(force, forceSz, forceC, forceCSz,\
+	position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom) {\
+	free(gNeighborCounts);\
+	gNeighborCounts = NULL;\
 }
@@ -0,0 +1,148 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+ *            POSTAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+ *            LOOPPREAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom, loopFlag);
+ *            LOOPPOSTAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom, loopFlag);
+ *            CLEANUP(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+ *        where:
+ *            force: variable (cl_float3 *);
+ *            forceSz: number of members in variable (unsigned int);
+ *            forceC: variable (cl_float3 *);
+ *            forceCSz: number of members in variable (unsigned int);
+ *            position: variable (cl_float3 *);
+ *            positionSz: number of members in variable (unsigned int);
+ *            maxNeighbors: variable (int);
+ *            neighborList: variable (int *);
+ *            neighborListSz: number of members in variable (unsigned int);
+ *            cutsq: variable (float);
+ *            lj1: variable (float);
+ *            lj2: variable (float);
+ *            nAtom: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static cl_float3 *force = NULL;
+static unsigned int forceSz = 0;
+static cl_float3 *forceC = NULL;
+static unsigned int forceCSz = 0;
+static cl_float3 *position = NULL;
+static unsigned int positionSz = 0;
+static int maxNeighbors;
+static int *neighborList = NULL;
+static unsigned int neighborListSz = 0;
+static float cutsq;
+static float lj1;
+static float lj2;
+static int nAtom;
+
+/* Work sizes */
+static size_t *globalSizeCompute_Lj_Force = NULL;
+static size_t *localSizeCompute_Lj_Force = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(force),
+	RT_BIND_POINTER(position),
+	RT_BIND_VALUE(maxNeighbors),
+	RT_BIND_POINTER(neighborList),
+	RT_BIND_VALUE(cutsq),
+	RT_BIND_VALUE(lj1),
+	RT_BIND_VALUE(lj2),
+	RT_BIND_VALUE(nAtom),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(compute_lj_force, Compute_Lj_Force),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(force, forceSz, forceC, forceCSz, position, positionSz, maxNeighbors, neighborList, neighborListSz, cutsq, lj1, lj2, nAtom);
+}
@@ -99,6 +99,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueCompute_Lj_Force = NULL;
+	cl_command_queue transferQueueCompute_Lj_Force = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,6 +110,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimCompute_Lj_Force = 1;
 	size_t globalSizeCompute_Lj_Force[1] = {
 		12288
@@ -163,7 +165,13 @@ int main(void) {
 
 	/* Create command queue for compute_lj_force kernel */
 	PRINT_STEP("Creating command queue for \"compute_lj_force\"...");
-	queueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for compute_lj_force kernel */
+	PRINT_STEP("Creating transfer command queue for \"compute_lj_force\"...");
+	transferQueueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -236,13 +244,13 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, forceK, CL_TRUE, 0, 12288 * sizeof(cl_float3), force, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, forceK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), force, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (forceK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, positionK, CL_TRUE, 0, 12288 * sizeof(cl_float3), position, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, positionK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), position, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "position"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (positionK)"));
 		fRet = clSetKernelArg(kernelCompute_Lj_Force, 2, sizeof(int), &maxNeighbors);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (maxNeighbors)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, neighborListK, CL_TRUE, 0, 1572864 * sizeof(int), neighborList, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, neighborListK, TRANSFER_BLOCKING, 0, 1572864 * sizeof(int), neighborList, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "neighborList"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (neighborListK)"));
 		fRet = clSetKernelArg(kernelCompute_Lj_Force, 4, sizeof(float), &cutsq);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cutsq)"));
@@ -255,8 +263,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueCompute_Lj_Force);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueCompute_Lj_Force, kernelCompute_Lj_Force, workDimCompute_Lj_Force, NULL, globalSizeCompute_Lj_Force, localSizeCompute_Lj_Force, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueCompute_Lj_Force, kernelCompute_Lj_Force, workDimCompute_Lj_Force, NULL, globalSizeCompute_Lj_Force, localSizeCompute_Lj_Force, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "compute_lj_force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueCompute_Lj_Force);
 		gettimeofday(&tNow, NULL);
@@ -264,9 +273,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueCompute_Lj_Force, forceK, CL_TRUE, 0, 12288 * sizeof(cl_float3), force, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueCompute_Lj_Force, forceK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), force, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -281,6 +292,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -300,6 +312,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(forceK)
 		clReleaseMemObject(forceK);
@@ -329,6 +344,8 @@ _err:
 	/* Dealloc queues */
 	if(queueCompute_Lj_Force)
 		clReleaseCommandQueue(queueCompute_Lj_Force);
+	if(transferQueueCompute_Lj_Force)
+		clReleaseCommandQueue(transferQueueCompute_Lj_Force);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -338,6 +355,8 @@ _err:
 	if(platforms)
 		free(platforms);
 
+	/* Calling cleanup function */
+	CLEANUP(force, 12288, forceC, 12288, position, 12288, maxNeighbors, neighborList, 1572864, cutsq, lj1, lj2, nAtom);
 
 	return rv;
 }
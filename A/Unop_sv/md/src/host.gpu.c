@@ -99,6 +99,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueCompute_Lj_Force = NULL;
+	cl_command_queue transferQueueCompute_Lj_Force = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,8 +108,10 @@ int main(void) {
 	cl_kernel kernelCompute_Lj_Force = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimCompute_Lj_Force = 1;
 	size_t globalSizeCompute_Lj_Force[1] = {
 		12288
@@ -163,7 +166,13 @@ int main(void) {
 
 	/* Create command queue for compute_lj_force kernel */
 	PRINT_STEP("Creating command queue for \"compute_lj_force\"...");
-	queueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for compute_lj_force kernel */
+	PRINT_STEP("Creating transfer command queue for \"compute_lj_force\"...");
+	transferQueueCompute_Lj_Force = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -184,18 +193,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create compute_lj_force kernel */
 	PRINT_STEP("Creating kernel \"compute_lj_force\" from program...");
 	kernelCompute_Lj_Force = clCreateKernel(program, "compute_lj_force", &fRet);
@@ -235,13 +257,13 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, forceK, CL_TRUE, 0, 12288 * sizeof(cl_float3), force, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, forceK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), force, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (forceK)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, positionK, CL_TRUE, 0, 12288 * sizeof(cl_float3), position, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, positionK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), position, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "position"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (positionK)"));
 		fRet = clSetKernelArg(kernelCompute_Lj_Force, 2, sizeof(int), &maxNeighbors);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (maxNeighbors)"));
-		fRet = clEnqueueWriteBuffer(queueCompute_Lj_Force, neighborListK, CL_TRUE, 0, 1572864 * sizeof(int), neighborList, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCompute_Lj_Force, neighborListK, TRANSFER_BLOCKING, 0, 1572864 * sizeof(int), neighborList, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "neighborList"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (neighborListK)"));
 		fRet = clSetKernelArg(kernelCompute_Lj_Force, 4, sizeof(float), &cutsq);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cutsq)"));
@@ -254,8 +276,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueCompute_Lj_Force);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueCompute_Lj_Force, kernelCompute_Lj_Force, workDimCompute_Lj_Force, NULL, globalSizeCompute_Lj_Force, localSizeCompute_Lj_Force, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueCompute_Lj_Force, kernelCompute_Lj_Force, workDimCompute_Lj_Force, NULL, globalSizeCompute_Lj_Force, localSizeCompute_Lj_Force, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "compute_lj_force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueCompute_Lj_Force);
 		gettimeofday(&tNow, NULL);
@@ -263,9 +286,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueCompute_Lj_Force, forceK, CL_TRUE, 0, 12288 * sizeof(cl_float3), force, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueCompute_Lj_Force, forceK, TRANSFER_BLOCKING, 0, 12288 * sizeof(cl_float3), force, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "force"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -280,6 +305,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -299,6 +326,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(forceK)
 		clReleaseMemObject(forceK);
@@ -328,6 +358,8 @@ _err:
 	/* Dealloc queues */
 	if(queueCompute_Lj_Force)
 		clReleaseCommandQueue(queueCompute_Lj_Force);
+	if(transferQueueCompute_Lj_Force)
+		clReleaseCommandQueue(transferQueueCompute_Lj_Force);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -337,6 +369,8 @@ _err:
 	if(platforms)
 		free(platforms);
 
+	/* Calling cleanup function */
+	CLEANUP(force, 12288, forceC, 12288, position, 12288, maxNeighbors, neighborList, 1572864, cutsq, lj1, lj2, nAtom);
 
 	return rv;
 }
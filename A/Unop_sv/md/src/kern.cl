@@ -73,3 +73,70 @@ __kernel void compute_lj_force(__global FORCEVECTYPE *force,
     // store the results
     force[idx] = f;
 }
+
+#ifndef MAX_NEIGHBORS
+#define MAX_NEIGHBORS 128
+#endif
+
+#define NLIST_TILE 128
+
+// Builds the list of the neighCount (up to MAX_NEIGHBORS) nearest atoms of each
+// atom, stored column-wise as read by compute_lj_force. Positions are staged
+// through local memory one tile at a time, and each work-item keeps its
+// current nearest atoms sorted by distance in private memory.
+__attribute__((reqd_work_group_size(NLIST_TILE,1,1)))
+__kernel void build_neighbor_list(__global POSVECTYPE *position,
+                                  const int neighCount,
+                                  __global int* neighList,
+                                  const int inum)
+{
+    __local POSVECTYPE tile[NLIST_TILE];
+    FPTYPE dist[MAX_NEIGHBORS];
+    int list[MAX_NEIGHBORS];
+
+    uint idx = get_global_id(0);
+    uint lid = get_local_id(0);
+    int maxCount = (neighCount < MAX_NEIGHBORS) ? neighCount : MAX_NEIGHBORS;
+    int count = 0;
+
+    POSVECTYPE ipos = position[idx];
+
+    for (int base = 0; base < inum; base += NLIST_TILE)
+    {
+        if (base + lid < inum)
+            tile[lid] = position[base + lid];
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (int t = 0; t < NLIST_TILE && base + t < inum; t++)
+        {
+            int jidx = base + t;
+            if (jidx == idx)
+                continue;
+
+            POSVECTYPE jpos = tile[t];
+            FPTYPE delx = ipos.x - jpos.x;
+            FPTYPE dely = ipos.y - jpos.y;
+            FPTYPE delz = ipos.z - jpos.z;
+            FPTYPE r2 = delx*delx + dely*dely + delz*delz;
+
+            // Full list and farther than the current farthest
+            if (count == maxCount && !(r2 < dist[maxCount - 1]))
+                continue;
+
+            // Sorted insertion, equal distances kept in scan order
+            int pos = (count < maxCount) ? count++ : maxCount - 1;
+            while (pos > 0 && r2 < dist[pos - 1])
+            {
+                dist[pos] = dist[pos - 1];
+                list[pos] = list[pos - 1];
+                pos--;
+            }
+            dist[pos] = r2;
+            list[pos] = jidx;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    for (int j = 0; j < neighCount; j++)
+        neighList[j*inum + idx] = (j < count) ? list[j] : -1;
+}
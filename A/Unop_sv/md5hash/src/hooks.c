@@ -0,0 +1,149 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz);
+ *            POSTAMBLE(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz);
+ *            LOOPPREAMBLE(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz, loopFlag);
+ *            LOOPPOSTAMBLE(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz, loopFlag);
+ *            CLEANUP(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz);
+ *        where:
+ *            searchDigest0: variable (unsigned int);
+ *            searchDigest1: variable (unsigned int);
+ *            searchDigest2: variable (unsigned int);
+ *            searchDigest3: variable (unsigned int);
+ *            keyspace: variable (int);
+ *            byteLength: variable (int);
+ *            valsPerByte: variable (int);
+ *            foundIndex: variable (int *);
+ *            foundIndexC: variable (int *);
+ *            foundKey: variable (unsigned char *);
+ *            foundKeySz: number of members in variable (unsigned int);
+ *            foundKeyC: variable (unsigned char *);
+ *            foundKeyCSz: number of members in variable (unsigned int);
+ *            foundDigest: variable (unsigned int *);
+ *            foundDigestSz: number of members in variable (unsigned int);
+ *            foundDigestC: variable (unsigned int *);
+ *            foundDigestCSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static unsigned int searchDigest0;
+static unsigned int searchDigest1;
+static unsigned int searchDigest2;
+static unsigned int searchDigest3;
+static int keyspace;
+static int byteLength;
+static int valsPerByte;
+static int *foundIndex = NULL;
+static unsigned int foundIndexSz = 0;
+static int *foundIndexC = NULL;
+static unsigned int foundIndexCSz = 0;
+static unsigned char *foundKey = NULL;
+static unsigned int foundKeySz = 0;
+static unsigned char *foundKeyC = NULL;
+static unsigned int foundKeyCSz = 0;
+static unsigned int *foundDigest = NULL;
+static unsigned int foundDigestSz = 0;
+static unsigned int *foundDigestC = NULL;
+static unsigned int foundDigestCSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeFindkeywithdigest_Kernel = NULL;
+static size_t *localSizeFindkeywithdigest_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(searchDigest0),
+	RT_BIND_VALUE(searchDigest1),
+	RT_BIND_VALUE(searchDigest2),
+	RT_BIND_VALUE(searchDigest3),
+	RT_BIND_VALUE(keyspace),
+	RT_BIND_VALUE(byteLength),
+	RT_BIND_VALUE(valsPerByte),
+	RT_BIND_POINTER_C(foundIndex),
+	RT_BIND_POINTER_C(foundKey),
+	RT_BIND_POINTER_C(foundDigest),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(FindKeyWithDigest_Kernel, Findkeywithdigest_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(searchDigest0, searchDigest1, searchDigest2, searchDigest3, keyspace, byteLength, valsPerByte, foundIndex, foundIndexC, foundKey, foundKeySz, foundKeyC, foundKeyCSz, foundDigest, foundDigestSz, foundDigestC, foundDigestCSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
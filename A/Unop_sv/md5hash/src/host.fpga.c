@@ -103,6 +103,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueFindkeywithdigest_Kernel = NULL;
+	cl_command_queue transferQueueFindkeywithdigest_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -113,6 +114,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimFindkeywithdigest_Kernel = 1;
 	size_t globalSizeFindkeywithdigest_Kernel[1] = {
 		1000192
@@ -170,7 +172,13 @@ int main(void) {
 
 	/* Create command queue for FindKeyWithDigest_Kernel kernel */
 	PRINT_STEP("Creating command queue for \"FindKeyWithDigest_Kernel\"...");
-	queueFindkeywithdigest_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueFindkeywithdigest_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for FindKeyWithDigest_Kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"FindKeyWithDigest_Kernel\"...");
+	transferQueueFindkeywithdigest_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -261,17 +269,18 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (byteLength)"));
 		fRet = clSetKernelArg(kernelFindkeywithdigest_Kernel, 6, sizeof(int), &valsPerByte);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (valsPerByte)"));
-		fRet = clEnqueueWriteBuffer(queueFindkeywithdigest_Kernel, foundIndexK, CL_TRUE, 0, 1 * sizeof(int), foundIndex, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindkeywithdigest_Kernel, foundIndexK, TRANSFER_BLOCKING, 0, 1 * sizeof(int), foundIndex, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "foundIndex"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (foundIndexK)"));
-		fRet = clEnqueueWriteBuffer(queueFindkeywithdigest_Kernel, foundKeyK, CL_TRUE, 0, 8 * sizeof(unsigned char), foundKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindkeywithdigest_Kernel, foundKeyK, TRANSFER_BLOCKING, 0, 8 * sizeof(unsigned char), foundKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "foundKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (foundKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueFindkeywithdigest_Kernel, foundDigestK, CL_TRUE, 0, 4 * sizeof(unsigned int), foundDigest, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueFindkeywithdigest_Kernel, foundDigestK, TRANSFER_BLOCKING, 0, 4 * sizeof(unsigned int), foundDigest, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "foundDigest"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (foundDigestK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueFindkeywithdigest_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueFindkeywithdigest_Kernel, kernelFindkeywithdigest_Kernel, workDimFindkeywithdigest_Kernel, NULL, globalSizeFindkeywithdigest_Kernel, localSizeFindkeywithdigest_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueFindkeywithdigest_Kernel, kernelFindkeywithdigest_Kernel, workDimFindkeywithdigest_Kernel, NULL, globalSizeFindkeywithdigest_Kernel, localSizeFindkeywithdigest_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "FindKeyWithDigest_Kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueFindkeywithdigest_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -279,11 +288,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueFindkeywithdigest_Kernel, foundIndexK, CL_TRUE, 0, 1 * sizeof(int), foundIndex, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueFindkeywithdigest_Kernel, foundKeyK, CL_TRUE, 0, 8 * sizeof(unsigned char), foundKey, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueFindkeywithdigest_Kernel, foundDigestK, CL_TRUE, 0, 4 * sizeof(unsigned int), foundDigest, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueFindkeywithdigest_Kernel, foundIndexK, TRANSFER_BLOCKING, 0, 1 * sizeof(int), foundIndex, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "foundIndex"));
+		fRet = clEnqueueReadBuffer(transferQueueFindkeywithdigest_Kernel, foundKeyK, TRANSFER_BLOCKING, 0, 8 * sizeof(unsigned char), foundKey, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "foundKey"));
+		fRet = clEnqueueReadBuffer(transferQueueFindkeywithdigest_Kernel, foundDigestK, TRANSFER_BLOCKING, 0, 4 * sizeof(unsigned int), foundDigest, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "foundDigest"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -294,6 +305,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -329,6 +341,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(foundIndexK)
 		clReleaseMemObject(foundIndexK);
@@ -360,6 +375,8 @@ _err:
 	/* Dealloc queues */
 	if(queueFindkeywithdigest_Kernel)
 		clReleaseCommandQueue(queueFindkeywithdigest_Kernel);
+	if(transferQueueFindkeywithdigest_Kernel)
+		clReleaseCommandQueue(transferQueueFindkeywithdigest_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
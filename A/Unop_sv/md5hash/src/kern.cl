@@ -244,7 +244,11 @@ inline void IndexToKey(unsigned int index, int byteLength, int valsPerByte,
 //
 // Modifications:
 // ****************************************************************************
-__attribute__((reqd_work_group_size(256,1,1)))
+#ifndef WG_SIZE_0
+#define WG_SIZE_0 256
+#endif
+
+__attribute__((reqd_work_group_size(WG_SIZE_0,1,1)))
 __kernel void
 FindKeyWithDigest_Kernel(unsigned int searchDigest0,
                          unsigned int searchDigest1,
@@ -256,7 +260,7 @@ FindKeyWithDigest_Kernel(unsigned int searchDigest0,
                          __global unsigned char *foundKey,
                          __global unsigned int *foundDigest)
 {
-    int threadid = (get_group_id(0)*get_local_size(0)) + get_local_id(0);
+    int threadid = get_global_id(0);
 
     int startindex = threadid * valsPerByte;
     unsigned char key[8] = {0,0,0,0, 0,0,0,0};
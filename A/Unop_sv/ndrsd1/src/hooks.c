@@ -0,0 +1,129 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount);
+ *            POSTAMBLE(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount);
+ *            LOOPPREAMBLE(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount, loopFlag);
+ *            LOOPPOSTAMBLE(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount, loopFlag);
+ *            CLEANUP(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount);
+ *        where:
+ *            s: variable (short *);
+ *            sSz: number of members in variable (unsigned int);
+ *            c: variable (short *);
+ *            cSz: number of members in variable (unsigned int);
+ *            cC: variable (short *);
+ *            cCSz: number of members in variable (unsigned int);
+ *            w: variable (short *);
+ *            wSz: number of members in variable (unsigned int);
+ *            wC: variable (short *);
+ *            wCSz: number of members in variable (unsigned int);
+ *            loopCount: variable (unsigned char);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static short *s = NULL;
+static unsigned int sSz = 0;
+static short *c = NULL;
+static unsigned int cSz = 0;
+static short *cC = NULL;
+static unsigned int cCSz = 0;
+static short *w = NULL;
+static unsigned int wSz = 0;
+static short *wC = NULL;
+static unsigned int wCSz = 0;
+static unsigned char loopCount;
+
+/* Work sizes */
+static size_t *globalSizeBerlekamp = NULL;
+static size_t *localSizeBerlekamp = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(s),
+	RT_BIND_POINTER_C(c),
+	RT_BIND_POINTER_C(w),
+	RT_BIND_VALUE(loopCount),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(berlekamp, Berlekamp),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(s, sSz, c, cSz, cC, cCSz, w, wSz, wC, wCSz, loopCount);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -97,6 +97,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBerlekamp = NULL;
+	cl_command_queue transferQueueBerlekamp = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,6 +108,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 6);
 	cl_uint workDimBerlekamp = 1;
 	size_t globalSizeBerlekamp[1] = {
 		256
@@ -157,7 +159,13 @@ int main(void) {
 
 	/* Create command queue for berlekamp kernel */
 	PRINT_STEP("Creating command queue for \"berlekamp\"...");
-	queueBerlekamp = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBerlekamp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for berlekamp kernel */
+	PRINT_STEP("Creating transfer command queue for \"berlekamp\"...");
+	transferQueueBerlekamp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -222,19 +230,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, sK, CL_TRUE, 0, 8160 * sizeof(short), s, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, sK, TRANSFER_BLOCKING, 0, 8160 * sizeof(short), s, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "s"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (sK)"));
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, cK, CL_TRUE, 0, 4590 * sizeof(short), c, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, cK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), c, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (cK)"));
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, wK, CL_TRUE, 0, 4590 * sizeof(short), w, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, wK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), w, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "w"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (wK)"));
 		fRet = clSetKernelArg(kernelBerlekamp, 3, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBerlekamp);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBerlekamp, kernelBerlekamp, workDimBerlekamp, NULL, globalSizeBerlekamp, localSizeBerlekamp, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBerlekamp, kernelBerlekamp, workDimBerlekamp, NULL, globalSizeBerlekamp, localSizeBerlekamp, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "berlekamp"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBerlekamp);
 		gettimeofday(&tNow, NULL);
@@ -242,10 +251,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBerlekamp, cK, CL_TRUE, 0, 4590 * sizeof(short), c, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBerlekamp, wK, CL_TRUE, 0, 4590 * sizeof(short), w, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBerlekamp, cK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), c, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "c"));
+		fRet = clEnqueueReadBuffer(transferQueueBerlekamp, wK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), w, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "w"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -256,6 +267,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -282,6 +294,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(sK)
 		clReleaseMemObject(sK);
@@ -312,6 +327,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBerlekamp)
 		clReleaseCommandQueue(queueBerlekamp);
+	if(transferQueueBerlekamp)
+		clReleaseCommandQueue(transferQueueBerlekamp);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -97,6 +97,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBerlekamp = NULL;
+	cl_command_queue transferQueueBerlekamp = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -105,8 +106,10 @@ int main(void) {
 	cl_kernel kernelBerlekamp = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 6);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimBerlekamp = 1;
 	size_t globalSizeBerlekamp[1] = {
 		256
@@ -157,7 +160,13 @@ int main(void) {
 
 	/* Create command queue for berlekamp kernel */
 	PRINT_STEP("Creating command queue for \"berlekamp\"...");
-	queueBerlekamp = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBerlekamp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for berlekamp kernel */
+	PRINT_STEP("Creating transfer command queue for \"berlekamp\"...");
+	transferQueueBerlekamp = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -178,18 +187,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create berlekamp kernel */
 	PRINT_STEP("Creating kernel \"berlekamp\" from program...");
 	kernelBerlekamp = clCreateKernel(program, "berlekamp", &fRet);
@@ -221,19 +243,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, sK, CL_TRUE, 0, 8160 * sizeof(short), s, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, sK, TRANSFER_BLOCKING, 0, 8160 * sizeof(short), s, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "s"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (sK)"));
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, cK, CL_TRUE, 0, 4590 * sizeof(short), c, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, cK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), c, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "c"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (cK)"));
-		fRet = clEnqueueWriteBuffer(queueBerlekamp, wK, CL_TRUE, 0, 4590 * sizeof(short), w, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBerlekamp, wK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), w, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "w"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (wK)"));
 		fRet = clSetKernelArg(kernelBerlekamp, 3, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBerlekamp);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBerlekamp, kernelBerlekamp, workDimBerlekamp, NULL, globalSizeBerlekamp, localSizeBerlekamp, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBerlekamp, kernelBerlekamp, workDimBerlekamp, NULL, globalSizeBerlekamp, localSizeBerlekamp, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "berlekamp"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBerlekamp);
 		gettimeofday(&tNow, NULL);
@@ -241,10 +264,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBerlekamp, cK, CL_TRUE, 0, 4590 * sizeof(short), c, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBerlekamp, wK, CL_TRUE, 0, 4590 * sizeof(short), w, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBerlekamp, cK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), c, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "c"));
+		fRet = clEnqueueReadBuffer(transferQueueBerlekamp, wK, TRANSFER_BLOCKING, 0, 4590 * sizeof(short), w, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "w"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -255,6 +280,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -281,6 +308,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(sK)
 		clReleaseMemObject(sK);
@@ -311,6 +341,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBerlekamp)
 		clReleaseCommandQueue(queueBerlekamp);
+	if(transferQueueBerlekamp)
+		clReleaseCommandQueue(transferQueueBerlekamp);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -55,7 +55,7 @@ __kernel void berlekamp(__global unsigned short *s, __global unsigned short *c,
 				p[j] = p[j-1];
 				a[j] = a[j-1];
 			}
-			shiftReg[0] = s[i + (2 * T)];
+			shiftReg[0] = s[i + (gid * (2 * T))];
 			p[0] = 0;
 			a[0] = 0;
 
@@ -0,0 +1,138 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount);
+ *            POSTAMBLE(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount);
+ *            LOOPPREAMBLE(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount, loopFlag);
+ *            LOOPPOSTAMBLE(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount, loopFlag);
+ *            CLEANUP(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount);
+ *        where:
+ *            lA: variable (short *);
+ *            lASz: number of members in variable (unsigned int);
+ *            errLocOut: variable (short *);
+ *            errLocOutSz: number of members in variable (unsigned int);
+ *            errLocOutC: variable (short *);
+ *            errLocOutCSz: number of members in variable (unsigned int);
+ *            alphaInvOut: variable (short *);
+ *            alphaInvOutSz: number of members in variable (unsigned int);
+ *            alphaInvOutC: variable (short *);
+ *            alphaInvOutCSz: number of members in variable (unsigned int);
+ *            errCnt: variable (short *);
+ *            errCntSz: number of members in variable (unsigned int);
+ *            errCntC: variable (short *);
+ *            errCntCSz: number of members in variable (unsigned int);
+ *            loopCount: variable (unsigned char);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static short *lA = NULL;
+static unsigned int lASz = 0;
+static short *errLocOut = NULL;
+static unsigned int errLocOutSz = 0;
+static short *errLocOutC = NULL;
+static unsigned int errLocOutCSz = 0;
+static short *alphaInvOut = NULL;
+static unsigned int alphaInvOutSz = 0;
+static short *alphaInvOutC = NULL;
+static unsigned int alphaInvOutCSz = 0;
+static short *errCnt = NULL;
+static unsigned int errCntSz = 0;
+static short *errCntC = NULL;
+static unsigned int errCntCSz = 0;
+static unsigned char loopCount;
+
+/* Work sizes */
+static size_t *globalSizeChien = NULL;
+static size_t *localSizeChien = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(lA),
+	RT_BIND_POINTER_C(errLocOut),
+	RT_BIND_POINTER_C(alphaInvOut),
+	RT_BIND_POINTER_C(errCnt),
+	RT_BIND_VALUE(loopCount),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(chien, Chien),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(lA, lASz, errLocOut, errLocOutSz, errLocOutC, errLocOutCSz, alphaInvOut, alphaInvOutSz, alphaInvOutC, alphaInvOutCSz, errCnt, errCntSz, errCntC, errCntCSz, loopCount);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
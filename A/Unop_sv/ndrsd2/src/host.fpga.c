@@ -101,6 +101,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueChien = NULL;
+	cl_command_queue transferQueueChien = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -111,6 +112,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 8);
 	cl_uint workDimChien = 1;
 	size_t globalSizeChien[1] = {
 		256
@@ -164,7 +166,13 @@ int main(void) {
 
 	/* Create command queue for chien kernel */
 	PRINT_STEP("Creating command queue for \"chien\"...");
-	queueChien = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueChien = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for chien kernel */
+	PRINT_STEP("Creating transfer command queue for \"chien\"...");
+	transferQueueChien = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -233,21 +241,22 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueChien, lAK, CL_TRUE, 0, 4080 * sizeof(short), lA, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueChien, lAK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), lA, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "lA"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (lAK)"));
-		fRet = clEnqueueWriteBuffer(queueChien, errLocOutK, CL_TRUE, 0, 4080 * sizeof(short), errLocOut, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueChien, errLocOutK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), errLocOut, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "errLocOut"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (errLocOutK)"));
-		fRet = clEnqueueWriteBuffer(queueChien, alphaInvOutK, CL_TRUE, 0, 4080 * sizeof(short), alphaInvOut, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueChien, alphaInvOutK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), alphaInvOut, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "alphaInvOut"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (alphaInvOutK)"));
-		fRet = clEnqueueWriteBuffer(queueChien, errCntK, CL_TRUE, 0, 255 * sizeof(short), errCnt, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueChien, errCntK, TRANSFER_BLOCKING, 0, 255 * sizeof(short), errCnt, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "errCnt"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (errCntK)"));
 		fRet = clSetKernelArg(kernelChien, 4, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueChien);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueChien, kernelChien, workDimChien, NULL, globalSizeChien, localSizeChien, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueChien, kernelChien, workDimChien, NULL, globalSizeChien, localSizeChien, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "chien"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueChien);
 		gettimeofday(&tNow, NULL);
@@ -255,11 +264,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueChien, errLocOutK, CL_TRUE, 0, 4080 * sizeof(short), errLocOut, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueChien, alphaInvOutK, CL_TRUE, 0, 4080 * sizeof(short), alphaInvOut, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueChien, errCntK, CL_TRUE, 0, 255 * sizeof(short), errCnt, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueChien, errLocOutK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), errLocOut, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "errLocOut"));
+		fRet = clEnqueueReadBuffer(transferQueueChien, alphaInvOutK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), alphaInvOut, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "alphaInvOut"));
+		fRet = clEnqueueReadBuffer(transferQueueChien, errCntK, TRANSFER_BLOCKING, 0, 255 * sizeof(short), errCnt, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "errCnt"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -270,6 +281,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -305,6 +317,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(lAK)
 		clReleaseMemObject(lAK);
@@ -339,6 +354,8 @@ _err:
 	/* Dealloc queues */
 	if(queueChien)
 		clReleaseCommandQueue(queueChien);
+	if(transferQueueChien)
+		clReleaseCommandQueue(transferQueueChien);
 
 	/* Last OpenCL variables */
 	if(context)
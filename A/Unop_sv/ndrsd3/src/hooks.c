@@ -0,0 +1,140 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount);
+ *            POSTAMBLE(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount);
+ *            LOOPPREAMBLE(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount, loopFlag);
+ *            LOOPPOSTAMBLE(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount, loopFlag);
+ *            CLEANUP(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount);
+ *        where:
+ *            lambda: variable (short *);
+ *            lambdaSz: number of members in variable (unsigned int);
+ *            omega: variable (short *);
+ *            omegaSz: number of members in variable (unsigned int);
+ *            errCnt: variable (short *);
+ *            errCntSz: number of members in variable (unsigned int);
+ *            errLoc: variable (short *);
+ *            errLocSz: number of members in variable (unsigned int);
+ *            alphaInv: variable (short *);
+ *            alphaInvSz: number of members in variable (unsigned int);
+ *            errOut: variable (short *);
+ *            errOutSz: number of members in variable (unsigned int);
+ *            errOutC: variable (short *);
+ *            errOutCSz: number of members in variable (unsigned int);
+ *            loopCount: variable (unsigned char);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static short *lambda = NULL;
+static unsigned int lambdaSz = 0;
+static short *omega = NULL;
+static unsigned int omegaSz = 0;
+static short *errCnt = NULL;
+static unsigned int errCntSz = 0;
+static short *errLoc = NULL;
+static unsigned int errLocSz = 0;
+static short *alphaInv = NULL;
+static unsigned int alphaInvSz = 0;
+static short *errOut = NULL;
+static unsigned int errOutSz = 0;
+static short *errOutC = NULL;
+static unsigned int errOutCSz = 0;
+static unsigned char loopCount;
+
+/* Work sizes */
+static size_t *globalSizeForneys = NULL;
+static size_t *localSizeForneys = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(lambda),
+	RT_BIND_POINTER(omega),
+	RT_BIND_POINTER(errCnt),
+	RT_BIND_POINTER(errLoc),
+	RT_BIND_POINTER(alphaInv),
+	RT_BIND_POINTER_C(errOut),
+	RT_BIND_VALUE(loopCount),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(forneys, Forneys),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(lambda, lambdaSz, omega, omegaSz, errCnt, errCntSz, errLoc, errLocSz, alphaInv, alphaInvSz, errOut, errOutSz, errOutC, errOutCSz, loopCount);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -101,6 +101,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueForneys = NULL;
+	cl_command_queue transferQueueForneys = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,8 +110,10 @@ int main(void) {
 	cl_kernel kernelForneys = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 8);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimForneys = 1;
 	size_t globalSizeForneys[1] = {
 		256
@@ -166,7 +169,13 @@ int main(void) {
 
 	/* Create command queue for forneys kernel */
 	PRINT_STEP("Creating command queue for \"forneys\"...");
-	queueForneys = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueForneys = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for forneys kernel */
+	PRINT_STEP("Creating transfer command queue for \"forneys\"...");
+	transferQueueForneys = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -187,18 +196,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create forneys kernel */
 	PRINT_STEP("Creating kernel \"forneys\" from program...");
 	kernelForneys = clCreateKernel(program, "forneys", &fRet);
@@ -242,25 +264,26 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueForneys, lambdaK, CL_TRUE, 0, 4080 * sizeof(short), lambda, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, lambdaK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), lambda, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "lambda"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (lambdaK)"));
-		fRet = clEnqueueWriteBuffer(queueForneys, omegaK, CL_TRUE, 0, 4080 * sizeof(short), omega, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, omegaK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), omega, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "omega"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (omegaK)"));
-		fRet = clEnqueueWriteBuffer(queueForneys, errCntK, CL_TRUE, 0, 255 * sizeof(short), errCnt, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, errCntK, TRANSFER_BLOCKING, 0, 255 * sizeof(short), errCnt, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "errCnt"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (errCntK)"));
-		fRet = clEnqueueWriteBuffer(queueForneys, errLocK, CL_TRUE, 0, 4080 * sizeof(short), errLoc, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, errLocK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), errLoc, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "errLoc"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (errLocK)"));
-		fRet = clEnqueueWriteBuffer(queueForneys, alphaInvK, CL_TRUE, 0, 4080 * sizeof(short), alphaInv, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, alphaInvK, TRANSFER_BLOCKING, 0, 4080 * sizeof(short), alphaInv, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "alphaInv"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (alphaInvK)"));
-		fRet = clEnqueueWriteBuffer(queueForneys, errOutK, CL_TRUE, 0, 56865 * sizeof(short), errOut, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueForneys, errOutK, TRANSFER_BLOCKING, 0, 56865 * sizeof(short), errOut, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "errOut"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (errOutK)"));
 		fRet = clSetKernelArg(kernelForneys, 6, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueForneys);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueForneys, kernelForneys, workDimForneys, NULL, globalSizeForneys, localSizeForneys, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueForneys, kernelForneys, workDimForneys, NULL, globalSizeForneys, localSizeForneys, ASYNC_WAIT_LIST(profileEvents, 0, 6), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "forneys"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueForneys);
 		gettimeofday(&tNow, NULL);
@@ -268,9 +291,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueForneys, errOutK, CL_TRUE, 0, 56865 * sizeof(short), errOut, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueForneys, errOutK, TRANSFER_BLOCKING, 0, 56865 * sizeof(short), errOut, ASYNC_WAIT_LIST(profileEvents, 6, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "errOut"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 7, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -281,6 +306,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -298,6 +325,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(lambdaK)
 		clReleaseMemObject(lambdaK);
@@ -336,6 +366,8 @@ _err:
 	/* Dealloc queues */
 	if(queueForneys)
 		clReleaseCommandQueue(queueForneys);
+	if(transferQueueForneys)
+		clReleaseCommandQueue(transferQueueForneys);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueSyndrome = NULL;
+	cl_command_queue transferQueueSyndrome = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -101,8 +102,10 @@ int main(void) {
 	cl_kernel kernelSyndrome = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimSyndrome = 1;
 	size_t globalSizeSyndrome[1] = {
 		256
@@ -150,7 +153,13 @@ int main(void) {
 
 	/* Create command queue for syndrome kernel */
 	PRINT_STEP("Creating command queue for \"syndrome\"...");
-	queueSyndrome = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueSyndrome = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for syndrome kernel */
+	PRINT_STEP("Creating transfer command queue for \"syndrome\"...");
+	transferQueueSyndrome = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -171,18 +180,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create syndrome kernel */
 	PRINT_STEP("Creating kernel \"syndrome\" from program...");
 	kernelSyndrome = clCreateKernel(program, "syndrome", &fRet);
@@ -210,17 +232,18 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueSyndrome, rK, CL_TRUE, 0, 65025 * sizeof(unsigned char), r, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSyndrome, rK, TRANSFER_BLOCKING, 0, 65025 * sizeof(unsigned char), r, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "r"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (rK)"));
-		fRet = clEnqueueWriteBuffer(queueSyndrome, sK, CL_TRUE, 0, 8160 * sizeof(short), s, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSyndrome, sK, TRANSFER_BLOCKING, 0, 8160 * sizeof(short), s, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "s"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (sK)"));
 		fRet = clSetKernelArg(kernelSyndrome, 2, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueSyndrome);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueSyndrome, kernelSyndrome, workDimSyndrome, NULL, globalSizeSyndrome, localSizeSyndrome, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueSyndrome, kernelSyndrome, workDimSyndrome, NULL, globalSizeSyndrome, localSizeSyndrome, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "syndrome"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueSyndrome);
 		gettimeofday(&tNow, NULL);
@@ -228,9 +251,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueSyndrome, sK, CL_TRUE, 0, 8160 * sizeof(short), s, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueSyndrome, sK, TRANSFER_BLOCKING, 0, 8160 * sizeof(short), s, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "s"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -241,6 +266,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -258,6 +285,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(rK)
 		clReleaseMemObject(rK);
@@ -284,6 +314,8 @@ _err:
 	/* Dealloc queues */
 	if(queueSyndrome)
 		clReleaseCommandQueue(queueSyndrome);
+	if(transferQueueSyndrome)
+		clReleaseCommandQueue(transferQueueSyndrome);
 
 	/* Last OpenCL variables */
 	if(context)
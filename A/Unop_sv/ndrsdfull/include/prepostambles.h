@@ -1,5 +1,5 @@
 #define PREAMBLE(r, rSz, out, outSz, outC, outCSz, loopCount) {\
-	int _i, _j;\
+	int _i;\
 	unsigned int _vars = 2;\
 	char *_fileNames[] = {\
 		"inputR",\
@@ -24,3 +24,21 @@
 		fclose(ipf);\
 	}\
 }
+
+/* Staged decoder (host.staged.c): both decoders must reproduce outputOut. The staged one outputs error values, which are added to the input here */
+#define STAGEDPOSTAMBLE(r, errOut, out, outC, loopCount) {\
+	int _i, _j;\
+	int _wrongStaged = 0;\
+	int _wrongFused = 0;\
+\
+	for(_i = 0; _i < loopCount; _i++) {\
+		for(_j = 0; _j < K; _j++) {\
+			if((r[_j + (_i * N)] ^ errOut[_j + (_i * K)]) != outC[_j + (_i * K)])\
+				_wrongStaged++;\
+			if(out[_j + (_i * K)] != outC[_j + (_i * K)])\
+				_wrongFused++;\
+		}\
+	}\
+\
+	ASSERT_CALL(!_wrongStaged && !_wrongFused, fprintf(stderr, "Error: %d (staged) and %d (fused) of %d bytes differ from outputOut.\n", _wrongStaged, _wrongFused, loopCount * K); rv = EXIT_FAILURE);\
+}
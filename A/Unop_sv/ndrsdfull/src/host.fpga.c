@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueRsd = NULL;
+	cl_command_queue transferQueueRsd = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -103,6 +104,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
 	cl_uint workDimRsd = 1;
 	size_t globalSizeRsd[1] = {
 		256
@@ -150,7 +152,13 @@ int main(void) {
 
 	/* Create command queue for rsd kernel */
 	PRINT_STEP("Creating command queue for \"rsd\"...");
-	queueRsd = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueRsd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for rsd kernel */
+	PRINT_STEP("Creating transfer command queue for \"rsd\"...");
+	transferQueueRsd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -211,17 +219,18 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueRsd, rK, CL_TRUE, 0, 65025 * sizeof(unsigned char), r, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueRsd, rK, TRANSFER_BLOCKING, 0, 65025 * sizeof(unsigned char), r, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "r"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (rK)"));
-		fRet = clEnqueueWriteBuffer(queueRsd, outK, CL_TRUE, 0, 56865 * sizeof(unsigned char), out, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueRsd, outK, TRANSFER_BLOCKING, 0, 56865 * sizeof(unsigned char), out, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outK)"));
 		fRet = clSetKernelArg(kernelRsd, 2, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueRsd);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueRsd, kernelRsd, workDimRsd, NULL, globalSizeRsd, localSizeRsd, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueRsd, kernelRsd, workDimRsd, NULL, globalSizeRsd, localSizeRsd, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "rsd"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueRsd);
 		gettimeofday(&tNow, NULL);
@@ -229,9 +238,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueRsd, outK, CL_TRUE, 0, 56865 * sizeof(unsigned char), out, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueRsd, outK, TRANSFER_BLOCKING, 0, 56865 * sizeof(unsigned char), out, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -242,6 +253,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -259,6 +271,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(rK)
 		clReleaseMemObject(rK);
@@ -285,6 +300,8 @@ _err:
 	/* Dealloc queues */
 	if(queueRsd)
 		clReleaseCommandQueue(queueRsd);
+	if(transferQueueRsd)
+		clReleaseCommandQueue(transferQueueRsd);
 
 	/* Last OpenCL variables */
 	if(context)
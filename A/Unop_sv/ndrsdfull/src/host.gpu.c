@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueRsd = NULL;
+	cl_command_queue transferQueueRsd = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -101,8 +102,10 @@ int main(void) {
 	cl_kernel kernelRsd = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimRsd = 1;
 	size_t globalSizeRsd[1] = {
 		256
@@ -150,7 +153,13 @@ int main(void) {
 
 	/* Create command queue for rsd kernel */
 	PRINT_STEP("Creating command queue for \"rsd\"...");
-	queueRsd = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueRsd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for rsd kernel */
+	PRINT_STEP("Creating transfer command queue for \"rsd\"...");
+	transferQueueRsd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -171,18 +180,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create rsd kernel */
 	PRINT_STEP("Creating kernel \"rsd\" from program...");
 	kernelRsd = clCreateKernel(program, "rsd", &fRet);
@@ -210,17 +232,18 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueRsd, rK, CL_TRUE, 0, 65025 * sizeof(unsigned char), r, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueRsd, rK, TRANSFER_BLOCKING, 0, 65025 * sizeof(unsigned char), r, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "r"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (rK)"));
-		fRet = clEnqueueWriteBuffer(queueRsd, outK, CL_TRUE, 0, 56865 * sizeof(unsigned char), out, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueRsd, outK, TRANSFER_BLOCKING, 0, 56865 * sizeof(unsigned char), out, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outK)"));
 		fRet = clSetKernelArg(kernelRsd, 2, sizeof(unsigned char), &loopCount);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (loopCount)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueRsd);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueRsd, kernelRsd, workDimRsd, NULL, globalSizeRsd, localSizeRsd, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueRsd, kernelRsd, workDimRsd, NULL, globalSizeRsd, localSizeRsd, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "rsd"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueRsd);
 		gettimeofday(&tNow, NULL);
@@ -228,9 +251,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueRsd, outK, CL_TRUE, 0, 56865 * sizeof(unsigned char), out, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueRsd, outK, TRANSFER_BLOCKING, 0, 56865 * sizeof(unsigned char), out, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -241,6 +266,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -258,6 +285,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(rK)
 		clReleaseMemObject(rK);
@@ -284,6 +314,8 @@ _err:
 	/* Dealloc queues */
 	if(queueRsd)
 		clReleaseCommandQueue(queueRsd);
+	if(transferQueueRsd)
+		clReleaseCommandQueue(transferQueueRsd);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,494 @@
+/* ********************************************************************************************* */
+/* * Staged Reed-Solomon Decoder Host                                                          * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2017 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "constants.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(r, rSz, out, outSz, outC, outCSz, loopCount);
+ *            STAGEDPOSTAMBLE(r, errOut, out, outC, loopCount);
+ *        where:
+ *            r: corrupted codewords (unsigned char *);
+ *            rSz: number of members in variable (unsigned int);
+ *            errOut: error values found by the staged decoder (unsigned short *);
+ *            out: codewords corrected by the fused decoder (unsigned char *);
+ *            outSz: number of members in variable (unsigned int);
+ *            outC: expected corrected codewords (unsigned char *);
+ *            outCSz: number of members in variable (unsigned int);
+ *            loopCount: number of codewords (unsigned char).
+ */
+#include "prepostambles.h"
+
+/**
+ * @brief Maximum number of errors located per codeword (MAX_ERR in kern.staged.cl).
+ */
+#define MAX_ERR 16
+
+/**
+ * @brief Work-group size of all kernels. A single work-group decodes all codewords.
+ */
+#define GROUP_SIZE 256
+
+/**
+ * @brief Standard statements for function error handling and printing.
+ *
+ * @param funcName Function name that failed.
+ */
+#define FUNCTION_ERROR_STATEMENTS(funcName) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s failed with return code %d.\n", funcName, fRet);\
+}
+
+/**
+ * @brief Standard statements for POSIX error handling and printing.
+ *
+ * @param arg Arbitrary string to the printed at the end of error string.
+ */
+#define POSIX_ERROR_STATEMENTS(arg) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s: %s\n", strerror(errno), arg);\
+}
+
+/**
+ * @brief Set a kernel argument, jumping to _err on failure.
+ */
+#define SET_ARG(kernel, index, type, value) {\
+	fRet = clSetKernelArg(kernel, index, sizeof(type), value);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (" #kernel ", " #value ")"));\
+}
+
+/**
+ * @brief Enqueue a kernel over all codewords, jumping to _err on failure.
+ */
+#define ENQUEUE(kernel) {\
+	fRet = clEnqueueNDRangeKernel(queue, kernel, 1, NULL, globalSize, localSize, 0, NULL, NULL);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (" #kernel ")"));\
+}
+
+/**
+ * @brief Copy coefficients 1 to T of each codeword from a (T + 2)-wide Berlekamp output to a T-wide buffer, jumping to _err on failure.
+ */
+#define COPY_COEFFICIENTS(src, dst) {\
+	size_t _srcOrigin[3] = {sizeof(unsigned short), 0, 0};\
+	size_t _dstOrigin[3] = {0, 0, 0};\
+	size_t _region[3] = {T * sizeof(unsigned short), loopCount, 1};\
+	fRet = clEnqueueCopyBufferRect(queue, src, dst, _srcOrigin, _dstOrigin, _region, (T + 2) * sizeof(unsigned short), 0,\
+		T * sizeof(unsigned short), 0, 0, NULL, NULL);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueCopyBufferRect (" #src ", " #dst ")"));\
+}
+
+/**
+ * @brief Programs built by this host: the staged kernels and the fused rsd kernel.
+ */
+enum {
+	P_STAGED,
+	P_FUSED,
+	P_TOTAL
+};
+
+int main(int argc, char *argv[]) {
+	/* Return variable */
+	int rv = EXIT_SUCCESS;
+
+	/* OpenCL and aux variables */
+	int i, p, opt;
+	cl_uint platformsLen, devicesLen;
+	cl_int fRet;
+	cl_platform_id *platforms = NULL;
+	cl_device_id *devices = NULL;
+	cl_context context = NULL;
+	cl_command_queue queue = NULL;
+	FILE *programFile = NULL;
+	size_t programSz;
+	char *programContent = NULL;
+	cl_program programs[P_TOTAL] = {NULL, NULL};
+	cl_kernel kernelSyndrome = NULL;
+	cl_kernel kernelBerlekamp = NULL;
+	cl_kernel kernelChien = NULL;
+	cl_kernel kernelForneys = NULL;
+	cl_kernel kernelRsd = NULL;
+	struct timeval tThen, tNow, tStagedTime, tFusedTime;
+#ifdef STAGED_PROGRAM_BINARY
+	const char *programNames[P_TOTAL] = {"program.staged.aocx", "program.aocx"};
+	cl_int programRet;
+#else
+	const char *programNames[P_TOTAL] = {"kern.staged.cl", "kern.cl"};
+	struct timeval tProgramTime;
+	PROGRAM_CACHE_DECLARE(programCache);
+	bool programCacheHits[P_TOTAL] = {false, false};
+	timerclear(&tProgramTime);
+#endif
+	size_t localSize[1] = {GROUP_SIZE};
+	size_t globalSize[1] = {GROUP_SIZE};
+
+	/* Decoder parameters */
+	int runs = 100;
+	unsigned char loopCount = I;
+
+	/* Host and device variables */
+	unsigned char *r = NULL;
+	unsigned char *out = NULL;
+	unsigned char *outC = NULL;
+	unsigned short *errOut = NULL;
+	cl_mem rK = NULL;
+	cl_mem sK = NULL;
+	cl_mem cK = NULL;
+	cl_mem wK = NULL;
+	cl_mem lAK = NULL;
+	cl_mem lambdaK = NULL;
+	cl_mem omegaK = NULL;
+	cl_mem errLocK = NULL;
+	cl_mem alphaInvK = NULL;
+	cl_mem errCntK = NULL;
+	cl_mem errOutK = NULL;
+	cl_mem outK = NULL;
+
+	/* Parse command line */
+	while((opt = getopt(argc, argv, "r:")) != -1) {
+		switch(opt) {
+			case 'r':
+				runs = strtol(optarg, NULL, 10);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-r RUNS]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	if(runs <= 0) {
+		fprintf(stderr, "Error: number of runs must be positive.\n");
+		return EXIT_FAILURE;
+	}
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	r = malloc(N * I * sizeof(unsigned char));
+	ASSERT_CALL(r, POSIX_ERROR_STATEMENTS("r"));
+	out = malloc(K * I * sizeof(unsigned char));
+	ASSERT_CALL(out, POSIX_ERROR_STATEMENTS("out"));
+	outC = malloc(K * I * sizeof(unsigned char));
+	ASSERT_CALL(outC, POSIX_ERROR_STATEMENTS("outC"));
+	errOut = malloc(K * I * sizeof(unsigned short));
+	ASSERT_CALL(errOut, POSIX_ERROR_STATEMENTS("errOut"));
+	PREAMBLE(r, N * I, out, K * I, outC, K * I, loopCount);
+	PRINT_SUCCESS();
+
+	/* Get platforms IDs */
+	PRINT_STEP("Getting platforms IDs...");
+	fRet = clGetPlatformIDs(0, NULL, &platformsLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	platforms = malloc(platformsLen * sizeof(cl_platform_id));
+	fRet = clGetPlatformIDs(platformsLen, platforms, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	PRINT_SUCCESS();
+
+	/* Get devices IDs for first platform availble */
+	PRINT_STEP("Getting devices IDs for first platform...");
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, NULL, &devicesLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	devices = malloc(devicesLen * sizeof(cl_device_id));
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devicesLen, devices, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	PRINT_SUCCESS();
+
+	/* Create context for first available device */
+	PRINT_STEP("Creating context...");
+	context = clCreateContext(NULL, 1, devices, NULL, NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateContext"));
+	PRINT_SUCCESS();
+
+	/* Create command queue for first available device */
+	PRINT_STEP("Creating command queue...");
+	queue = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Both programs are created the same way */
+	for(p = 0; p < P_TOTAL; p++) {
+		/* Open program file */
+		PRINT_STEP("Opening program file %s...", programNames[p]);
+		programFile = fopen(programNames[p], "rb");
+		ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS(programNames[p]));
+		PRINT_SUCCESS();
+
+		/* Get size and read file */
+		PRINT_STEP("Reading program file...");
+		fseek(programFile, 0, SEEK_END);
+		programSz = ftell(programFile);
+		fseek(programFile, 0, SEEK_SET);
+		programContent = malloc(programSz);
+		fread(programContent, programSz, 1, programFile);
+		fclose(programFile);
+		programFile = NULL;
+		PRINT_SUCCESS();
+
+#ifdef STAGED_PROGRAM_BINARY
+		/* Create program from binary file */
+		PRINT_STEP("Creating program from binary...");
+		programs[p] = clCreateProgramWithBinary(context, 1, devices, &programSz, (const unsigned char **) &programContent, &programRet, &fRet);
+		ASSERT_CALL(CL_SUCCESS == programRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary (when loading binary)"));
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary"));
+		PRINT_SUCCESS();
+#else
+		/* Create program from cached binary, if available */
+		gettimeofday(&tThen, NULL);
+		programCacheHit = false;
+		PRINT_STEP("Looking for cached program binary...");
+		PROGRAM_CACHE_LOAD(programCache, programs[p], context, devices[0], programContent, programSz, NULL);
+		programCacheHits[p] = programCacheHit;
+		PRINT_SUCCESS();
+
+		/* Create program from source file */
+		if(!programCacheHit) {
+			PRINT_STEP("Creating program from source...");
+			programs[p] = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+			PRINT_SUCCESS();
+		}
+#endif
+
+		/* Build program */
+		PRINT_STEP("Building program...");
+		fRet = clBuildProgram(programs[p], 1, devices, NULL, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
+		PRINT_SUCCESS();
+
+#ifndef STAGED_PROGRAM_BINARY
+		/* Store program binary in cache */
+		PROGRAM_CACHE_STORE(programCache, programs[p]);
+		gettimeofday(&tNow, NULL);
+		timersub(&tNow, &tThen, &tNow);
+		timeradd(&tProgramTime, &tNow, &tProgramTime);
+#endif
+
+		free(programContent);
+		programContent = NULL;
+	}
+
+	/* Create buffers and kernels. Intermediates of the staged decoder never leave the device */
+	PRINT_STEP("Creating buffers and kernels...");
+	rK = clCreateBuffer(context, CL_MEM_READ_ONLY, N * I * sizeof(unsigned char), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (rK)"));
+	sK = clCreateBuffer(context, CL_MEM_READ_WRITE, 2 * T * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (sK)"));
+	cK = clCreateBuffer(context, CL_MEM_READ_WRITE, (T + 2) * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (cK)"));
+	wK = clCreateBuffer(context, CL_MEM_READ_WRITE, (T + 2) * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (wK)"));
+	lAK = clCreateBuffer(context, CL_MEM_READ_WRITE, T * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (lAK)"));
+	lambdaK = clCreateBuffer(context, CL_MEM_READ_WRITE, T * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (lambdaK)"));
+	omegaK = clCreateBuffer(context, CL_MEM_READ_WRITE, T * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (omegaK)"));
+	errLocK = clCreateBuffer(context, CL_MEM_READ_WRITE, MAX_ERR * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (errLocK)"));
+	alphaInvK = clCreateBuffer(context, CL_MEM_READ_WRITE, MAX_ERR * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (alphaInvK)"));
+	errCntK = clCreateBuffer(context, CL_MEM_READ_WRITE, I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (errCntK)"));
+	errOutK = clCreateBuffer(context, CL_MEM_WRITE_ONLY, K * I * sizeof(unsigned short), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (errOutK)"));
+	outK = clCreateBuffer(context, CL_MEM_WRITE_ONLY, K * I * sizeof(unsigned char), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (outK)"));
+	kernelSyndrome = clCreateKernel(programs[P_STAGED], "syndrome", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (syndrome)"));
+	kernelBerlekamp = clCreateKernel(programs[P_STAGED], "berlekamp", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (berlekamp)"));
+	kernelChien = clCreateKernel(programs[P_STAGED], "chien", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (chien)"));
+	kernelForneys = clCreateKernel(programs[P_STAGED], "forneys", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (forneys)"));
+	kernelRsd = clCreateKernel(programs[P_FUSED], "rsd", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (rsd)"));
+	PRINT_SUCCESS();
+
+	/* Kernel arguments never change */
+	PRINT_STEP("Setting kernel arguments...");
+	SET_ARG(kernelSyndrome, 0, cl_mem, &rK);
+	SET_ARG(kernelSyndrome, 1, cl_mem, &sK);
+	SET_ARG(kernelSyndrome, 2, unsigned char, &loopCount);
+	SET_ARG(kernelBerlekamp, 0, cl_mem, &sK);
+	SET_ARG(kernelBerlekamp, 1, cl_mem, &cK);
+	SET_ARG(kernelBerlekamp, 2, cl_mem, &wK);
+	SET_ARG(kernelBerlekamp, 3, unsigned char, &loopCount);
+	SET_ARG(kernelChien, 0, cl_mem, &lAK);
+	SET_ARG(kernelChien, 1, cl_mem, &errLocK);
+	SET_ARG(kernelChien, 2, cl_mem, &alphaInvK);
+	SET_ARG(kernelChien, 3, cl_mem, &errCntK);
+	SET_ARG(kernelChien, 4, unsigned char, &loopCount);
+	SET_ARG(kernelForneys, 0, cl_mem, &lambdaK);
+	SET_ARG(kernelForneys, 1, cl_mem, &omegaK);
+	SET_ARG(kernelForneys, 2, cl_mem, &errCntK);
+	SET_ARG(kernelForneys, 3, cl_mem, &errLocK);
+	SET_ARG(kernelForneys, 4, cl_mem, &alphaInvK);
+	SET_ARG(kernelForneys, 5, cl_mem, &errOutK);
+	SET_ARG(kernelForneys, 6, unsigned char, &loopCount);
+	SET_ARG(kernelRsd, 0, cl_mem, &rK);
+	SET_ARG(kernelRsd, 1, cl_mem, &outK);
+	SET_ARG(kernelRsd, 2, unsigned char, &loopCount);
+	PRINT_SUCCESS();
+
+	/* Both decoders read the same codewords */
+	PRINT_STEP("Writing codewords...");
+	fRet = clEnqueueWriteBuffer(queue, rK, CL_TRUE, 0, N * I * sizeof(unsigned char), r, 0, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (rK)"));
+	PRINT_SUCCESS();
+
+	/* Chien modifies its locator in place, so Forneys gets its own copy. Omega is repacked likewise */
+	PRINT_STEP("Running staged decoder...");
+	gettimeofday(&tThen, NULL);
+	for(i = 0; i < runs; i++) {
+		ENQUEUE(kernelSyndrome);
+		ENQUEUE(kernelBerlekamp);
+		COPY_COEFFICIENTS(cK, lAK);
+		COPY_COEFFICIENTS(cK, lambdaK);
+		COPY_COEFFICIENTS(wK, omegaK);
+		ENQUEUE(kernelChien);
+		ENQUEUE(kernelForneys);
+	}
+	clFinish(queue);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tStagedTime);
+	PRINT_SUCCESS();
+
+	PRINT_STEP("Running fused decoder...");
+	gettimeofday(&tThen, NULL);
+	for(i = 0; i < runs; i++)
+		ENQUEUE(kernelRsd);
+	clFinish(queue);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tFusedTime);
+	PRINT_SUCCESS();
+
+	/* Get results of both decoders */
+	PRINT_STEP("Reading results...");
+	fRet = clEnqueueReadBuffer(queue, errOutK, CL_FALSE, 0, K * I * sizeof(unsigned short), errOut, 0, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (errOutK)"));
+	fRet = clEnqueueReadBuffer(queue, outK, CL_TRUE, 0, K * I * sizeof(unsigned char), out, 0, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (outK)"));
+	PRINT_SUCCESS();
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	STAGEDPOSTAMBLE(r, errOut, out, outC, loopCount);
+	PRINT_SUCCESS();
+
+	/* Print profiling results */
+	long stagedTime = (1000000 * tStagedTime.tv_sec) + tStagedTime.tv_usec;
+	long fusedTime = (1000000 * tFusedTime.tv_sec) + tFusedTime.tv_usec;
+	printf("Elapsed time spent on staged decoder: %ld us; Average time per run: %lf us.\n", stagedTime, stagedTime / (double) runs);
+	if(stagedTime)
+		printf("Throughput (staged): %lf codewords/s (%d per run).\n", (loopCount * (double) runs * 1000000) / stagedTime, loopCount);
+	printf("Elapsed time spent on fused decoder: %ld us; Average time per run: %lf us.\n", fusedTime, fusedTime / (double) runs);
+	if(fusedTime)
+		printf("Throughput (fused): %lf codewords/s (%d per run).\n", (loopCount * (double) runs * 1000000) / fusedTime, loopCount);
+#ifndef STAGED_PROGRAM_BINARY
+	printf("Time spent on program setup: %ld us (staged %s, fused %s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec,
+		programCacheHits[P_STAGED]? "loaded from binary cache" : "built from source", programCacheHits[P_FUSED]? "loaded from binary cache" : "built from source");
+#endif
+
+_err:
+
+	if(queue)
+		clFinish(queue);
+
+	/* Dealloc buffers */
+	if(rK)
+		clReleaseMemObject(rK);
+	if(sK)
+		clReleaseMemObject(sK);
+	if(cK)
+		clReleaseMemObject(cK);
+	if(wK)
+		clReleaseMemObject(wK);
+	if(lAK)
+		clReleaseMemObject(lAK);
+	if(lambdaK)
+		clReleaseMemObject(lambdaK);
+	if(omegaK)
+		clReleaseMemObject(omegaK);
+	if(errLocK)
+		clReleaseMemObject(errLocK);
+	if(alphaInvK)
+		clReleaseMemObject(alphaInvK);
+	if(errCntK)
+		clReleaseMemObject(errCntK);
+	if(errOutK)
+		clReleaseMemObject(errOutK);
+	if(outK)
+		clReleaseMemObject(outK);
+
+	/* Dealloc kernels */
+	if(kernelSyndrome)
+		clReleaseKernel(kernelSyndrome);
+	if(kernelBerlekamp)
+		clReleaseKernel(kernelBerlekamp);
+	if(kernelChien)
+		clReleaseKernel(kernelChien);
+	if(kernelForneys)
+		clReleaseKernel(kernelForneys);
+	if(kernelRsd)
+		clReleaseKernel(kernelRsd);
+
+	/* Dealloc variables */
+	free(r);
+	free(out);
+	free(outC);
+	free(errOut);
+
+	/* Dealloc programs */
+	for(p = 0; p < P_TOTAL; p++) {
+		if(programs[p])
+			clReleaseProgram(programs[p]);
+	}
+	if(programContent)
+		free(programContent);
+	if(programFile)
+		fclose(programFile);
+
+	/* Last OpenCL variables */
+	if(queue)
+		clReleaseCommandQueue(queue);
+	if(context)
+		clReleaseContext(context);
+	if(devices)
+		free(devices);
+	if(platforms)
+		free(platforms);
+
+	return rv;
+}
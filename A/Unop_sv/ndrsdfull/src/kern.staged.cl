@@ -0,0 +1,281 @@
+/* ********************************************************************************************* */
+/* * Reed-Solomon Decoder Kernels (for Altera OpenCL)                                          * */
+/* * Author: André Bannwart Perina                                                             * */
+/* * Deeply based on code available at:                                                        * */
+/* *     http://opencores.org/project,bluespec-reedsolomon                                     * */
+/* *     Copyright (c) 2008 Abhinav Agarwal, Alfred Man Cheuk Ng                               * */
+/* *     Contact: abhiag@gmail.com                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2016 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include "constants.h"
+#include "gfa.h"
+
+#define MAX_ERR 16
+
+/*
+ * Staged decoder (host.staged.c): the kernels of ndrsd4, ndrsd1, ndrsd2 and ndrsd3, in pipeline order.
+ */
+
+/**
+ * @brief Syndrome stage kernel.
+ *
+ * @param loopCount Number of times to process an N bytes block of data.
+ */
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void syndrome(__global unsigned char *r, __global unsigned short *s, unsigned char loopCount) {
+	int gid = get_global_id(0);
+
+	/* Alpha lookup table, loaded as local memory for fast access */
+	unsigned char alpha[256] = {ALPHALUT};
+	/* Auxiliary variables */
+	unsigned int i, j, k;
+
+	if(gid < loopCount) {
+		/* Zero variables */
+		for(i = 0; i < (2 * T); i++)
+			s[i + (gid * (2 * T))] = 0;
+
+		/* Calculate syndrome */
+		for(i = 0; i < N; i++) {
+			for(j = 0; j < (2 * T); j++) {
+				unsigned short res;
+				GFA_MULT(k, res, s[j + (gid * (2 * T))], alpha[j+1]);
+				s[j + (gid * (2 * T))] = res ^ r[i + (gid * N)];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Berlekamp stage kernel.
+ *
+ * @param loopCount Number of times to process an N bytes block of data.
+ */
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void berlekamp(__global unsigned short *s, __global unsigned short *c, __global unsigned short *w, unsigned char loopCount) {
+	int gid = get_global_id(0);
+
+	/* Gallois-field inversion lookup table, loaded as local memory for fast access */
+	unsigned char gfInvLUT[256] = {GFINVLUT};
+	/* Auxiliary variables */
+	unsigned int i, j, k;
+	unsigned short p[T + 2];
+	unsigned short a[T + 2];
+	unsigned short shiftReg[T + 2];
+	unsigned short temp[T + 2];
+	unsigned short t1[T + 2];
+	unsigned short t2[T + 2];
+	unsigned short dStar;
+	unsigned short d;
+	unsigned short ddStar;
+	unsigned short l;
+
+	if(gid < loopCount) {
+		/* Initialise values */
+		c[(gid * (T + 2))] = 1;
+		w[(gid * (T + 2))] = 0;
+		p[0] = 1;
+		a[0] = 1;
+		shiftReg[0] = 0;
+		temp[0] = 0;
+		dStar = 1;
+		d = 0;
+		ddStar = 1;
+		l = 0;
+
+		for(i = 1; i < (T + 2); i++) {
+			c[i + (gid * (T + 2))] = 0;
+			w[i + (gid * (T + 2))] = 0;
+			p[i] = 0;
+			a[i] = 0;
+			t1[i] = 0;
+			t2[i] = 0;
+			shiftReg[i] = 0;
+			temp[i] = 0;
+		}
+
+		for(i = 0; i < (2 * T); i++) {
+			for(j = T + 1; j > 0; j--) {
+				shiftReg[j] = shiftReg[j-1];
+				p[j] = p[j-1];
+				a[j] = a[j-1];
+			}
+			shiftReg[0] = s[i + (gid * (2 * T))];
+			p[0] = 0;
+			a[0] = 0;
+
+			/* GF Mult: array-array */
+			for(j = 0; j < (T + 2); j++) {
+				GFA_MULT(k, temp[j], c[j + (gid * (T + 2))], shiftReg[j]);
+			}
+
+			/* GF Sum: array */
+			d = 0;
+			for(j = 0; j < (T + 2); j++) {
+				GFA_ADD(d, d, temp[j]);
+			}
+
+			if(d) {
+				GFA_MULT(j, ddStar, d, dStar);
+
+				for(j = 0; j < (T + 2); j++) {
+					t1[j] = p[j];
+					t2[j] = a[j];
+				}
+
+				if((i + 1) > (2 * l)) {
+					l = i-l+1;
+
+					for(j = 0; j < (T + 2); j++) {
+						p[j] = c[j + (gid * (T + 2))];
+						a[j] = w[j + (gid * (T + 2))];
+					}
+
+					GFA_INV(gfInvLUT, dStar, d);
+				}
+
+				/* GF Mult: scalar-array */
+				for(j = 0; j < (T + 2); j++) {
+					GFA_MULT(k, temp[j], ddStar, t1[j]);
+				}
+				/* GF Add: array-array */
+				for(j = 0; j < (T + 2); j++) {
+					GFA_ADD(c[j + (gid * (T + 2))], c[j + (gid * (T + 2))], temp[j]);
+				}
+				/* GF Mult: scalar-array */
+				for(j = 0; j < (T + 2); j++) {
+					GFA_MULT(k, temp[j], ddStar, t2[j]);
+				}
+				/* GF Add: array-array */
+				for(j = 0; j < (T + 2); j++) {
+					GFA_ADD(w[j + (gid * (T + 2))], w[j + (gid * (T + 2))], temp[j]);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Chien stage kernel.
+ *
+ * @param loopCount Number of times to process an N bytes block of data.
+ */
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void chien(__global unsigned short *lA, __global unsigned short *errLocOut, __global unsigned short *alphaInvOut, __global unsigned short *errCnt, unsigned char loopCount) {
+	int gid = get_global_id(0);
+
+	/* Alpha lookup table, loaded as local memory for fast access */
+	unsigned char alpha[256] = {ALPHALUT};
+	/* Auxiliary variables */
+	int i, j, k;
+	unsigned short acc;
+	unsigned short alphaInv;
+	unsigned short alphaInvTmp;
+	unsigned short lATmp;
+
+	if(gid < loopCount) {
+		acc = 0;
+		errCnt[gid] = 0;
+		alphaInv = 1;
+
+		for(i = (N - 1); i >= 0; i--) {
+			for(j = 0; j < T; j++) {
+				GFA_MULT(k, lATmp, lA[j + (gid * T)], alpha[j+1]);
+				lA[j + (gid * T)] = lATmp;
+			}
+
+			acc = 1;
+
+			for(j = 0; j < T; j++)
+				GFA_ADD(acc, acc, lA[j + (gid * T)]);
+
+			GFA_MULT(j, alphaInvTmp, alphaInv, 2);
+			alphaInv = alphaInvTmp;
+
+			if((i >= (2 * T)) && (i < (K + (2 * T))) && !acc) {
+				errLocOut[errCnt[gid] + (gid * MAX_ERR)] = i - 2 * T;
+				alphaInvOut[errCnt[gid] + (gid * MAX_ERR)] = alphaInv;
+				errCnt[gid]++;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Forneys stage kernel.
+ *
+ * @param loopCount Number of times to process an N bytes block of data.
+ */
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void forneys(__global unsigned short *lambda, __global unsigned short *omega, __global unsigned short *errCnt, __global unsigned short *errLoc, __global unsigned short *alphaInv, __global unsigned short *errOut, unsigned char loopCount) {
+	int gid = get_global_id(0);
+
+	/* Gallois-field inversion lookup table, loaded as local memory for fast access */
+	unsigned char gfInvLUT[256] = {GFINVLUT};
+	/* Auxiliary variables */
+	int i, j, k;
+	int locIdx;
+	unsigned short lambdaVal;
+	unsigned short omegaVal;
+	unsigned short lambdaDeriv[T];
+	unsigned short errTmp[T];
+	unsigned short tmp;
+
+	if(gid < loopCount) {
+		locIdx = 0;
+		lambdaVal = 0;
+		omegaVal = 0;
+
+		/* Compute deriv */
+		for(i = 0; i < T; i++)
+	        lambdaDeriv[i] = (i % 2)? 0 : lambda[i + (gid * T)];
+
+		for(i = 0; i < T; i++) {
+			/* Poly eval */
+			lambdaVal = 0;
+			for(j = (T - 1); j >= 0; j--) {
+				GFA_MULT(k, tmp, lambdaVal, alphaInv[i + (gid * MAX_ERR)]);
+				GFA_ADD(lambdaVal, tmp, lambdaDeriv[j]);
+			}
+
+			/* Poly eval */
+			omegaVal = 0;
+			for(j = (T - 1); j >= 0; j--) {
+				GFA_MULT(k, tmp, omegaVal, alphaInv[i + (gid * MAX_ERR)]);
+				GFA_ADD(omegaVal, tmp, omega[j + (gid * T)]);
+			}
+
+			/* GF Div */
+			GFA_MULT(j, errTmp[i], omegaVal, gfInvLUT[lambdaVal]);
+		}
+
+		for(i = 0; i < K; i++) {
+			if(((K - 1 - i) == errLoc[locIdx + (gid * MAX_ERR)]) && (locIdx < errCnt[gid])) {
+				errOut[i + (gid * K)] = errTmp[locIdx];
+				locIdx++;
+			}
+			else {
+				errOut[i + (gid * K)] = 0;
+			}
+		}
+	}
+}
@@ -1,4 +1,4 @@
-#include "list.h"
+#include "records.h"
 
 #define NUM_RECORDS 42764
 #define RESULTS_COUNT 5
@@ -6,59 +6,29 @@
 #define LNG 90
 #define FILELIST_FILENAME "filelist"
 #define OUTPUT_FILENAME "out"
-#define REC_LEN 49
+/* Top-K kernels select at most one less than their work-group size (TOPK_GROUP_SIZE in kern.cl) */
+#define TOPK_MAX 255
+#define QUERIES_FILENAME "queries"
+/* Batches of random queries when QUERIES_FILENAME is not present */
+#define NUM_BATCHES 10
 
-FILE *gFList = NULL;
-FILE *gFp = NULL;
 FILE *outFp = NULL;
-list_t *gRecStringList = NULL;
+records_t *gRecords = NULL;
+FILE *gQueriesFp = NULL;
+cl_float2 gQueryMin;
+cl_float2 gQueryMax;
+unsigned int gQuerySeed = 1;
+int gBatch = 0;
+int gBatchLen = 0;
+
+/* Loads up to count records listed in FILELIST_FILENAME into d_locations and gRecords */
+#define LOADRECORDS(d_locations, count) {\
+	gRecords = records_load(FILELIST_FILENAME, d_locations, count);\
+	ASSERT_CALL(gRecords, rv = EXIT_FAILURE);\
+}
 
 #define PREAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng) {\
-	int _i, _j;\
-	char _dbName[64];\
-	int _recNum = 0;\
-\
-	gRecStringList = slist_create();\
-\
-	gFList = fopen(FILELIST_FILENAME, "r");\
-	ASSERT_CALL(gFList, rv = EXIT_FAILURE);\
-\
-	_i = 0;\
-	while(!feof(gFList)) {\
-		ASSERT_CALL(1 == fscanf(gFList, "%s\n", _dbName), rv = EXIT_FAILURE);\
-\
-		gFp = fopen(_dbName, "r");\
-		ASSERT_CALL(gFp, rv = EXIT_FAILURE);\
-\
-		for(; _i < NUM_RECORDS; _i++) {\
-			char _recString[REC_LEN];\
-			char _subStr[6];\
-\
-			fgets(_recString, 49, gFp);\
-			fgetc(gFp);\
-\
-			if(feof(gFp))\
-				break;\
-\
-			for(_j = 0; _j < 5; _j++)\
-				_subStr[_j] = *(_recString + _j + 28);\
-			_subStr[5] = '\0';\
-			d_locations[_i].x = atof(_subStr);\
-\
-			for(_j = 0; _j < 5; _j++)\
-				_subStr[_j] = *(_recString + _j + 33);\
-			_subStr[5] = '\0';\
-			d_locations[_i].y = atof(_subStr);\
-\
-			slist_pushBack(gRecStringList, _recString);\
-		}\
-\
-		fclose(gFp);\
-		gFp = NULL;\
-	}\
-\
-	fclose(gFList);\
-	gFList = NULL;\
+	LOADRECORDS(d_locations, NUM_RECORDS);\
 \
 	lat = LAT;\
 	lng = LNG;\
@@ -68,8 +38,6 @@ list_t *gRecStringList = NULL;
 	int _i, _j;\
 	float _val;\
 	int _minLoc;\
-	char *_tmpRecString;\
-	char *_tmpRecStringAllocd;\
 	float _tempDist;\
 \
 	for(_i = 0; _i < RESULTS_COUNT; _i++) {\
@@ -82,12 +50,7 @@ list_t *gRecStringList = NULL;
 				_minLoc = _j;\
 		}\
 \
-		_tmpRecString = slist_get(gRecStringList, _i);\
-		_tmpRecStringAllocd = malloc(strlen(_tmpRecString) + 1);\
-		strcpy(_tmpRecStringAllocd, _tmpRecString);\
-		slist_swap(gRecStringList, _i, slist_get(gRecStringList, _minLoc));\
-		slist_swap(gRecStringList, _minLoc, _tmpRecStringAllocd);\
-		free(_tmpRecStringAllocd);\
+		records_swap(gRecords, _i, _minLoc);\
 \
 		_tempDist = d_distances[_i];\
 		d_distances[_i] = d_distances[_minLoc];\
@@ -98,22 +61,101 @@ list_t *gRecStringList = NULL;
 	outFp = fopen(OUTPUT_FILENAME, "w");\
 \
 	for(_i = 0; _i < RESULTS_COUNT; _i++)\
-		fprintf(outFp, "%s %f\n", slist_get(gRecStringList, _i), d_distances[_i]);\
+		fprintf(outFp, "%.*s %f\n", RECORDS_TEXT_LEN, records_get(gRecords, _i), d_distances[_i]);\
 \
 	fclose(outFp);\
 	outFp = NULL;\
 }
 
-#define CLEANUP(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng) {\
-	if(gFList)\
-		fclose(gFList);\
+#define TOPKPREAMBLE(d_locations, d_locationsSz, numRecords, topK) {\
+	ASSERT_CALL((topK >= 1) && (topK <= TOPK_MAX), fprintf(stderr, "Error: topK must be between 1 and %d.\n", TOPK_MAX); rv = EXIT_FAILURE);\
 \
-	if(gFp)\
-		fclose(gFp);\
+	LOADRECORDS(d_locations, numRecords);\
+}
+
+#define TOPKPOSTAMBLE(d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK) {\
+	int _i;\
 \
+	outFp = fopen(OUTPUT_FILENAME, "w");\
+	ASSERT_CALL(outFp, rv = EXIT_FAILURE);\
+\
+	/* Results come sorted from the device, with -1 indices when there are less than topK records */\
+	for(_i = 0; _i < topK && d_resultIndices[_i] >= 0; _i++)\
+		fprintf(outFp, "%.*s %f\n", RECORDS_TEXT_LEN, records_get(gRecords, d_resultIndices[_i]), d_resultDistances[_i]);\
+\
+	fclose(outFp);\
+	outFp = NULL;\
+}
+
+#define BATCHPREAMBLE(d_locations, d_locationsSz, numRecords, d_queriesSz, topK, loopFlag) {\
+	int _i;\
+\
+	ASSERT_CALL((topK >= 1) && (topK <= TOPK_MAX), fprintf(stderr, "Error: topK must be between 1 and %d.\n", TOPK_MAX); rv = EXIT_FAILURE);\
+	ASSERT_CALL(d_queriesSz >= 1, fprintf(stderr, "Error: at least one query per batch is needed.\n"); rv = EXIT_FAILURE);\
+\
+	LOADRECORDS(d_locations, numRecords);\
+\
+	/* Random queries are drawn from the bounding box of the records */\
+	gQueryMin = gQueryMax = d_locations[0];\
+	for(_i = 1; _i < numRecords; _i++) {\
+		gQueryMin.x = (d_locations[_i].x < gQueryMin.x)? d_locations[_i].x : gQueryMin.x;\
+		gQueryMin.y = (d_locations[_i].y < gQueryMin.y)? d_locations[_i].y : gQueryMin.y;\
+		gQueryMax.x = (d_locations[_i].x > gQueryMax.x)? d_locations[_i].x : gQueryMax.x;\
+		gQueryMax.y = (d_locations[_i].y > gQueryMax.y)? d_locations[_i].y : gQueryMax.y;\
+	}\
+\
+	gQueriesFp = fopen(QUERIES_FILENAME, "r");\
+	outFp = fopen(OUTPUT_FILENAME, "w");\
+	ASSERT_CALL(outFp, rv = EXIT_FAILURE);\
+\
+	loopFlag = true;\
+}
+
+/* Leaves the loop (break) when there are no queries left */
+#define BATCHLOOPPREAMBLE(d_queries, d_queriesSz, loopFlag) {\
+	int _i;\
+\
+	gBatchLen = 0;\
+	if(gQueriesFp) {\
+		while((gBatchLen < d_queriesSz) && (2 == fscanf(gQueriesFp, "%f %f", &(d_queries[gBatchLen].x), &(d_queries[gBatchLen].y))))\
+			gBatchLen++;\
+	}\
+	else if(gBatch < NUM_BATCHES) {\
+		for(; gBatchLen < d_queriesSz; gBatchLen++) {\
+			d_queries[gBatchLen].x = gQueryMin.x + (gQueryMax.x - gQueryMin.x) * (rand_r(&gQuerySeed) / (float) RAND_MAX);\
+			d_queries[gBatchLen].y = gQueryMin.y + (gQueryMax.y - gQueryMin.y) * (rand_r(&gQuerySeed) / (float) RAND_MAX);\
+		}\
+	}\
+\
+	if(!gBatchLen)\
+		break;\
+	rt_setItems(gBatchLen);\
+\
+	/* A partial last batch repeats its last query */\
+	for(_i = gBatchLen; _i < d_queriesSz; _i++)\
+		d_queries[_i] = d_queries[gBatchLen - 1];\
+}
+
+#define BATCHLOOPPOSTAMBLE(d_queries, d_queriesSz, d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK, loopFlag) {\
+	int _i, _j;\
+\
+	/* Each query is written as a header line followed by its nearest records, as in TOPKPOSTAMBLE */\
+	for(_i = 0; _i < gBatchLen; _i++) {\
+		fprintf(outFp, "# %f %f\n", d_queries[_i].x, d_queries[_i].y);\
+		for(_j = 0; _j < topK && d_resultIndices[_i * topK + _j] >= 0; _j++)\
+			fprintf(outFp, "%.*s %f\n", RECORDS_TEXT_LEN, records_get(gRecords, d_resultIndices[_i * topK + _j]), d_resultDistances[_i * topK + _j]);\
+	}\
+\
+	gBatch++;\
+}
+
+#define CLEANUP(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng) {\
 	if(outFp)\
 		fclose(outFp);\
 \
-	if(gRecStringList)\
-		slist_destroy(&gRecStringList);\
+	if(gQueriesFp)\
+		fclose(gQueriesFp);\
+\
+	if(gRecords)\
+		records_destroy(&gRecords);\
 }
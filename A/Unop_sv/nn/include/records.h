@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RECORDS_H
+#define RECORDS_H
+
+#include <CL/opencl.h>
+#include <stddef.h>
+
+/* Records are fixed-width lines: RECORDS_TEXT_LEN characters followed by a newline */
+#define RECORDS_TEXT_LEN 48
+#define RECORDS_STRIDE 49
+
+/* Latitude and longitude are right-aligned decimal fields inside the record text */
+#define RECORDS_LAT_POS 28
+#define RECORDS_LNG_POS 33
+#define RECORDS_FIELD_LEN 5
+
+/* Parser threads are capped, and each one parses at least RECORDS_MIN_CHUNK records */
+#define RECORDS_MAX_THREADS 64
+#define RECORDS_MIN_CHUNK 8192
+
+typedef struct {
+	char *data;
+	size_t size;
+	unsigned int first;
+	unsigned int count;
+} records_map_t;
+
+/* Record texts point into the mapped files and are not null-terminated */
+typedef struct {
+	unsigned int count;
+	unsigned int mapsLen;
+	records_map_t *maps;
+	const char **text;
+} records_t;
+
+records_t *records_load(const char *fileList, cl_float2 *locations, unsigned int count);
+void records_destroy(records_t **records);
+const char *records_get(records_t *records, unsigned int pos);
+void records_swap(records_t *records, unsigned int pos1, unsigned int pos2);
+
+#endif
@@ -0,0 +1,214 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+ *            POSTAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+ *            LOOPPREAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng, loopFlag);
+ *            LOOPPOSTAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng, loopFlag);
+ *            CLEANUP(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+ *        and, when running the top-K description (kern.topk.xml):
+ *            TOPKPREAMBLE(d_locations, d_locationsSz, numRecords, topK);
+ *            TOPKPOSTAMBLE(d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK);
+ *        and, when running the batched description (kern.batch.xml):
+ *            BATCHPREAMBLE(d_locations, d_locationsSz, numRecords, d_queriesSz, topK, loopFlag);
+ *            BATCHLOOPPREAMBLE(d_queries, d_queriesSz, loopFlag);
+ *            BATCHLOOPPOSTAMBLE(d_queries, d_queriesSz, d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK, loopFlag);
+ *        where:
+ *            d_locations: variable (cl_float2 *);
+ *            d_locationsSz: number of members in variable (unsigned int);
+ *            d_distances: variable (float *);
+ *            d_distancesSz: number of members in variable (unsigned int);
+ *            numRecords: variable (int);
+ *            lat: variable (float);
+ *            lng: variable (float);
+ *            d_resultIndices: variable (int *);
+ *            d_resultIndicesSz: number of members in variable (unsigned int);
+ *            d_resultDistances: variable (float *);
+ *            d_resultDistancesSz: number of members in variable (unsigned int);
+ *            topK: variable (int);
+ *            d_queries: variable (cl_float2 *);
+ *            d_queriesSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static cl_float2 *d_locations = NULL;
+static unsigned int d_locationsSz = 0;
+static float *d_distances = NULL;
+static unsigned int d_distancesSz = 0;
+static int numRecords;
+static float lat;
+static float lng;
+
+/* Top-K description (kern.topk.xml) variables */
+static int *d_partialIndices = NULL;
+static unsigned int d_partialIndicesSz = 0;
+static float *d_partialDistances = NULL;
+static unsigned int d_partialDistancesSz = 0;
+static int *d_resultIndices = NULL;
+static unsigned int d_resultIndicesSz = 0;
+static float *d_resultDistances = NULL;
+static unsigned int d_resultDistancesSz = 0;
+static int numPartials;
+static int topK;
+
+/* Batched description (kern.batch.xml) variables */
+static cl_float2 *d_queries = NULL;
+static unsigned int d_queriesSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeNearestneighbor = NULL;
+static size_t *localSizeNearestneighbor = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(d_locations),
+	RT_BIND_POINTER(d_distances),
+	RT_BIND_VALUE(numRecords),
+	RT_BIND_VALUE(lat),
+	RT_BIND_VALUE(lng),
+	RT_BIND_POINTER(d_partialIndices),
+	RT_BIND_POINTER(d_partialDistances),
+	RT_BIND_POINTER(d_resultIndices),
+	RT_BIND_POINTER(d_resultDistances),
+	RT_BIND_VALUE(numPartials),
+	RT_BIND_VALUE(topK),
+	RT_BIND_POINTER(d_queries),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(NearestNeighbor, Nearestneighbor),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	if(d_queries) {
+		BATCHPREAMBLE(d_locations, d_locationsSz, numRecords, d_queriesSz, topK, loopFlag);
+	}
+	else if(d_resultIndices) {
+		TOPKPREAMBLE(d_locations, d_locationsSz, numRecords, topK);
+	}
+	else {
+		PREAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	if(!d_queries)
+		return EXIT_SUCCESS;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		BATCHLOOPPREAMBLE(d_queries, d_queriesSz, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	if(!d_queries)
+		return EXIT_SUCCESS;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	BATCHLOOPPOSTAMBLE(d_queries, d_queriesSz, d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	if(d_queries) {
+		/* Results of each batch were written by the loop postamble */
+	}
+	else if(d_resultIndices) {
+		TOPKPOSTAMBLE(d_resultIndices, d_resultIndicesSz, d_resultDistances, d_resultDistancesSz, topK);
+	}
+	else {
+		POSTAMBLE(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(d_locations, d_locationsSz, d_distances, d_distancesSz, numRecords, lat, lng);
+}
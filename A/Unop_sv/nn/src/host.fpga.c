@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNearestneighbor = NULL;
+	cl_command_queue transferQueueNearestneighbor = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -103,6 +104,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
 	cl_uint workDimNearestneighbor = 1;
 	size_t globalSizeNearestneighbor[1] = {
 		42816
@@ -148,7 +150,13 @@ int main(void) {
 
 	/* Create command queue for NearestNeighbor kernel */
 	PRINT_STEP("Creating command queue for \"NearestNeighbor\"...");
-	queueNearestneighbor = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNearestneighbor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for NearestNeighbor kernel */
+	PRINT_STEP("Creating transfer command queue for \"NearestNeighbor\"...");
+	transferQueueNearestneighbor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -213,9 +221,9 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNearestneighbor, d_locationsK, CL_TRUE, 0, 42764 * sizeof(cl_float2), d_locations, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNearestneighbor, d_locationsK, TRANSFER_BLOCKING, 0, 42764 * sizeof(cl_float2), d_locations, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_locations"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_locationsK)"));
-		fRet = clEnqueueWriteBuffer(queueNearestneighbor, d_distancesK, CL_TRUE, 0, 42764 * sizeof(float), d_distances, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNearestneighbor, d_distancesK, TRANSFER_BLOCKING, 0, 42764 * sizeof(float), d_distances, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_distances"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_distancesK)"));
 		fRet = clSetKernelArg(kernelNearestneighbor, 2, sizeof(int), &numRecords);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (numRecords)"));
@@ -226,8 +234,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNearestneighbor);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNearestneighbor, kernelNearestneighbor, workDimNearestneighbor, NULL, globalSizeNearestneighbor, NULL, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNearestneighbor, kernelNearestneighbor, workDimNearestneighbor, NULL, globalSizeNearestneighbor, NULL, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "NearestNeighbor"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNearestneighbor);
 		gettimeofday(&tNow, NULL);
@@ -235,9 +244,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNearestneighbor, d_distancesK, CL_TRUE, 0, 42764 * sizeof(float), d_distances, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNearestneighbor, d_distancesK, TRANSFER_BLOCKING, 0, 42764 * sizeof(float), d_distances, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_distances"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -252,6 +263,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -260,6 +272,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_locationsK)
 		clReleaseMemObject(d_locationsK);
@@ -285,6 +300,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNearestneighbor)
 		clReleaseCommandQueue(queueNearestneighbor);
+	if(transferQueueNearestneighbor)
+		clReleaseCommandQueue(transferQueueNearestneighbor);
 
 	/* Last OpenCL variables */
 	if(context)
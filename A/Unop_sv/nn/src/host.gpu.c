@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNearestneighbor = NULL;
+	cl_command_queue transferQueueNearestneighbor = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -101,8 +102,10 @@ int main(void) {
 	cl_kernel kernelNearestneighbor = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimNearestneighbor = 1;
 	size_t globalSizeNearestneighbor[1] = {
 		42816
@@ -148,7 +151,13 @@ int main(void) {
 
 	/* Create command queue for NearestNeighbor kernel */
 	PRINT_STEP("Creating command queue for \"NearestNeighbor\"...");
-	queueNearestneighbor = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNearestneighbor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for NearestNeighbor kernel */
+	PRINT_STEP("Creating transfer command queue for \"NearestNeighbor\"...");
+	transferQueueNearestneighbor = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -169,18 +178,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create NearestNeighbor kernel */
 	PRINT_STEP("Creating kernel \"NearestNeighbor\" from program...");
 	kernelNearestneighbor = clCreateKernel(program, "NearestNeighbor", &fRet);
@@ -212,9 +234,9 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNearestneighbor, d_locationsK, CL_TRUE, 0, 42764 * sizeof(cl_float2), d_locations, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNearestneighbor, d_locationsK, TRANSFER_BLOCKING, 0, 42764 * sizeof(cl_float2), d_locations, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_locations"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_locationsK)"));
-		fRet = clEnqueueWriteBuffer(queueNearestneighbor, d_distancesK, CL_TRUE, 0, 42764 * sizeof(float), d_distances, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNearestneighbor, d_distancesK, TRANSFER_BLOCKING, 0, 42764 * sizeof(float), d_distances, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_distances"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_distancesK)"));
 		fRet = clSetKernelArg(kernelNearestneighbor, 2, sizeof(int), &numRecords);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (numRecords)"));
@@ -225,8 +247,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNearestneighbor);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNearestneighbor, kernelNearestneighbor, workDimNearestneighbor, NULL, globalSizeNearestneighbor, NULL, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNearestneighbor, kernelNearestneighbor, workDimNearestneighbor, NULL, globalSizeNearestneighbor, NULL, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "NearestNeighbor"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNearestneighbor);
 		gettimeofday(&tNow, NULL);
@@ -234,9 +257,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNearestneighbor, d_distancesK, CL_TRUE, 0, 42764 * sizeof(float), d_distances, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNearestneighbor, d_distancesK, TRANSFER_BLOCKING, 0, 42764 * sizeof(float), d_distances, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_distances"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -251,6 +276,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -259,6 +286,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_locationsK)
 		clReleaseMemObject(d_locationsK);
@@ -284,6 +314,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNearestneighbor)
 		clReleaseCommandQueue(queueNearestneighbor);
+	if(transferQueueNearestneighbor)
+		clReleaseCommandQueue(transferQueueNearestneighbor);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -26,6 +26,14 @@
 
 //#pragma OPENCL EXTENSION cl_khr_byte_addressable_store : enable
 
+// When split across devices by the shared runtime, d_locations and d_distances
+// only hold the partition of this device, which starts at the global offset
+#ifdef RT_SPLIT
+#define SPLIT_OFFSET get_global_offset(0)
+#else
+#define SPLIT_OFFSET 0
+#endif
+
 __kernel void NearestNeighbor(__global float2 *d_locations,
 							  __global float *d_distances,
 							  const int numRecords,
@@ -34,9 +42,156 @@ __kernel void NearestNeighbor(__global float2 *d_locations,
 	 int globalId = get_global_id(0);
 							  
      if (globalId < numRecords) {
-         __global float2 *latLong = d_locations+globalId;
+         __global float2 *latLong = d_locations+globalId-SPLIT_OFFSET;
     
-         __global float *dist=d_distances+globalId;
+         __global float *dist=d_distances+globalId-SPLIT_OFFSET;
          *dist = (float)sqrt((lat-latLong->x)*(lat-latLong->x)+(lng-latLong->y)*(lng-latLong->y));
 	 }
 }
+
+#ifndef TOPK_GROUP_SIZE
+#define TOPK_GROUP_SIZE 256
+#endif
+
+// Selects the k smallest distances of the local array, one per round, through
+// an argmin reduction. Ties are resolved by the lowest position, and selected
+// entries are replaced by INFINITY. Must be called by the whole work-group.
+void selectTopK(__local float *dist, __local int *index, __local float *redDist, __local int *redPos,
+				__global int *outIndices, __global float *outDistances, int k) {
+	int lid = get_local_id(0);
+
+	for (int r = 0; r < k; r++) {
+		redDist[lid] = dist[lid];
+		redPos[lid] = lid;
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		for (int s = TOPK_GROUP_SIZE / 2; s > 0; s >>= 1) {
+			if (lid < s && (redDist[lid + s] < redDist[lid] || (redDist[lid + s] == redDist[lid] && redPos[lid + s] < redPos[lid]))) {
+				redDist[lid] = redDist[lid + s];
+				redPos[lid] = redPos[lid + s];
+			}
+			barrier(CLK_LOCAL_MEM_FENCE);
+		}
+
+		if (0 == lid) {
+			int pos = redPos[0];
+			outDistances[r] = redDist[0];
+			outIndices[r] = isinf(redDist[0]) ? -1 : index[pos];
+			dist[pos] = INFINITY;
+		}
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+}
+
+// Same distances as NearestNeighbor, but each work-group only writes its topK
+// nearest records (index and distance) to the partial buffers.
+__attribute__((reqd_work_group_size(TOPK_GROUP_SIZE,1,1)))
+__kernel void NearestNeighborTopK(__global float2 *d_locations,
+								  __global int *d_partialIndices,
+								  __global float *d_partialDistances,
+								  const int numRecords,
+								  const float lat,
+								  const float lng,
+								  const int topK) {
+	__local float dist[TOPK_GROUP_SIZE];
+	__local int index[TOPK_GROUP_SIZE];
+	__local float redDist[TOPK_GROUP_SIZE];
+	__local int redPos[TOPK_GROUP_SIZE];
+	int globalId = get_global_id(0);
+	int lid = get_local_id(0);
+	int offset = get_group_id(0) * topK;
+
+	if (globalId < numRecords) {
+		float2 latLong = d_locations[globalId];
+		dist[lid] = (float)sqrt((lat-latLong.x)*(lat-latLong.x)+(lng-latLong.y)*(lng-latLong.y));
+	}
+	else {
+		dist[lid] = INFINITY;
+	}
+	index[lid] = globalId;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	selectTopK(dist, index, redDist, redPos, d_partialIndices + offset, d_partialDistances + offset, topK);
+}
+
+// Batched variant of NearestNeighborTopK over a 2D NDRange (records x
+// queries): work-item (i, q) computes the distance from record i to query q,
+// and the topK partials of query q are stored contiguously.
+__attribute__((reqd_work_group_size(TOPK_GROUP_SIZE,1,1)))
+__kernel void NearestNeighborBatchTopK(__global float2 *d_locations,
+									   __global float2 *d_queries,
+									   __global int *d_partialIndices,
+									   __global float *d_partialDistances,
+									   const int numRecords,
+									   const int topK) {
+	__local float dist[TOPK_GROUP_SIZE];
+	__local int index[TOPK_GROUP_SIZE];
+	__local float redDist[TOPK_GROUP_SIZE];
+	__local int redPos[TOPK_GROUP_SIZE];
+	int globalId = get_global_id(0);
+	int lid = get_local_id(0);
+	int offset = (get_group_id(1) * get_num_groups(0) + get_group_id(0)) * topK;
+	float2 query = d_queries[get_global_id(1)];
+
+	if (globalId < numRecords) {
+		float2 latLong = d_locations[globalId];
+		dist[lid] = (float)sqrt((query.x-latLong.x)*(query.x-latLong.x)+(query.y-latLong.y)*(query.y-latLong.y));
+	}
+	else {
+		dist[lid] = INFINITY;
+	}
+	index[lid] = globalId;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	selectTopK(dist, index, redDist, redPos, d_partialIndices + offset, d_partialDistances + offset, topK);
+}
+
+// Merges the partial results of all work-groups into the final topK nearest
+// records. Must be launched as a single work-group per query (second
+// dimension), with topK smaller than TOPK_GROUP_SIZE.
+__attribute__((reqd_work_group_size(TOPK_GROUP_SIZE,1,1)))
+__kernel void MergeTopK(__global int *d_partialIndices,
+						__global float *d_partialDistances,
+						const int numPartials,
+						const int topK,
+						__global int *d_resultIndices,
+						__global float *d_resultDistances) {
+	__local float dist[TOPK_GROUP_SIZE];
+	__local int index[TOPK_GROUP_SIZE];
+	__local float redDist[TOPK_GROUP_SIZE];
+	__local int redPos[TOPK_GROUP_SIZE];
+	int lid = get_local_id(0);
+	int merged = 0;
+	int next = 0;
+
+	d_partialIndices += get_group_id(1) * numPartials;
+	d_partialDistances += get_group_id(1) * numPartials;
+	d_resultIndices += get_group_id(1) * topK;
+	d_resultDistances += get_group_id(1) * topK;
+
+	// Partials are merged one chunk at a time: the current results occupy the
+	// first topK entries and the remaining entries are filled from the partials
+	while (next < numPartials) {
+		int p = next + lid - merged;
+
+		if (lid < merged) {
+			dist[lid] = d_resultDistances[lid];
+			index[lid] = d_resultIndices[lid];
+		}
+		else if (p < numPartials) {
+			dist[lid] = d_partialDistances[p];
+			index[lid] = d_partialIndices[p];
+		}
+		else {
+			dist[lid] = INFINITY;
+			index[lid] = -1;
+		}
+		barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+
+		selectTopK(dist, index, redDist, redPos, d_resultIndices, d_resultDistances, topK);
+		barrier(CLK_GLOBAL_MEM_FENCE);
+
+		next += TOPK_GROUP_SIZE - merged;
+		merged = topK;
+	}
+}
@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "records.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAX_NAME_SZ 256
+
+typedef struct {
+	records_t *records;
+	cl_float2 *locations;
+	unsigned int first;
+	unsigned int last;
+	unsigned int invalid;
+} records_chunk_t;
+
+/**
+ * @brief Parse a right-aligned decimal field (e.g. " 66.5" or "334.3"). The mantissa is divided by a power of ten in
+ *        double precision, which rounds the same way as atof does.
+ */
+float _records_parseField(const char *field) {
+	unsigned int c;
+	long long mantissa = 0;
+	double scale = 1;
+	bool negative = false;
+	bool fraction = false;
+	bool started = false;
+
+	for(c = 0; c < RECORDS_FIELD_LEN; c++) {
+		char ch = field[c];
+
+		if(' ' == ch && !started)
+			continue;
+
+		if('-' == ch && !started) {
+			negative = true;
+		}
+		else if('.' == ch && !fraction) {
+			fraction = true;
+		}
+		else if(ch >= '0' && ch <= '9') {
+			mantissa = mantissa * 10 + (ch - '0');
+			if(fraction)
+				scale *= 10;
+		}
+		else {
+			break;
+		}
+
+		started = true;
+	}
+
+	return (negative? -mantissa : mantissa) / scale;
+}
+
+void *_records_parseChunk(void *arg) {
+	records_chunk_t *chunk = arg;
+	records_t *records = chunk->records;
+	records_map_t *map = records->maps;
+	unsigned int i;
+
+	for(i = chunk->first; i < chunk->last; i++) {
+		size_t offset;
+
+		while(i >= map->first + map->count)
+			map++;
+
+		/* Last record of a file may lack its newline */
+		offset = (size_t) (i - map->first) * RECORDS_STRIDE;
+		if((offset + RECORDS_TEXT_LEN < map->size) && ('\n' != map->data[offset + RECORDS_TEXT_LEN]))
+			chunk->invalid++;
+
+		records->text[i] = map->data + offset;
+		chunk->locations[i].x = _records_parseField(map->data + offset + RECORDS_LAT_POS);
+		chunk->locations[i].y = _records_parseField(map->data + offset + RECORDS_LNG_POS);
+	}
+
+	return NULL;
+}
+
+int _records_map(records_map_t *map, const char *name) {
+	struct stat st;
+	int fd = open(name, O_RDONLY);
+
+	if(-1 == fd)
+		return -1;
+
+	if(-1 == fstat(fd, &st)) {
+		close(fd);
+		return -1;
+	}
+
+	map->size = st.st_size;
+	map->data = NULL;
+	if(map->size) {
+		map->data = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(MAP_FAILED == map->data) {
+			map->data = NULL;
+			close(fd);
+			return -1;
+		}
+
+		madvise(map->data, map->size, MADV_WILLNEED);
+	}
+
+	close(fd);
+	return 0;
+}
+
+records_t *records_load(const char *fileList, cl_float2 *locations, unsigned int count) {
+	char name[MAX_NAME_SZ];
+	unsigned int mapsCap = 0;
+	unsigned int t, threadsLen;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_t threads[RECORDS_MAX_THREADS];
+	bool started[RECORDS_MAX_THREADS] = {false};
+	records_chunk_t chunks[RECORDS_MAX_THREADS];
+	records_t *records = calloc(1, sizeof(records_t));
+	FILE *listFile = fopen(fileList, "r");
+
+	if(!records || !listFile) {
+		fprintf(stderr, "Error: %s: %s\n", strerror(errno), fileList);
+		goto _err;
+	}
+
+	/* Files are mapped in the order they are listed, until enough records are found */
+	while((records->count < count) && (1 == fscanf(listFile, "%255s", name))) {
+		records_map_t *map;
+
+		if(records->mapsLen == mapsCap) {
+			mapsCap = mapsCap? 2 * mapsCap : 8;
+			map = realloc(records->maps, mapsCap * sizeof(records_map_t));
+			if(!map) {
+				fprintf(stderr, "Error: %s: %s\n", strerror(errno), name);
+				goto _err;
+			}
+			records->maps = map;
+		}
+
+		map = &(records->maps[records->mapsLen]);
+		if(_records_map(map, name)) {
+			fprintf(stderr, "Error: %s: %s\n", strerror(errno), name);
+			goto _err;
+		}
+		records->mapsLen++;
+
+		map->first = records->count;
+		map->count = (map->size + 1) / RECORDS_STRIDE;
+		if(map->count > count - records->count)
+			map->count = count - records->count;
+		records->count += map->count;
+	}
+
+	fclose(listFile);
+	listFile = NULL;
+
+	/* Every location is bound to a record: a shorter database would leave part of the buffer undefined */
+	if(records->count < count) {
+		fprintf(stderr, "Error: %s lists %u record(s), %u expected.\n", fileList, records->count, count);
+		goto _err;
+	}
+
+	records->text = malloc((records->count? records->count : 1) * sizeof(char *));
+	if(!records->text) {
+		fprintf(stderr, "Error: %s: %s\n", strerror(errno), fileList);
+		goto _err;
+	}
+
+	/* Records are split in contiguous chunks, one per thread */
+	threadsLen = records->count / RECORDS_MIN_CHUNK;
+	if((cpus > 0) && (threadsLen > (unsigned long) cpus))
+		threadsLen = cpus;
+	if(threadsLen > RECORDS_MAX_THREADS)
+		threadsLen = RECORDS_MAX_THREADS;
+	if(!threadsLen)
+		threadsLen = 1;
+
+	for(t = 0; t < threadsLen; t++) {
+		chunks[t].records = records;
+		chunks[t].locations = locations;
+		chunks[t].first = ((unsigned long long) records->count * t) / threadsLen;
+		chunks[t].last = ((unsigned long long) records->count * (t + 1)) / threadsLen;
+		chunks[t].invalid = 0;
+	}
+
+	/* First chunk is parsed by the calling thread, as well as any chunk whose thread could not be created */
+	for(t = 1; t < threadsLen; t++)
+		started[t] = !pthread_create(&threads[t], NULL, _records_parseChunk, &chunks[t]);
+	_records_parseChunk(&chunks[0]);
+	for(t = 1; t < threadsLen; t++) {
+		if(started[t])
+			pthread_join(threads[t], NULL);
+		else
+			_records_parseChunk(&chunks[t]);
+	}
+
+	for(t = 1; t < threadsLen; t++)
+		chunks[0].invalid += chunks[t].invalid;
+	if(chunks[0].invalid) {
+		fprintf(stderr, "Error: %u record(s) listed in %s are not %d characters long.\n", chunks[0].invalid, fileList, RECORDS_TEXT_LEN);
+		goto _err;
+	}
+
+	return records;
+
+_err:
+	if(listFile)
+		fclose(listFile);
+	if(records)
+		records_destroy(&records);
+
+	return NULL;
+}
+
+void records_destroy(records_t **records) {
+	unsigned int m;
+
+	for(m = 0; m < (*records)->mapsLen; m++) {
+		if((*records)->maps[m].data)
+			munmap((*records)->maps[m].data, (*records)->maps[m].size);
+	}
+
+	free((*records)->maps);
+	free((*records)->text);
+	free(*records);
+	*records = NULL;
+}
+
+const char *records_get(records_t *records, unsigned int pos) {
+	return records->text[pos];
+}
+
+void records_swap(records_t *records, unsigned int pos1, unsigned int pos2) {
+	const char *tmp = records->text[pos1];
+
+	records->text[pos1] = records->text[pos2];
+	records->text[pos2] = tmp;
+}
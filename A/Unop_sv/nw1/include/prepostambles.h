@@ -1,12 +1,7 @@
 #include <stdlib.h>
 #include <time.h>
 
-#define MAX_COLS 2048
-#define MAX_ROWS 2048
-#define MAX_COLS_P (MAX_COLS + 1)
-#define MAX_ROWS_P (MAX_ROWS + 1)
 #define BLOCK_SIZE 16
-#define WORKSIZE 2048
 
 int gBlosum62[24][24] = {
 	{ 4, -1, -2, -2,  0, -1, -1,  0, -2, -1, -1, -1, -1, -2, -1,  1,  0, -3, -2,  0, -2, -1,  0, -4},
@@ -42,24 +37,24 @@ int gBlosum62[24][24] = {
 \
 	srand(time(NULL));\
 \
-	for(_i = 0; _i < MAX_COLS_P; _i++)\
-		for(_j = 0; _j < MAX_ROWS_P; _j++)\
-			input_itemsets_d[_i * MAX_COLS_P + _j] = 0;\
+	for(_i = 0; _i < cols; _i++)\
+		for(_j = 0; _j < cols; _j++)\
+			input_itemsets_d[_i * cols + _j] = 0;\
 \
-	for(_i = 1; _i < MAX_ROWS_P; _i++)\
-		input_itemsets_d[_i * MAX_COLS_P] = rand() % 10 + 1;\
+	for(_i = 1; _i < cols; _i++)\
+		input_itemsets_d[_i * cols] = rand() % 10 + 1;\
 \
-	for(_i = 1; _i < MAX_COLS_P; _i++)\
+	for(_i = 1; _i < cols; _i++)\
 		input_itemsets_d[_i] = rand() % 10 + 1;\
 \
-	for(_i = 1; _i < MAX_COLS_P; _i++)\
-		for(_j = 1; _j < MAX_ROWS_P; _j++)\
-			reference_d[_i * MAX_COLS_P + _j] = gBlosum62[input_itemsets_d[_i * MAX_COLS_P]][input_itemsets_d[_j]];\
+	for(_i = 1; _i < cols; _i++)\
+		for(_j = 1; _j < cols; _j++)\
+			reference_d[_i * cols + _j] = gBlosum62[input_itemsets_d[_i * cols]][input_itemsets_d[_j]];\
 \
-	for(_i = 1; _i < MAX_ROWS_P; _i++)\
-		input_itemsets_d[_i * MAX_COLS_P] = -_i * penalty;\
+	for(_i = 1; _i < cols; _i++)\
+		input_itemsets_d[_i * cols] = -_i * penalty;\
 \
-	for(_i = 1; _i < MAX_COLS_P; _i++)\
+	for(_i = 1; _i < cols; _i++)\
 		input_itemsets_d[_i] = -_i * penalty;\
 \
 	/* We are using another logic to break loop */\
@@ -70,7 +65,7 @@ int gBlosum62[24][24] = {
 		cols, penalty, blk, block_width, worksize, offset_r, offset_c,\
 		loopFlag\
 	) {\
-	if(blk > WORKSIZE / BLOCK_SIZE) {\
+	if(blk > worksize / BLOCK_SIZE) {\
 		PRINT_SUCCESS();\
 		break;\
 	}\
@@ -88,19 +83,51 @@ int gBlosum62[24][24] = {
 #define POSTAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz,\
 		cols, penalty, blk, block_width, worksize, offset_r, offset_c\
 	) {\
-	int _i, _j;\
+	int _i, _j, _score;\
+	int *_expected;\
 	FILE *opf = fopen("outputReference", "w");\
 \
-	for(_i = 0; _i < MAX_COLS_P; _i++)\
-		for(_j = 0; _j < MAX_ROWS_P; _j++)\
-			fprintf(opf, "%d\n", reference_d[_i * MAX_COLS_P + _j]);\
+	for(_i = 0; _i < cols; _i++)\
+		for(_j = 0; _j < cols; _j++)\
+			fprintf(opf, "%d\n", reference_d[_i * cols + _j]);\
 \
 	fclose(opf);\
 	opf = fopen("outputInputItemsets", "w");\
 \
-	for(_i = 0; _i < MAX_COLS_P; _i++)\
-		for(_j = 0; _j < MAX_ROWS_P; _j++)\
-			fprintf(opf, "%d\n", input_itemsets_d[_i * MAX_COLS_P + _j]);\
+	for(_i = 0; _i < cols; _i++)\
+		for(_j = 0; _j < cols; _j++)\
+			fprintf(opf, "%d\n", input_itemsets_d[_i * cols + _j]);\
 \
 	fclose(opf);\
+\
+	/* Validate the blocks scored by nw_kernel1 (the upper-left triangle of blocks) against a host Needleman-Wunsch */\
+	_expected = malloc(cols * cols * sizeof(int));\
+	ASSERT_CALL(_expected, fprintf(stderr, "Error: could not allocate reference scores.\n"); rv = EXIT_FAILURE);\
+	for(_i = 0; _i < cols; _i++) {\
+		_expected[_i * cols] = input_itemsets_d[_i * cols];\
+		_expected[_i] = input_itemsets_d[_i];\
+	}\
+	for(_i = 1; _i < cols; _i++) {\
+		for(_j = 1; _j < cols; _j++) {\
+			_score = _expected[(_i - 1) * cols + _j - 1] + reference_d[_i * cols + _j];\
+			if(_expected[_i * cols + _j - 1] - penalty > _score)\
+				_score = _expected[_i * cols + _j - 1] - penalty;\
+			if(_expected[(_i - 1) * cols + _j] - penalty > _score)\
+				_score = _expected[(_i - 1) * cols + _j] - penalty;\
+			_expected[_i * cols + _j] = _score;\
+		}\
+	}\
+\
+	for(_i = 1; _i < cols; _i++) {\
+		for(_j = 1; _j < cols; _j++) {\
+			if(((_i - 1) / BLOCK_SIZE + (_j - 1) / BLOCK_SIZE < block_width) && (input_itemsets_d[_i * cols + _j] != _expected[_i * cols + _j]))\
+				break;\
+		}\
+		if(_j < cols)\
+			break;\
+	}\
+	if(_i < cols)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_i == cols, printf("Variable input_itemsets_d[%d]: expected %d got %d.\n", _i * cols + _j, _expected[_i * cols + _j], input_itemsets_d[_i * cols + _j]); free(_expected); rv = EXIT_FAILURE);\
+	free(_expected);\
 }
@@ -97,6 +97,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNw_Kernel1 = NULL;
+	cl_command_queue transferQueueNw_Kernel1 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,6 +108,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
 	cl_uint workDimNw_Kernel1 = 1;
 	size_t globalSizeNw_Kernel1[1] = {
 		16
@@ -159,7 +161,13 @@ int main(void) {
 
 	/* Create command queue for nw_kernel1 kernel */
 	PRINT_STEP("Creating command queue for \"nw_kernel1\"...");
-	queueNw_Kernel1 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNw_Kernel1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for nw_kernel1 kernel */
+	PRINT_STEP("Creating transfer command queue for \"nw_kernel1\"...");
+	transferQueueNw_Kernel1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -241,9 +249,9 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel1, reference_dK, CL_TRUE, 0, 4198401 * sizeof(int), reference_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel1, reference_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), reference_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "reference_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (reference_dK)"));
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel1, input_itemsets_dK, CL_TRUE, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel1, input_itemsets_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input_itemsets_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (input_itemsets_dK)"));
 		fRet = clSetKernelArg(kernelNw_Kernel1, 4, sizeof(int), &cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cols)"));
@@ -262,8 +270,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNw_Kernel1);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNw_Kernel1, kernelNw_Kernel1, workDimNw_Kernel1, NULL, globalSizeNw_Kernel1, localSizeNw_Kernel1, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNw_Kernel1, kernelNw_Kernel1, workDimNw_Kernel1, NULL, globalSizeNw_Kernel1, localSizeNw_Kernel1, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "nw_kernel1"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNw_Kernel1);
 		gettimeofday(&tNow, NULL);
@@ -271,9 +280,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNw_Kernel1, input_itemsets_dK, CL_TRUE, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNw_Kernel1, input_itemsets_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), input_itemsets_d, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "input_itemsets_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -292,6 +303,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -300,6 +312,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(reference_dK)
 		clReleaseMemObject(reference_dK);
@@ -325,6 +340,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNw_Kernel1)
 		clReleaseCommandQueue(queueNw_Kernel1);
+	if(transferQueueNw_Kernel1)
+		clReleaseCommandQueue(transferQueueNw_Kernel1);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,163 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c);
+ *            POSTAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c);
+ *            LOOPPREAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c, loopFlag);
+ *            LOOPPOSTAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c, loopFlag);
+ *            CLEANUP(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c);
+ *        where:
+ *            reference_d: variable (int *);
+ *            reference_dSz: number of members in variable (unsigned int);
+ *            input_itemsets_d: variable (int *);
+ *            input_itemsets_dSz: number of members in variable (unsigned int);
+ *            cols: variable (int);
+ *            penalty: variable (int);
+ *            blk: variable (int);
+ *            block_width: variable (int);
+ *            worksize: variable (int);
+ *            offset_r: variable (int);
+ *            offset_c: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int *reference_d = NULL;
+static unsigned int reference_dSz = 0;
+static int *input_itemsets_d = NULL;
+static unsigned int input_itemsets_dSz = 0;
+static int cols;
+static int penalty;
+static int blk;
+static int block_width;
+static int worksize;
+static int offset_r;
+static int offset_c;
+
+/* Work sizes */
+static size_t *globalSizeNw_Kernel2 = NULL;
+static size_t *localSizeNw_Kernel2 = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(reference_d),
+	RT_BIND_POINTER(input_itemsets_d),
+	RT_BIND_VALUE(cols),
+	RT_BIND_VALUE(penalty),
+	RT_BIND_VALUE(blk),
+	RT_BIND_VALUE(block_width),
+	RT_BIND_VALUE(worksize),
+	RT_BIND_VALUE(offset_r),
+	RT_BIND_VALUE(offset_c),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(nw_kernel2, Nw_Kernel2),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(reference_d, reference_dSz, input_itemsets_d, input_itemsets_dSz, cols, penalty, blk, block_width, worksize, offset_r, offset_c);
+	PRINT_SUCCESS();
+
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
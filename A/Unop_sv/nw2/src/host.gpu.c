@@ -97,6 +97,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNw_Kernel2 = NULL;
+	cl_command_queue transferQueueNw_Kernel2 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -105,8 +106,10 @@ int main(void) {
 	cl_kernel kernelNw_Kernel2 = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimNw_Kernel2 = 1;
 	size_t globalSizeNw_Kernel2[1] = {
 		16
@@ -159,7 +162,13 @@ int main(void) {
 
 	/* Create command queue for nw_kernel2 kernel */
 	PRINT_STEP("Creating command queue for \"nw_kernel2\"...");
-	queueNw_Kernel2 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNw_Kernel2 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for nw_kernel2 kernel */
+	PRINT_STEP("Creating transfer command queue for \"nw_kernel2\"...");
+	transferQueueNw_Kernel2 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -180,18 +189,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create nw_kernel2 kernel */
 	PRINT_STEP("Creating kernel \"nw_kernel2\" from program...");
 	kernelNw_Kernel2 = clCreateKernel(program, "nw_kernel2", &fRet);
@@ -240,9 +262,9 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel2, reference_dK, CL_TRUE, 0, 4198401 * sizeof(int), reference_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel2, reference_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), reference_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "reference_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (reference_dK)"));
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel2, input_itemsets_dK, CL_TRUE, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel2, input_itemsets_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input_itemsets_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (input_itemsets_dK)"));
 		fRet = clSetKernelArg(kernelNw_Kernel2, 4, sizeof(int), &cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cols)"));
@@ -261,8 +283,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNw_Kernel2);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNw_Kernel2, kernelNw_Kernel2, workDimNw_Kernel2, NULL, globalSizeNw_Kernel2, localSizeNw_Kernel2, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNw_Kernel2, kernelNw_Kernel2, workDimNw_Kernel2, NULL, globalSizeNw_Kernel2, localSizeNw_Kernel2, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "nw_kernel2"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNw_Kernel2);
 		gettimeofday(&tNow, NULL);
@@ -270,9 +293,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNw_Kernel2, input_itemsets_dK, CL_TRUE, 0, 4198401 * sizeof(int), input_itemsets_d, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNw_Kernel2, input_itemsets_dK, TRANSFER_BLOCKING, 0, 4198401 * sizeof(int), input_itemsets_d, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "input_itemsets_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -291,6 +316,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -299,6 +326,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(reference_dK)
 		clReleaseMemObject(reference_dK);
@@ -324,6 +354,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNw_Kernel2)
 		clReleaseCommandQueue(queueNw_Kernel2);
+	if(transferQueueNw_Kernel2)
+		clReleaseCommandQueue(transferQueueNw_Kernel2);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,200 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz);
+ *            POSTAMBLE(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz);
+ *            LOOPPREAMBLE(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz, loopFlag);
+ *            LOOPPOSTAMBLE(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz, loopFlag);
+ *            CLEANUP(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz);
+ *        where:
+ *            arrayX: variable (double *);
+ *            arrayXSz: number of members in variable (unsigned int);
+ *            arrayXC: variable (double *);
+ *            arrayXCSz: number of members in variable (unsigned int);
+ *            arrayY: variable (double *);
+ *            arrayYSz: number of members in variable (unsigned int);
+ *            arrayYC: variable (double *);
+ *            arrayYCSz: number of members in variable (unsigned int);
+ *            xj: variable (double *);
+ *            xjSz: number of members in variable (unsigned int);
+ *            yj: variable (double *);
+ *            yjSz: number of members in variable (unsigned int);
+ *            ind: variable (int *);
+ *            indSz: number of members in variable (unsigned int);
+ *            indC: variable (int *);
+ *            indCSz: number of members in variable (unsigned int);
+ *            objxy: variable (int *);
+ *            objxySz: number of members in variable (unsigned int);
+ *            likelihood: variable (double *);
+ *            likelihoodSz: number of members in variable (unsigned int);
+ *            likelihoodC: variable (double *);
+ *            likelihoodCSz: number of members in variable (unsigned int);
+ *            I: variable (char *);
+ *            ISz: number of members in variable (unsigned int);
+ *            weights: variable (double *);
+ *            weightsSz: number of members in variable (unsigned int);
+ *            weightsC: variable (double *);
+ *            weightsCSz: number of members in variable (unsigned int);
+ *            Nparticles: variable (int);
+ *            countOnes: variable (int);
+ *            max_size: variable (int);
+ *            k: variable (int);
+ *            IszY: variable (int);
+ *            Nfr: variable (int);
+ *            seed: variable (int *);
+ *            seedSz: number of members in variable (unsigned int);
+ *            partial_sums: variable (double *);
+ *            partial_sumsSz: number of members in variable (unsigned int);
+ *            partial_sumsC: variable (double *);
+ *            partial_sumsCSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static double *arrayX = NULL;
+static unsigned int arrayXSz = 0;
+static double *arrayXC = NULL;
+static unsigned int arrayXCSz = 0;
+static double *arrayY = NULL;
+static unsigned int arrayYSz = 0;
+static double *arrayYC = NULL;
+static unsigned int arrayYCSz = 0;
+static double *xj = NULL;
+static unsigned int xjSz = 0;
+static double *yj = NULL;
+static unsigned int yjSz = 0;
+static int *ind = NULL;
+static unsigned int indSz = 0;
+static int *indC = NULL;
+static unsigned int indCSz = 0;
+static int *objxy = NULL;
+static unsigned int objxySz = 0;
+static double *likelihood = NULL;
+static unsigned int likelihoodSz = 0;
+static double *likelihoodC = NULL;
+static unsigned int likelihoodCSz = 0;
+static char *I = NULL;
+static unsigned int ISz = 0;
+static double *weights = NULL;
+static unsigned int weightsSz = 0;
+static double *weightsC = NULL;
+static unsigned int weightsCSz = 0;
+static int Nparticles;
+static int countOnes;
+static int max_size;
+static int k;
+static int IszY;
+static int Nfr;
+static int *seed = NULL;
+static unsigned int seedSz = 0;
+static double *partial_sums = NULL;
+static unsigned int partial_sumsSz = 0;
+static double *partial_sumsC = NULL;
+static unsigned int partial_sumsCSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeLikelihood_Kernel = NULL;
+static size_t *localSizeLikelihood_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(arrayX),
+	RT_BIND_POINTER_C(arrayY),
+	RT_BIND_POINTER(xj),
+	RT_BIND_POINTER(yj),
+	RT_BIND_POINTER_C(ind),
+	RT_BIND_POINTER(objxy),
+	RT_BIND_POINTER_C(likelihood),
+	RT_BIND_POINTER(I),
+	RT_BIND_POINTER_C(weights),
+	RT_BIND_VALUE(Nparticles),
+	RT_BIND_VALUE(countOnes),
+	RT_BIND_VALUE(max_size),
+	RT_BIND_VALUE(k),
+	RT_BIND_VALUE(IszY),
+	RT_BIND_VALUE(Nfr),
+	RT_BIND_POINTER(seed),
+	RT_BIND_POINTER_C(partial_sums),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(likelihood_kernel, Likelihood_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(arrayX, arrayXSz, arrayXC, arrayXCSz, arrayY, arrayYSz, arrayYC, arrayYCSz, xj, xjSz, yj, yjSz, ind, indSz, indC, indCSz, objxy, objxySz, likelihood, likelihoodSz, likelihoodC, likelihoodCSz, I, ISz, weights, weightsSz, weightsC, weightsCSz, Nparticles, countOnes, max_size, k, IszY, Nfr, seed, seedSz, partial_sums, partial_sumsSz, partial_sumsC, partial_sumsCSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -126,6 +126,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueLikelihood_Kernel = NULL;
+	cl_command_queue transferQueueLikelihood_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -134,8 +135,10 @@ int main(void) {
 	cl_kernel kernelLikelihood_Kernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 18);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimLikelihood_Kernel = 3;
 	size_t globalSizeLikelihood_Kernel[3] = {
 		40448, 1, 1
@@ -216,7 +219,13 @@ int main(void) {
 
 	/* Create command queue for likelihood_kernel kernel */
 	PRINT_STEP("Creating command queue for \"likelihood_kernel\"...");
-	queueLikelihood_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueLikelihood_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for likelihood_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"likelihood_kernel\"...");
+	transferQueueLikelihood_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -237,18 +246,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create likelihood_kernel kernel */
 	PRINT_STEP("Creating kernel \"likelihood_kernel\" from program...");
 	kernelLikelihood_Kernel = clCreateKernel(program, "likelihood_kernel", &fRet);
@@ -324,23 +346,23 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, arrayXK, CL_TRUE, 0, 40000 * sizeof(double), arrayX, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, arrayXK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), arrayX, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "arrayX"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (arrayXK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, arrayYK, CL_TRUE, 0, 40000 * sizeof(double), arrayY, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, arrayYK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), arrayY, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "arrayY"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (arrayYK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, xjK, CL_TRUE, 0, 40000 * sizeof(double), xj, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, xjK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), xj, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "xj"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (xjK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, yjK, CL_TRUE, 0, 40000 * sizeof(double), yj, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, yjK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), yj, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "yj"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (yjK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, indK, CL_TRUE, 0, 2760000 * sizeof(int), ind, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, indK, TRANSFER_BLOCKING, 0, 2760000 * sizeof(int), ind, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "ind"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (indK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, objxyK, CL_TRUE, 0, 138 * sizeof(int), objxy, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, objxyK, TRANSFER_BLOCKING, 0, 138 * sizeof(int), objxy, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "objxy"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (objxyK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, likelihoodK, CL_TRUE, 0, 40000 * sizeof(double), likelihood, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, likelihoodK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), likelihood, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "likelihood"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (likelihoodK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, IK, CL_TRUE, 0, 163840 * sizeof(char), I, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, IK, TRANSFER_BLOCKING, 0, 163840 * sizeof(char), I, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "I"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (IK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "weights"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (weightsK)"));
 		fRet = clSetKernelArg(kernelLikelihood_Kernel, 9, sizeof(int), &Nparticles);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (Nparticles)"));
@@ -354,15 +376,16 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (IszY)"));
 		fRet = clSetKernelArg(kernelLikelihood_Kernel, 14, sizeof(int), &Nfr);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (Nfr)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, seedK, CL_TRUE, 0, 40000 * sizeof(int), seed, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, seedK, TRANSFER_BLOCKING, 0, 40000 * sizeof(int), seed, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "seed"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (seedK)"));
-		fRet = clEnqueueWriteBuffer(queueLikelihood_Kernel, partial_sumsK, CL_TRUE, 0, 79 * sizeof(double), partial_sums, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueLikelihood_Kernel, partial_sumsK, TRANSFER_BLOCKING, 0, 79 * sizeof(double), partial_sums, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "partial_sums"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (partial_sumsK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueLikelihood_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueLikelihood_Kernel, kernelLikelihood_Kernel, workDimLikelihood_Kernel, NULL, globalSizeLikelihood_Kernel, localSizeLikelihood_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueLikelihood_Kernel, kernelLikelihood_Kernel, workDimLikelihood_Kernel, NULL, globalSizeLikelihood_Kernel, localSizeLikelihood_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 11), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "likelihood_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueLikelihood_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -370,14 +393,16 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, arrayXK, CL_TRUE, 0, 40000 * sizeof(double), arrayX, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, arrayYK, CL_TRUE, 0, 40000 * sizeof(double), arrayY, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, indK, CL_TRUE, 0, 2760000 * sizeof(int), ind, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, likelihoodK, CL_TRUE, 0, 40000 * sizeof(double), likelihood, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueLikelihood_Kernel, partial_sumsK, CL_TRUE, 0, 79 * sizeof(double), partial_sums, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, arrayXK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), arrayX, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "arrayX"));
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, arrayYK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), arrayY, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "arrayY"));
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, indK, TRANSFER_BLOCKING, 0, 2760000 * sizeof(int), ind, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "ind"));
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, likelihoodK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), likelihood, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "likelihood"));
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "weights"));
+		fRet = clEnqueueReadBuffer(transferQueueLikelihood_Kernel, partial_sumsK, TRANSFER_BLOCKING, 0, 79 * sizeof(double), partial_sums, ASYNC_WAIT_LIST(profileEvents, 11, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "partial_sums"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 12, 6);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -388,6 +413,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -450,6 +477,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(arrayXK)
 		clReleaseMemObject(arrayXK);
@@ -508,6 +538,8 @@ _err:
 	/* Dealloc queues */
 	if(queueLikelihood_Kernel)
 		clReleaseCommandQueue(queueLikelihood_Kernel);
+	if(transferQueueLikelihood_Kernel)
+		clReleaseCommandQueue(transferQueueLikelihood_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
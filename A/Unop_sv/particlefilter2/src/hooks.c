@@ -0,0 +1,139 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz);
+ *            POSTAMBLE(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz);
+ *            LOOPPREAMBLE(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz, loopFlag);
+ *            LOOPPOSTAMBLE(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz, loopFlag);
+ *            CLEANUP(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz);
+ *        where:
+ *            weights: variable (double *);
+ *            weightsSz: number of members in variable (unsigned int);
+ *            weightsC: variable (double *);
+ *            weightsCSz: number of members in variable (unsigned int);
+ *            Nparticles: variable (int);
+ *            partial_sums: variable (double *);
+ *            partial_sumsSz: number of members in variable (unsigned int);
+ *            CDF: variable (double *);
+ *            CDFSz: number of members in variable (unsigned int);
+ *            u: variable (double *);
+ *            uSz: number of members in variable (unsigned int);
+ *            uC: variable (double *);
+ *            uCSz: number of members in variable (unsigned int);
+ *            seed: variable (int *);
+ *            seedSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static double *weights = NULL;
+static unsigned int weightsSz = 0;
+static double *weightsC = NULL;
+static unsigned int weightsCSz = 0;
+static int Nparticles;
+static double *partial_sums = NULL;
+static unsigned int partial_sumsSz = 0;
+static double *CDF = NULL;
+static unsigned int CDFSz = 0;
+static double *u = NULL;
+static unsigned int uSz = 0;
+static double *uC = NULL;
+static unsigned int uCSz = 0;
+static int *seed = NULL;
+static unsigned int seedSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeNormalize_Weights_Kernel = NULL;
+static size_t *localSizeNormalize_Weights_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(weights),
+	RT_BIND_VALUE(Nparticles),
+	RT_BIND_POINTER(partial_sums),
+	RT_BIND_POINTER(CDF),
+	RT_BIND_POINTER_C(u),
+	RT_BIND_POINTER(seed),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(normalize_weights_kernel, Normalize_Weights_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(weights, weightsSz, weightsC, weightsCSz, Nparticles, partial_sums, partial_sumsSz, CDF, CDFSz, u, uSz, uC, uCSz, seed, seedSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -101,6 +101,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNormalize_Weights_Kernel = NULL;
+	cl_command_queue transferQueueNormalize_Weights_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -111,6 +112,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 9);
 	cl_uint workDimNormalize_Weights_Kernel = 3;
 	size_t globalSizeNormalize_Weights_Kernel[3] = {
 		40448, 1, 1
@@ -167,7 +169,13 @@ int main(void) {
 
 	/* Create command queue for normalize_weights_kernel kernel */
 	PRINT_STEP("Creating command queue for \"normalize_weights_kernel\"...");
-	queueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for normalize_weights_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"normalize_weights_kernel\"...");
+	transferQueueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -240,23 +248,24 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "weights"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (weightsK)"));
 		fRet = clSetKernelArg(kernelNormalize_Weights_Kernel, 1, sizeof(int), &Nparticles);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (Nparticles)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, partial_sumsK, CL_TRUE, 0, 79 * sizeof(double), partial_sums, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, partial_sumsK, TRANSFER_BLOCKING, 0, 79 * sizeof(double), partial_sums, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "partial_sums"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (partial_sumsK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, CDFK, CL_TRUE, 0, 40000 * sizeof(double), CDF, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, CDFK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), CDF, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "CDF"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (CDFK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, uK, CL_TRUE, 0, 40000 * sizeof(double), u, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, uK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), u, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "u"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (uK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, seedK, CL_TRUE, 0, 40000 * sizeof(int), seed, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, seedK, TRANSFER_BLOCKING, 0, 40000 * sizeof(int), seed, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "seed"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (seedK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNormalize_Weights_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNormalize_Weights_Kernel, kernelNormalize_Weights_Kernel, workDimNormalize_Weights_Kernel, NULL, globalSizeNormalize_Weights_Kernel, localSizeNormalize_Weights_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNormalize_Weights_Kernel, kernelNormalize_Weights_Kernel, workDimNormalize_Weights_Kernel, NULL, globalSizeNormalize_Weights_Kernel, localSizeNormalize_Weights_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 5), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "normalize_weights_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNormalize_Weights_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -264,11 +273,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, CDFK, CL_TRUE, 0, 40000 * sizeof(double), CDF, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, uK, CL_TRUE, 0, 40000 * sizeof(double), u, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "weights"));
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, CDFK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), CDF, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "CDF"));
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, uK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), u, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "u"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 6, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -279,6 +290,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -305,6 +317,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(weightsK)
 		clReleaseMemObject(weightsK);
@@ -341,6 +356,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNormalize_Weights_Kernel)
 		clReleaseCommandQueue(queueNormalize_Weights_Kernel);
+	if(transferQueueNormalize_Weights_Kernel)
+		clReleaseCommandQueue(transferQueueNormalize_Weights_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
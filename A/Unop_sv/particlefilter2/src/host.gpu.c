@@ -101,6 +101,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNormalize_Weights_Kernel = NULL;
+	cl_command_queue transferQueueNormalize_Weights_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,8 +110,10 @@ int main(void) {
 	cl_kernel kernelNormalize_Weights_Kernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 9);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimNormalize_Weights_Kernel = 3;
 	size_t globalSizeNormalize_Weights_Kernel[3] = {
 		40448, 1, 1
@@ -167,7 +170,13 @@ int main(void) {
 
 	/* Create command queue for normalize_weights_kernel kernel */
 	PRINT_STEP("Creating command queue for \"normalize_weights_kernel\"...");
-	queueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for normalize_weights_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"normalize_weights_kernel\"...");
+	transferQueueNormalize_Weights_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -188,18 +197,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create normalize_weights_kernel kernel */
 	PRINT_STEP("Creating kernel \"normalize_weights_kernel\" from program...");
 	kernelNormalize_Weights_Kernel = clCreateKernel(program, "normalize_weights_kernel", &fRet);
@@ -239,23 +261,24 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "weights"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (weightsK)"));
 		fRet = clSetKernelArg(kernelNormalize_Weights_Kernel, 1, sizeof(int), &Nparticles);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (Nparticles)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, partial_sumsK, CL_TRUE, 0, 79 * sizeof(double), partial_sums, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, partial_sumsK, TRANSFER_BLOCKING, 0, 79 * sizeof(double), partial_sums, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "partial_sums"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (partial_sumsK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, CDFK, CL_TRUE, 0, 40000 * sizeof(double), CDF, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, CDFK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), CDF, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "CDF"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (CDFK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, uK, CL_TRUE, 0, 40000 * sizeof(double), u, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, uK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), u, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "u"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (uK)"));
-		fRet = clEnqueueWriteBuffer(queueNormalize_Weights_Kernel, seedK, CL_TRUE, 0, 40000 * sizeof(int), seed, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNormalize_Weights_Kernel, seedK, TRANSFER_BLOCKING, 0, 40000 * sizeof(int), seed, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "seed"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (seedK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNormalize_Weights_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNormalize_Weights_Kernel, kernelNormalize_Weights_Kernel, workDimNormalize_Weights_Kernel, NULL, globalSizeNormalize_Weights_Kernel, localSizeNormalize_Weights_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNormalize_Weights_Kernel, kernelNormalize_Weights_Kernel, workDimNormalize_Weights_Kernel, NULL, globalSizeNormalize_Weights_Kernel, localSizeNormalize_Weights_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 5), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "normalize_weights_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNormalize_Weights_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -263,11 +286,13 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, weightsK, CL_TRUE, 0, 40000 * sizeof(double), weights, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, CDFK, CL_TRUE, 0, 40000 * sizeof(double), CDF, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueNormalize_Weights_Kernel, uK, CL_TRUE, 0, 40000 * sizeof(double), u, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, weightsK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), weights, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "weights"));
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, CDFK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), CDF, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "CDF"));
+		fRet = clEnqueueReadBuffer(transferQueueNormalize_Weights_Kernel, uK, TRANSFER_BLOCKING, 0, 40000 * sizeof(double), u, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "u"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 6, 3);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -278,6 +303,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -304,6 +331,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(weightsK)
 		clReleaseMemObject(weightsK);
@@ -340,6 +370,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNormalize_Weights_Kernel)
 		clReleaseCommandQueue(queueNormalize_Weights_Kernel);
+	if(transferQueueNormalize_Weights_Kernel)
+		clReleaseCommandQueue(transferQueueNormalize_Weights_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
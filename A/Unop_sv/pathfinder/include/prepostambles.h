@@ -4,8 +4,6 @@
 
 #define MIN(a, b) ((a)<=(b) ? (a) : (b))
 
-#define ROWS 100
-#define COLS 10000
 #define PYRAMID_HEIGHT 20
 #define HALO_VAL 1
 
@@ -20,14 +18,14 @@ int gIndex = 0;
 \
 	srand(time(NULL));\
 \
-	gData = malloc(ROWS * COLS * sizeof(int));\
-	for(_i = 0; _i < ROWS; _i++)\
-		for(_j = 0; _j < COLS; _j++)\
-			gData[_i * COLS + _j] = rand() % 10;\
+	gData = malloc(rows * cols * sizeof(int));\
+	for(_i = 0; _i < rows; _i++)\
+		for(_j = 0; _j < cols; _j++)\
+			gData[_i * cols + _j] = rand() % 10;\
 \
-	memcpy(gpuWall, &gData[COLS], ((ROWS * COLS) - COLS) * sizeof(int));\
-	memcpy(gpuSrc, gData, COLS * sizeof(int));\
-	memset(outputBuffer, 0, 16384 * sizeof(int));\
+	memcpy(gpuWall, &gData[cols], ((rows * cols) - cols) * sizeof(int));\
+	memcpy(gpuSrc, gData, cols * sizeof(int));\
+	memset(outputBuffer, 0, outputBufferSz * sizeof(int));\
 \
 	border = PYRAMID_HEIGHT * HALO_VAL;\
 	/* We are using another logic to break loop */\
@@ -39,12 +37,12 @@ int gIndex = 0;
 		outputBuffer, outputBufferSz,\
 		loopFlag\
 	) {\
-	if(gIndex >= ROWS - 1) {\
+	if(gIndex >= rows - 1) {\
 		PRINT_SUCCESS();\
 		break;\
 	}\
 \
-	iteration = MIN(PYRAMID_HEIGHT, ROWS - gIndex - 1);\
+	iteration = MIN(PYRAMID_HEIGHT, rows - gIndex - 1);\
 	startStep = gIndex;\
 }
 
@@ -53,7 +51,7 @@ int gIndex = 0;
 		outputBuffer, outputBufferSz,\
 		loopFlag\
 	) {\
-	memcpy(gpuSrc, gpuResults, COLS * sizeof(int));\
+	memcpy(gpuSrc, gpuResults, cols * sizeof(int));\
 	gIndex += PYRAMID_HEIGHT;\
 }
 
@@ -61,20 +59,48 @@ int gIndex = 0;
 		cols, rows, startStep, border, HALO,\
 		outputBuffer, outputBufferSz\
 	) {\
-	int _i;\
+	int _i, _t, _min;\
+	int *_src, *_dst, *_tmp;\
 	FILE *opf = fopen("outputResults", "w");\
 \
-	for(_i = 0; _i < COLS; _i++)\
+	for(_i = 0; _i < cols; _i++)\
 		fprintf(opf, "%d\n", gpuResults[_i]);\
 \
 	fclose(opf);\
 \
 	opf = fopen("outputBuffer", "w");\
 \
-	for(_i = 0; _i < 16384; _i++)\
+	for(_i = 0; _i < outputBufferSz; _i++)\
 		fprintf(opf, "%d\n", outputBuffer[_i]);\
 \
 	fclose(opf);\
+\
+	/* Validate against the dynamic programming done row by row on the host */\
+	_src = malloc(cols * sizeof(int));\
+	_dst = malloc(cols * sizeof(int));\
+	ASSERT_CALL(_src && _dst, fprintf(stderr, "Error: could not allocate reference rows.\n"); free(_src); free(_dst); rv = EXIT_FAILURE);\
+	memcpy(_src, gData, cols * sizeof(int));\
+	for(_t = 1; _t < rows; _t++) {\
+		for(_i = 0; _i < cols; _i++) {\
+			_min = _src[_i];\
+			if(_i > 0)\
+				_min = MIN(_min, _src[_i - 1]);\
+			if(_i < cols - 1)\
+				_min = MIN(_min, _src[_i + 1]);\
+			_dst[_i] = gData[_t * cols + _i] + _min;\
+		}\
+		_tmp = _src;\
+		_src = _dst;\
+		_dst = _tmp;\
+	}\
+\
+	for(_i = 0; (_i < cols) && (gpuResults[_i] == _src[_i]); _i++)\
+		;\
+	if(_i < cols)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_i == cols, printf("Variable gpuResults[%d]: expected %d got %d.\n", _i, _src[_i], gpuResults[_i]); free(_src); free(_dst); rv = EXIT_FAILURE);\
+	free(_src);\
+	free(_dst);\
 }
 
 #define CLEANUP(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz,\
@@ -0,0 +1,173 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+ *            POSTAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+ *            LOOPPREAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz, loopFlag);
+ *            LOOPPOSTAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz, loopFlag);
+ *            CLEANUP(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+ *        where:
+ *            iteration: variable (int);
+ *            gpuWall: variable (int *);
+ *            gpuWallSz: number of members in variable (unsigned int);
+ *            gpuSrc: variable (int *);
+ *            gpuSrcSz: number of members in variable (unsigned int);
+ *            gpuResults: variable (int *);
+ *            gpuResultsSz: number of members in variable (unsigned int);
+ *            cols: variable (int);
+ *            rows: variable (int);
+ *            startStep: variable (int);
+ *            border: variable (int);
+ *            HALO: variable (int);
+ *            outputBuffer: variable (int *);
+ *            outputBufferSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int iteration;
+static int *gpuWall = NULL;
+static unsigned int gpuWallSz = 0;
+static int *gpuSrc = NULL;
+static unsigned int gpuSrcSz = 0;
+static int *gpuResults = NULL;
+static unsigned int gpuResultsSz = 0;
+static int cols;
+static int rows;
+static int startStep;
+static int border;
+static int HALO;
+static int *outputBuffer = NULL;
+static unsigned int outputBufferSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeDynproc_Kernel = NULL;
+static size_t *localSizeDynproc_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(iteration),
+	RT_BIND_POINTER(gpuWall),
+	RT_BIND_POINTER(gpuSrc),
+	RT_BIND_POINTER(gpuResults),
+	RT_BIND_VALUE(cols),
+	RT_BIND_VALUE(rows),
+	RT_BIND_VALUE(startStep),
+	RT_BIND_VALUE(border),
+	RT_BIND_VALUE(HALO),
+	RT_BIND_POINTER(outputBuffer),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(dynproc_kernel, Dynproc_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(iteration, gpuWall, gpuWallSz, gpuSrc, gpuSrcSz, gpuResults, gpuResultsSz, cols, rows, startStep, border, HALO, outputBuffer, outputBufferSz);
+}
@@ -100,6 +100,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueDynproc_Kernel = NULL;
+	cl_command_queue transferQueueDynproc_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -110,6 +111,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimDynproc_Kernel = 1;
 	size_t globalSizeDynproc_Kernel[1] = {
 		1000000
@@ -165,7 +167,13 @@ int main(void) {
 
 	/* Create command queue for dynproc_kernel kernel */
 	PRINT_STEP("Creating command queue for \"dynproc_kernel\"...");
-	queueDynproc_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueDynproc_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for dynproc_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"dynproc_kernel\"...");
+	transferQueueDynproc_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -255,11 +263,11 @@ int main(void) {
 		PRINT_STEP("[%d] Setting buffers...", i);
 		fRet = clSetKernelArg(kernelDynproc_Kernel, 0, sizeof(int), &iteration);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (iteration)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, gpuWallK, CL_TRUE, 0, 990000 * sizeof(int), gpuWall, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, gpuWallK, TRANSFER_BLOCKING, 0, 990000 * sizeof(int), gpuWall, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "gpuWall"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (gpuWallK)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, gpuSrcK, CL_TRUE, 0, 10000 * sizeof(int), gpuSrc, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, gpuSrcK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), gpuSrc, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "gpuSrc"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (gpuSrcK)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, gpuResultsK, CL_TRUE, 0, 10000 * sizeof(int), gpuResults, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, gpuResultsK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), gpuResults, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "gpuResults"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (gpuResultsK)"));
 		fRet = clSetKernelArg(kernelDynproc_Kernel, 4, sizeof(int), &cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cols)"));
@@ -271,13 +279,14 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (border)"));
 		fRet = clSetKernelArg(kernelDynproc_Kernel, 8, sizeof(int), &HALO);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (HALO)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, outputBufferK, CL_TRUE, 0, 16384 * sizeof(int), outputBuffer, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, outputBufferK, TRANSFER_BLOCKING, 0, 16384 * sizeof(int), outputBuffer, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "outputBuffer"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outputBufferK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueDynproc_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueDynproc_Kernel, kernelDynproc_Kernel, workDimDynproc_Kernel, NULL, globalSizeDynproc_Kernel, localSizeDynproc_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueDynproc_Kernel, kernelDynproc_Kernel, workDimDynproc_Kernel, NULL, globalSizeDynproc_Kernel, localSizeDynproc_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "dynproc_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueDynproc_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -285,10 +294,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueDynproc_Kernel, gpuResultsK, CL_TRUE, 0, 10000 * sizeof(int), gpuResults, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueDynproc_Kernel, outputBufferK, CL_TRUE, 0, 16384 * sizeof(int), outputBuffer, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueDynproc_Kernel, gpuResultsK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), gpuResults, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "gpuResults"));
+		fRet = clEnqueueReadBuffer(transferQueueDynproc_Kernel, outputBufferK, TRANSFER_BLOCKING, 0, 16384 * sizeof(int), outputBuffer, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "outputBuffer"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -307,6 +318,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -315,6 +327,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(gpuWallK)
 		clReleaseMemObject(gpuWallK);
@@ -346,6 +361,8 @@ _err:
 	/* Dealloc queues */
 	if(queueDynproc_Kernel)
 		clReleaseCommandQueue(queueDynproc_Kernel);
+	if(transferQueueDynproc_Kernel)
+		clReleaseCommandQueue(transferQueueDynproc_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
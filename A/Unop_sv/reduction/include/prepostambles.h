@@ -1,12 +1,12 @@
 #define PREAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n) {\
-	int _i;\
+	unsigned int _i;\
 \
 	for(_i = 0; _i < g_idataSz; _i++)\
 		g_idata[_i] = _i % 3;\
 }
 
 #define POSTAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n) {\
-	int _i;\
+	unsigned int _i;\
 	float iSum = 0, oSum = 0;\
 \
 	/* Disclaimer: this validation will be silly (but works) */\
@@ -23,3 +23,48 @@
 	for(_i = 0; _i < g_odataCSz; _i++)\
 		g_odataC[_i] = iSum;\
 }
+
+/* Operations of the multi-stage reduction descriptions (kern.full.xml, kern.full.double.xml, kern.full.int.xml) */
+#define REDUCE_SUM 0
+#define REDUCE_MIN 1
+#define REDUCE_MAX 2
+#define REDUCE_DOT 3
+
+/* Small integers in [-100, 100], with the extremes planted in the middle and at the tail of the input */
+#define FULLPREAMBLE(x, y, n, op) {\
+	unsigned int _i;\
+\
+	ASSERT_CALL((op >= REDUCE_SUM) && (op <= REDUCE_DOT), fprintf(stderr, "Error: op is %d, expected 0 (sum), 1 (min), 2 (max) or 3 (dot).\n", op); rv = EXIT_FAILURE);\
+\
+	srand(1);\
+	for(_i = 0; _i < n; _i++)\
+		x[_i] = (rand() % 201) - 100;\
+	x[n / 2] = -1000;\
+	x[n - 1] = 1000;\
+\
+	for(_i = 0; (REDUCE_DOT == op) && (_i < n); _i++)\
+		y[_i] = (rand() % 201) - 100;\
+}
+
+/* Validate against a host reduction accumulated in double, within epsilon times the sum of magnitudes */
+#define FULLPOSTAMBLE(x, y, n, op, result, epsilon) {\
+	unsigned int _i;\
+	double _expected = 0, _magnitude = 0, _term, _diff, _tolerance;\
+\
+	for(_i = 0; _i < n; _i++) {\
+		_term = (REDUCE_DOT == op)? (double) x[_i] * y[_i] : x[_i];\
+		if((REDUCE_MIN == op) && (!_i || (_term < _expected)))\
+			_expected = _term;\
+		else if((REDUCE_MAX == op) && (!_i || (_term > _expected)))\
+			_expected = _term;\
+		else if((REDUCE_SUM == op) || (REDUCE_DOT == op))\
+			_expected += _term;\
+		_magnitude += (_term < 0)? -_term : _term;\
+	}\
+\
+	_diff = (result > _expected)? result - _expected : _expected - result;\
+	_tolerance = ((REDUCE_SUM == op) || (REDUCE_DOT == op))? epsilon * _magnitude : 0;\
+	if(_diff > _tolerance)\
+		PRINT_FAIL();\
+	ASSERT_CALL(_diff <= _tolerance, printf("Variable result: expected %f got %f.\n", _expected, (double) result); rv = EXIT_FAILURE);\
+}
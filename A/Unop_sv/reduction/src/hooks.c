@@ -0,0 +1,197 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n);
+ *            POSTAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n);
+ *            LOOPPREAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n, loopFlag);
+ *            LOOPPOSTAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n, loopFlag);
+ *            CLEANUP(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n);
+ *        and, when running the multi-stage descriptions (kern.full.xml, kern.full.double.xml, kern.full.int.xml):
+ *            FULLPREAMBLE(x, y, n, op);
+ *            FULLPOSTAMBLE(x, y, n, op, result, epsilon);
+ *        where:
+ *            g_idata: variable (float *);
+ *            g_idataSz: number of members in variable (unsigned int);
+ *            g_odata: variable (float *);
+ *            g_odataSz: number of members in variable (unsigned int);
+ *            g_odataC: variable (float *);
+ *            g_odataCSz: number of members in variable (unsigned int);
+ *            n: variable (unsigned int);
+ *            x, y: input variables, y only used by REDUCE_DOT (float *, double * or int *);
+ *            op: REDUCE_SUM, REDUCE_MIN, REDUCE_MAX or REDUCE_DOT (int);
+ *            result: reduced value (float, double or int);
+ *            epsilon: error accepted relative to the sum of magnitudes (double);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *g_idata = NULL;
+static unsigned int g_idataSz = 0;
+static float *g_odata = NULL;
+static unsigned int g_odataSz = 0;
+static float *g_odataC = NULL;
+static unsigned int g_odataCSz = 0;
+static unsigned int n;
+
+/* Multi-stage descriptions (kern.full.xml, kern.full.double.xml, kern.full.int.xml) variables */
+static float *x = NULL;
+static unsigned int xSz = 0;
+static float *y = NULL;
+static unsigned int ySz = 0;
+static float *partials = NULL;
+static unsigned int partialsSz = 0;
+static float result;
+static double *xDouble = NULL;
+static unsigned int xDoubleSz = 0;
+static double *yDouble = NULL;
+static unsigned int yDoubleSz = 0;
+static double *partialsDouble = NULL;
+static unsigned int partialsDoubleSz = 0;
+static double resultDouble;
+static int *xInt = NULL;
+static unsigned int xIntSz = 0;
+static int *yInt = NULL;
+static unsigned int yIntSz = 0;
+static int *partialsInt = NULL;
+static unsigned int partialsIntSz = 0;
+static int resultInt;
+static unsigned int ngroups;
+static int op;
+
+/* Work sizes */
+static size_t *globalSizeReduce = NULL;
+static size_t *localSizeReduce = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(g_idata),
+	RT_BIND_POINTER_C(g_odata),
+	RT_BIND_VALUE(n),
+	RT_BIND_POINTER(x),
+	RT_BIND_POINTER(y),
+	RT_BIND_POINTER(partials),
+	RT_BIND_VALUE(result),
+	RT_BIND_POINTER(xDouble),
+	RT_BIND_POINTER(yDouble),
+	RT_BIND_POINTER(partialsDouble),
+	RT_BIND_VALUE(resultDouble),
+	RT_BIND_POINTER(xInt),
+	RT_BIND_POINTER(yInt),
+	RT_BIND_POINTER(partialsInt),
+	RT_BIND_VALUE(resultInt),
+	RT_BIND_VALUE(ngroups),
+	RT_BIND_VALUE(op),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(reduce, Reduce),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	if(partials) {
+		FULLPREAMBLE(x, y, n, op);
+	}
+	else if(partialsDouble) {
+		FULLPREAMBLE(xDouble, yDouble, n, op);
+	}
+	else if(partialsInt) {
+		FULLPREAMBLE(xInt, yInt, n, op);
+	}
+	else {
+		PREAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	if(partials) {
+		FULLPOSTAMBLE(x, y, n, op, result, 1e-5);
+	}
+	else if(partialsDouble) {
+		FULLPOSTAMBLE(xDouble, yDouble, n, op, resultDouble, 1e-12);
+	}
+	else if(partialsInt) {
+		FULLPOSTAMBLE(xInt, yInt, n, op, resultInt, 0);
+	}
+	else {
+		POSTAMBLE(g_idata, g_idataSz, g_odata, g_odataSz, g_odataC, g_odataCSz, n);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
@@ -93,6 +93,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueReduce = NULL;
+	cl_command_queue transferQueueReduce = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -101,8 +102,10 @@ int main(void) {
 	cl_kernel kernelReduce = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimReduce = 1;
 	size_t globalSizeReduce[1] = {
 		16384
@@ -151,7 +154,13 @@ int main(void) {
 
 	/* Create command queue for reduce kernel */
 	PRINT_STEP("Creating command queue for \"reduce\"...");
-	queueReduce = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueReduce = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for reduce kernel */
+	PRINT_STEP("Creating transfer command queue for \"reduce\"...");
+	transferQueueReduce = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -172,18 +181,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create reduce kernel */
 	PRINT_STEP("Creating kernel \"reduce\" from program...");
 	kernelReduce = clCreateKernel(program, "reduce", &fRet);
@@ -213,17 +235,18 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueReduce, g_idataK, CL_TRUE, 0, 131072 * sizeof(float), g_idata, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueReduce, g_idataK, TRANSFER_BLOCKING, 0, 131072 * sizeof(float), g_idata, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "g_idata"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (g_idataK)"));
-		fRet = clEnqueueWriteBuffer(queueReduce, g_odataK, CL_TRUE, 0, 64 * sizeof(float), g_odata, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueReduce, g_odataK, TRANSFER_BLOCKING, 0, 64 * sizeof(float), g_odata, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "g_odata"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (g_odataK)"));
 		fRet = clSetKernelArg(kernelReduce, 3, sizeof(unsigned int), &n);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (n)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueReduce);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueReduce, kernelReduce, workDimReduce, NULL, globalSizeReduce, localSizeReduce, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueReduce, kernelReduce, workDimReduce, NULL, globalSizeReduce, localSizeReduce, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "reduce"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueReduce);
 		gettimeofday(&tNow, NULL);
@@ -231,9 +254,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueReduce, g_odataK, CL_TRUE, 0, 64 * sizeof(float), g_odata, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueReduce, g_odataK, TRANSFER_BLOCKING, 0, 64 * sizeof(float), g_odata, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "g_odata"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -248,6 +273,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -265,6 +292,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(g_idataK)
 		clReleaseMemObject(g_idataK);
@@ -291,6 +321,8 @@ _err:
 	/* Dealloc queues */
 	if(queueReduce)
 		clReleaseCommandQueue(queueReduce);
+	if(transferQueueReduce)
+		clReleaseCommandQueue(transferQueueReduce);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -62,3 +62,103 @@ reduce(__global const FPTYPE *g_idata, __global FPTYPE *g_odata,
         g_odata[get_group_id(0)] = sdata[0];
     }
 }
+
+// Multi-stage reduction (kern.full.xml, kern.full.double.xml and
+// kern.full.int.xml), instantiated below for float, double and int.
+// reduce_partials_* reduces a grid-strided share of the n elements into one
+// partial per work-group (any n, unlike reduce above), then reduce_final_*
+// reduces these partials in a single work-group into the result. For
+// REDUCE_DOT, the first stage multiplies x and y and both stages add.
+#define REDUCE_SUM 0
+#define REDUCE_MIN 1
+#define REDUCE_MAX 2
+#define REDUCE_DOT 3
+
+#define REDUCTION(T, T_MAX, T_MIN)\
+inline T reduceIdentity_##T(int op)\
+{\
+    return (op == REDUCE_MIN) ? T_MAX : ((op == REDUCE_MAX) ? T_MIN : (T) 0);\
+}\
+\
+inline T reduceOp_##T(T a, T b, int op)\
+{\
+    if (op == REDUCE_MIN)\
+        return (b < a) ? b : a;\
+    if (op == REDUCE_MAX)\
+        return (b > a) ? b : a;\
+    return a + b;\
+}\
+\
+inline void reduceLocalMem_##T(__local T* sdata, int op)\
+{\
+    const unsigned int tid = get_local_id(0);\
+\
+    for (unsigned int s = get_local_size(0) / 2; s > 0; s >>= 1)\
+    {\
+        if (tid < s)\
+        {\
+            sdata[tid] = reduceOp_##T(sdata[tid], sdata[tid + s], op);\
+        }\
+        barrier(CLK_LOCAL_MEM_FENCE);\
+    }\
+}\
+\
+__attribute__((reqd_work_group_size(256,1,1)))\
+__kernel void\
+reduce_partials_##T(__global const T *x, __global const T *y,\
+       __global T *partials, __local T* sdata,\
+       const unsigned int n, const int op)\
+{\
+    const unsigned int tid = get_local_id(0);\
+    unsigned int i = (get_group_id(0)*(get_local_size(0)*2)) + tid;\
+    const unsigned int gridSize = get_local_size(0)*2*get_num_groups(0);\
+    const unsigned int blockSize = get_local_size(0);\
+    T acc = reduceIdentity_##T(op);\
+\
+    /* Reduce multiple elements per thread, strided by grid size */\
+    while (i < n)\
+    {\
+        acc = reduceOp_##T(acc, (op == REDUCE_DOT) ? x[i] * y[i] : x[i], op);\
+        if (i + blockSize < n)\
+            acc = reduceOp_##T(acc, (op == REDUCE_DOT) ? x[i + blockSize] * y[i + blockSize] : x[i + blockSize], op);\
+        i += gridSize;\
+    }\
+\
+    sdata[tid] = acc;\
+    barrier(CLK_LOCAL_MEM_FENCE);\
+    reduceLocalMem_##T(sdata, op);\
+\
+    if (tid == 0)\
+    {\
+        partials[get_group_id(0)] = sdata[0];\
+    }\
+}\
+\
+__attribute__((reqd_work_group_size(256,1,1)))\
+__kernel void\
+reduce_final_##T(__global const T *partials, __global T *result,\
+       __local T* sdata, const unsigned int ngroups, const int op)\
+{\
+    const unsigned int tid = get_local_id(0);\
+    T acc = reduceIdentity_##T(op);\
+\
+    for (unsigned int i = tid; i < ngroups; i += get_local_size(0))\
+        acc = reduceOp_##T(acc, partials[i], op);\
+\
+    sdata[tid] = acc;\
+    barrier(CLK_LOCAL_MEM_FENCE);\
+    reduceLocalMem_##T(sdata, op);\
+\
+    if (tid == 0)\
+    {\
+        result[0] = sdata[0];\
+    }\
+}
+
+REDUCTION(float, INFINITY, -INFINITY)
+REDUCTION(int, INT_MAX, INT_MIN)
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+REDUCTION(double, (double) INFINITY, (double) -INFINITY)
+#endif
@@ -1,5 +1,5 @@
 #define PREAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n) {\
-	int _i, _j;\
+	int _i;\
 	unsigned int _vars = 3;\
 	char *_fileNames[] = {\
 		"inputIn",\
@@ -28,3 +28,32 @@
 		fclose(ipf);\
 	}\
 }
+
+/* Full pipeline descriptions (kern.full.xml, kern.full.int.xml): the input follows the pattern of inputIn for any n */
+#define FULLPREAMBLE(in, n, ngroups) {\
+	int _i;\
+\
+	ASSERT_CALL((ngroups > 0) && (ngroups <= 256), fprintf(stderr, "Error: ngroups is %d, top_scan scans 1 to 256 block sums.\n", ngroups); rv = EXIT_FAILURE);\
+	for(_i = 0; _i < n; _i++)\
+		in[_i] = _i % 3;\
+}
+
+/* Validate against a host scan accumulated in double, within a relative epsilon */
+#define FULLPOSTAMBLE(in, out, n, exclusive, epsilon) {\
+	int _i, _invalid = 0;\
+	double _sum = 0, _expected, _diff;\
+\
+	for(_i = 0; _i < n; _i++) {\
+		_expected = exclusive? _sum : _sum + in[_i];\
+		_sum += in[_i];\
+		_diff = (out[_i] > _expected)? out[_i] - _expected : _expected - out[_i];\
+		if(_diff > epsilon * ((_expected > 1)? _expected : 1)) {\
+			if(!_invalid)\
+				PRINT_FAIL();\
+			if(_invalid < 10)\
+				printf("Variable out[%d]: expected %f got %f.\n", _i, _expected, (double) out[_i]);\
+			_invalid++;\
+		}\
+	}\
+	ASSERT_CALL(!_invalid, fprintf(stderr, "Error: %d of %d elements are invalid.\n", _invalid, n); rv = EXIT_FAILURE);\
+}
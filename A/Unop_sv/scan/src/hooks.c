@@ -0,0 +1,174 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n);
+ *            POSTAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n);
+ *            LOOPPREAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n, loopFlag);
+ *            LOOPPOSTAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n, loopFlag);
+ *            CLEANUP(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n);
+ *        and, when running the full pipeline descriptions (kern.full.xml, kern.full.int.xml):
+ *            FULLPREAMBLE(in, n, ngroups);
+ *            FULLPOSTAMBLE(in, out, n, exclusive, epsilon);
+ *        where:
+ *            in: variable (float *);
+ *            inSz: number of members in variable (unsigned int);
+ *            isums: variable (float *);
+ *            isumsSz: number of members in variable (unsigned int);
+ *            out: variable (float *);
+ *            outSz: number of members in variable (unsigned int);
+ *            outC: variable (float *);
+ *            outCSz: number of members in variable (unsigned int);
+ *            n: variable (int);
+ *            ngroups: number of work-groups, thus of block sums (int);
+ *            exclusive: 1 for an exclusive scan, 0 for an inclusive scan (int);
+ *            epsilon: relative error accepted when validating (double);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *in = NULL;
+static unsigned int inSz = 0;
+static float *isums = NULL;
+static unsigned int isumsSz = 0;
+static float *out = NULL;
+static unsigned int outSz = 0;
+static float *outC = NULL;
+static unsigned int outCSz = 0;
+static int n;
+
+/* Full pipeline descriptions (kern.full.xml, kern.full.int.xml) variables */
+static float *blockSums = NULL;
+static unsigned int blockSumsSz = 0;
+static int *inInt = NULL;
+static unsigned int inIntSz = 0;
+static int *blockSumsInt = NULL;
+static unsigned int blockSumsIntSz = 0;
+static int *outInt = NULL;
+static unsigned int outIntSz = 0;
+static int ngroups;
+static int exclusive;
+
+/* Work sizes */
+static size_t *globalSizeBottom_Scan = NULL;
+static size_t *localSizeBottom_Scan = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(in),
+	RT_BIND_POINTER(isums),
+	RT_BIND_POINTER_C(out),
+	RT_BIND_VALUE(n),
+	RT_BIND_POINTER(blockSums),
+	RT_BIND_POINTER(inInt),
+	RT_BIND_POINTER(blockSumsInt),
+	RT_BIND_POINTER(outInt),
+	RT_BIND_VALUE(ngroups),
+	RT_BIND_VALUE(exclusive),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(bottom_scan, Bottom_Scan),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	if(blockSums) {
+		FULLPREAMBLE(in, n, ngroups);
+	}
+	else if(blockSumsInt) {
+		FULLPREAMBLE(inInt, n, ngroups);
+	}
+	else {
+		PREAMBLE(in, inSz, isums, isumsSz, out, outSz, outC, outCSz, n);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	if(!blockSums && !blockSumsInt)
+		return rv;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	if(blockSums) {
+		FULLPOSTAMBLE(in, out, n, exclusive, 1e-5);
+	}
+	else {
+		FULLPOSTAMBLE(inInt, outInt, n, exclusive, 0);
+	}
+	PRINT_SUCCESS();
+
+_err:
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
@@ -95,6 +95,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBottom_Scan = NULL;
+	cl_command_queue transferQueueBottom_Scan = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -103,8 +104,10 @@ int main(void) {
 	cl_kernel kernelBottom_Scan = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimBottom_Scan = 1;
 	size_t globalSizeBottom_Scan[1] = {
 		16384
@@ -155,7 +158,13 @@ int main(void) {
 
 	/* Create command queue for bottom_scan kernel */
 	PRINT_STEP("Creating command queue for \"bottom_scan\"...");
-	queueBottom_Scan = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBottom_Scan = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bottom_scan kernel */
+	PRINT_STEP("Creating transfer command queue for \"bottom_scan\"...");
+	transferQueueBottom_Scan = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -176,18 +185,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create bottom_scan kernel */
 	PRINT_STEP("Creating kernel \"bottom_scan\" from program...");
 	kernelBottom_Scan = clCreateKernel(program, "bottom_scan", &fRet);
@@ -221,19 +243,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBottom_Scan, inK, CL_TRUE, 0, 262144 * sizeof(float), in, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBottom_Scan, inK, TRANSFER_BLOCKING, 0, 262144 * sizeof(float), in, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "in"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (inK)"));
-		fRet = clEnqueueWriteBuffer(queueBottom_Scan, isumsK, CL_TRUE, 0, 64 * sizeof(float), isums, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBottom_Scan, isumsK, TRANSFER_BLOCKING, 0, 64 * sizeof(float), isums, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "isums"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (isumsK)"));
-		fRet = clEnqueueWriteBuffer(queueBottom_Scan, outK, CL_TRUE, 0, 262144 * sizeof(float), out, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBottom_Scan, outK, TRANSFER_BLOCKING, 0, 262144 * sizeof(float), out, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outK)"));
 		fRet = clSetKernelArg(kernelBottom_Scan, 3, sizeof(int), &n);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (n)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBottom_Scan);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBottom_Scan, kernelBottom_Scan, workDimBottom_Scan, NULL, globalSizeBottom_Scan, localSizeBottom_Scan, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBottom_Scan, kernelBottom_Scan, workDimBottom_Scan, NULL, globalSizeBottom_Scan, localSizeBottom_Scan, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bottom_scan"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBottom_Scan);
 		gettimeofday(&tNow, NULL);
@@ -241,9 +264,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBottom_Scan, outK, CL_TRUE, 0, 262144 * sizeof(float), out, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBottom_Scan, outK, TRANSFER_BLOCKING, 0, 262144 * sizeof(float), out, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -254,6 +279,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -271,6 +298,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(inK)
 		clReleaseMemObject(inK);
@@ -300,6 +330,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBottom_Scan)
 		clReleaseCommandQueue(queueBottom_Scan);
+	if(transferQueueBottom_Scan)
+		clReleaseCommandQueue(transferQueueBottom_Scan);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -130,3 +130,142 @@ bottom_scan(__global const float * in,
 
 
 
+
+// Full scan pipeline (kern.full.xml and kern.full.int.xml), instantiated
+// below for float and int. reduce sums the block of each work-group,
+// top_scan exclusively scans these block sums in a single work-group and
+// bottom_scan scans every block seeded with its scanned sum. Blocks are
+// split as in bottom_scan above, but n may be any size: the tail of the last
+// 4-element vector is masked. Set exclusive to 1 for an exclusive scan or 0
+// for an inclusive scan.
+#define SCAN_PIPELINE(T)\
+inline T scanLocalMem_##T(T val, __local T* lmem, int exclusive)\
+{\
+    int idx = get_local_id(0);\
+    lmem[idx] = (T) 0;\
+\
+    idx += get_local_size(0);\
+    lmem[idx] = val;\
+    barrier(CLK_LOCAL_MEM_FENCE);\
+\
+    T t;\
+    for (int i = 1; i < get_local_size(0); i *= 2)\
+    {\
+        t = lmem[idx -  i]; barrier(CLK_LOCAL_MEM_FENCE);\
+        lmem[idx] += t;     barrier(CLK_LOCAL_MEM_FENCE);\
+    }\
+    return lmem[idx-exclusive];\
+}\
+\
+__attribute__((reqd_work_group_size(256,1,1)))\
+__kernel void\
+reduce_##T(__global const T * in,\
+           __global T * isums,\
+           const int n,\
+           __local T * lmem)\
+{\
+    int n4 = (n + 3) / 4;\
+    int region_size = (n4 / get_num_groups(0)) * 4;\
+    int block_start = get_group_id(0) * region_size;\
+    /* Give the last block any extra elements */\
+    int block_stop  = (get_group_id(0) == get_num_groups(0) - 1) ?\
+        n : block_start + region_size;\
+\
+    int tid = get_local_id(0);\
+    int i = block_start + tid;\
+\
+    T sum = (T) 0;\
+    while (i < block_stop) {\
+        sum += in[i];\
+        i += get_local_size(0);\
+    }\
+\
+    lmem[tid] = sum;\
+    barrier(CLK_LOCAL_MEM_FENCE);\
+\
+    for (int s = get_local_size(0) / 2; s > 0; s >>= 1) {\
+        if (tid < s)\
+            lmem[tid] += lmem[tid + s];\
+        barrier(CLK_LOCAL_MEM_FENCE);\
+    }\
+\
+    if (tid == 0)\
+        isums[get_group_id(0)] = lmem[0];\
+}\
+\
+__attribute__((reqd_work_group_size(256,1,1)))\
+__kernel void\
+top_scan_##T(__global T * isums,\
+             const int n,\
+             __local T * lmem)\
+{\
+    /* n (the number of blocks) must not exceed the work-group size */\
+    T val = (get_local_id(0) < n) ? isums[get_local_id(0)] : (T) 0;\
+    T res = scanLocalMem_##T(val, lmem, 1);\
+\
+    if (get_local_id(0) < n)\
+        isums[get_local_id(0)] = res;\
+}\
+\
+__attribute__((reqd_work_group_size(256,1,1)))\
+__kernel void\
+bottom_scan_##T(__global const T * in,\
+                __global const T * isums,\
+                __global T * out,\
+                const int n,\
+                const int exclusive,\
+                __local T * lmem)\
+{\
+    __local T s_seed;\
+\
+    int n4 = (n + 3) / 4;\
+    int region_size = n4 / get_num_groups(0);\
+    int block_start = get_group_id(0) * region_size;\
+    int block_stop  = (get_group_id(0) == get_num_groups(0) - 1) ?\
+        n4 : block_start + region_size;\
+\
+    int i = block_start + get_local_id(0);\
+    int window = block_start;\
+\
+    T seed = isums[get_group_id(0)];\
+\
+    while (window < block_stop) {\
+        int base = i * 4;\
+        bool valid = i < block_stop;\
+        T x = (valid && (base     < n)) ? in[base]     : (T) 0;\
+        T y = (valid && (base + 1 < n)) ? in[base + 1] : (T) 0;\
+        T z = (valid && (base + 2 < n)) ? in[base + 2] : (T) 0;\
+        T w = (valid && (base + 3 < n)) ? in[base + 3] : (T) 0;\
+\
+        /* Serial scan in registers */\
+        T sy = x + y;\
+        T sz = sy + z;\
+        T sw = sz + w;\
+\
+        /* ExScan sums in local memory */\
+        T res = scanLocalMem_##T(sw, lmem, 1) + seed;\
+\
+        /* Exclusive results are shifted by one element */\
+        if (valid) {\
+            if (base     < n) out[base]     = exclusive ? res      : res + x;\
+            if (base + 1 < n) out[base + 1] = exclusive ? res + x  : res + sy;\
+            if (base + 2 < n) out[base + 2] = exclusive ? res + sy : res + sz;\
+            if (base + 3 < n) out[base + 3] = exclusive ? res + sz : res + sw;\
+        }\
+\
+        /* Last thread puts the next seed into smem */\
+        barrier(CLK_LOCAL_MEM_FENCE);\
+        if (get_local_id(0) == get_local_size(0)-1) {\
+              s_seed = res + sw;\
+        }\
+        barrier(CLK_LOCAL_MEM_FENCE);\
+\
+        seed = s_seed;\
+\
+        window += get_local_size(0);\
+        i += get_local_size(0);\
+    }\
+}
+
+SCAN_PIPELINE(float)
+SCAN_PIPELINE(int)
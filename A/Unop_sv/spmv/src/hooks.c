@@ -0,0 +1,138 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz);
+ *            POSTAMBLE(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz);
+ *            LOOPPREAMBLE(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz, loopFlag);
+ *            LOOPPOSTAMBLE(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz, loopFlag);
+ *            CLEANUP(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz);
+ *        where:
+ *            val: variable (float *);
+ *            valSz: number of members in variable (unsigned int);
+ *            vec: variable (float *);
+ *            vecSz: number of members in variable (unsigned int);
+ *            cols: variable (int *);
+ *            colsSz: number of members in variable (unsigned int);
+ *            rowDelimiters: variable (int *);
+ *            rowDelimitersSz: number of members in variable (unsigned int);
+ *            dim: variable (int);
+ *            vecWidth: variable (int);
+ *            out: variable (float *);
+ *            outSz: number of members in variable (unsigned int);
+ *            outC: variable (float *);
+ *            outCSz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *val = NULL;
+static unsigned int valSz = 0;
+static float *vec = NULL;
+static unsigned int vecSz = 0;
+static int *cols = NULL;
+static unsigned int colsSz = 0;
+static int *rowDelimiters = NULL;
+static unsigned int rowDelimitersSz = 0;
+static int dim;
+static int vecWidth;
+static float *out = NULL;
+static unsigned int outSz = 0;
+static float *outC = NULL;
+static unsigned int outCSz = 0;
+
+/* Work sizes */
+static size_t *globalSizeSpmv_Csr_Vector_Kernel = NULL;
+static size_t *localSizeSpmv_Csr_Vector_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(val),
+	RT_BIND_POINTER(vec),
+	RT_BIND_POINTER(cols),
+	RT_BIND_POINTER(rowDelimiters),
+	RT_BIND_VALUE(dim),
+	RT_BIND_VALUE(vecWidth),
+	RT_BIND_POINTER_C(out),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(spmv_csr_vector_kernel, Spmv_Csr_Vector_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(val, valSz, vec, vecSz, cols, colsSz, rowDelimiters, rowDelimitersSz, dim, vecWidth, out, outSz, outC, outCSz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
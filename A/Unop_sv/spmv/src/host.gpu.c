@@ -100,6 +100,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueSpmv_Csr_Vector_Kernel = NULL;
+	cl_command_queue transferQueueSpmv_Csr_Vector_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -108,8 +109,10 @@ int main(void) {
 	cl_kernel kernelSpmv_Csr_Vector_Kernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimSpmv_Csr_Vector_Kernel = 1;
 	size_t globalSizeSpmv_Csr_Vector_Kernel[1] = {
 		131072
@@ -165,7 +168,13 @@ int main(void) {
 
 	/* Create command queue for spmv_csr_vector_kernel kernel */
 	PRINT_STEP("Creating command queue for \"spmv_csr_vector_kernel\"...");
-	queueSpmv_Csr_Vector_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueSpmv_Csr_Vector_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for spmv_csr_vector_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"spmv_csr_vector_kernel\"...");
+	transferQueueSpmv_Csr_Vector_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -186,18 +195,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create spmv_csr_vector_kernel kernel */
 	PRINT_STEP("Creating kernel \"spmv_csr_vector_kernel\" from program...");
 	kernelSpmv_Csr_Vector_Kernel = clCreateKernel(program, "spmv_csr_vector_kernel", &fRet);
@@ -239,25 +261,26 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueSpmv_Csr_Vector_Kernel, valK, CL_TRUE, 0, 10485 * sizeof(float), val, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSpmv_Csr_Vector_Kernel, valK, TRANSFER_BLOCKING, 0, 10485 * sizeof(float), val, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "val"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (valK)"));
-		fRet = clEnqueueWriteBuffer(queueSpmv_Csr_Vector_Kernel, vecK, CL_TRUE, 0, 1024 * sizeof(float), vec, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSpmv_Csr_Vector_Kernel, vecK, TRANSFER_BLOCKING, 0, 1024 * sizeof(float), vec, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "vec"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (vecK)"));
-		fRet = clEnqueueWriteBuffer(queueSpmv_Csr_Vector_Kernel, colsK, CL_TRUE, 0, 10485 * sizeof(int), cols, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSpmv_Csr_Vector_Kernel, colsK, TRANSFER_BLOCKING, 0, 10485 * sizeof(int), cols, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "cols"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (colsK)"));
-		fRet = clEnqueueWriteBuffer(queueSpmv_Csr_Vector_Kernel, rowDelimitersK, CL_TRUE, 0, 1025 * sizeof(int), rowDelimiters, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSpmv_Csr_Vector_Kernel, rowDelimitersK, TRANSFER_BLOCKING, 0, 1025 * sizeof(int), rowDelimiters, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "rowDelimiters"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (rowDelimitersK)"));
 		fRet = clSetKernelArg(kernelSpmv_Csr_Vector_Kernel, 4, sizeof(int), &dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (dim)"));
 		fRet = clSetKernelArg(kernelSpmv_Csr_Vector_Kernel, 5, sizeof(int), &vecWidth);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (vecWidth)"));
-		fRet = clEnqueueWriteBuffer(queueSpmv_Csr_Vector_Kernel, outK, CL_TRUE, 0, 1024 * sizeof(float), out, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSpmv_Csr_Vector_Kernel, outK, TRANSFER_BLOCKING, 0, 1024 * sizeof(float), out, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (outK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueSpmv_Csr_Vector_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueSpmv_Csr_Vector_Kernel, kernelSpmv_Csr_Vector_Kernel, workDimSpmv_Csr_Vector_Kernel, NULL, globalSizeSpmv_Csr_Vector_Kernel, localSizeSpmv_Csr_Vector_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueSpmv_Csr_Vector_Kernel, kernelSpmv_Csr_Vector_Kernel, workDimSpmv_Csr_Vector_Kernel, NULL, globalSizeSpmv_Csr_Vector_Kernel, localSizeSpmv_Csr_Vector_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 5), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "spmv_csr_vector_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueSpmv_Csr_Vector_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -265,9 +288,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueSpmv_Csr_Vector_Kernel, outK, CL_TRUE, 0, 1024 * sizeof(float), out, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueSpmv_Csr_Vector_Kernel, outK, TRANSFER_BLOCKING, 0, 1024 * sizeof(float), out, ASYNC_WAIT_LIST(profileEvents, 5, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "out"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 6, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -278,6 +303,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -295,6 +322,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(valK)
 		clReleaseMemObject(valK);
@@ -330,6 +360,8 @@ _err:
 	/* Dealloc queues */
 	if(queueSpmv_Csr_Vector_Kernel)
 		clReleaseCommandQueue(queueSpmv_Csr_Vector_Kernel);
+	if(transferQueueSpmv_Csr_Vector_Kernel)
+		clReleaseCommandQueue(transferQueueSpmv_Csr_Vector_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -44,6 +44,7 @@ void srad2_soft(float d_lambda, int d_Nr, int d_Nc, long d_Ne,
 
 int gIndex = 0;
 float gQ0sqr[NITER];
+int gNiter = NITER;
 
 #define PREAMBLE(d_lambda, d_Nr, d_Nc, d_Ne,\
 		d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz,\
@@ -151,3 +152,61 @@ float gQ0sqr[NITER];
 		fprintf(opf, "%f\n", d_c[_i]);\
 	fclose(opf);\
 }
+
+/* Device-resident description (kern.resident.xml): q0sqr and srad2 run on the device for niter iterations over any image */
+#define RESIDENTPREAMBLE(d_Nr, d_Nc, d_Ne, d_iN, d_iS, d_jE, d_jW, d_I, niter) {\
+	int _i;\
+	FILE *ipf;\
+\
+	for(_i = 0; _i < d_Nr; _i++) {\
+		d_iN[_i] = _i - 1;\
+		d_iS[_i] = _i + 1;\
+	}\
+\
+	/* Same (swapped) d_jW and d_jE assignment as PREAMBLE */\
+	for(_i = 0; _i < d_Nc; _i++) {\
+		d_jE[_i] = _i - 1;\
+		d_jW[_i] = _i + 1;\
+	}\
+\
+	d_iN[0] = 0;\
+	d_iS[d_Nr - 1] = d_Nr - 1;\
+	d_jE[0] = 0;\
+	d_jW[d_Nc - 1] = d_Nc - 1;\
+\
+	ipf = fopen("inI", "r");\
+	ASSERT_CALL(ipf, fprintf(stderr, "Error: %s: %s\n", strerror(errno), "inI"); rv = EXIT_FAILURE);\
+	for(_i = 0; (_i < d_Ne) && (1 == fscanf(ipf, "%f", &d_I[_i])); _i++)\
+		fgetc(ipf);\
+	fclose(ipf);\
+	ASSERT_CALL(_i == d_Ne, fprintf(stderr, "Error: inI holds %d pixels, expected %ld.\n", _i, (long) d_Ne); rv = EXIT_FAILURE);\
+\
+	gNiter = niter;\
+	loopFlag = true;\
+}
+
+#define RESIDENTLOOPPREAMBLE() {\
+	if(gIndex >= gNiter)\
+		break;\
+}
+
+#define RESIDENTLOOPPOSTAMBLE() {\
+	gIndex++;\
+}
+
+/* Same output files as POSTAMBLE, plus the final image */
+#define RESIDENTPOSTAMBLE(d_Ne, d_dN, d_dS, d_dE, d_dW, d_c, d_I) {\
+	int _i;\
+	FILE *opf;\
+	const char *_names[6] = {"outN", "outS", "outE", "outW", "outC", "outI"};\
+	const float *_vars[6] = {d_dN, d_dS, d_dE, d_dW, d_c, d_I};\
+	int _v;\
+\
+	for(_v = 0; _v < 6; _v++) {\
+		opf = fopen(_names[_v], "w");\
+		ASSERT_CALL(opf, fprintf(stderr, "Error: %s: %s\n", strerror(errno), _names[_v]); rv = EXIT_FAILURE);\
+		for(_i = 0; _i < d_Ne; _i++)\
+			fprintf(opf, "%f\n", _vars[_v][_i]);\
+		fclose(opf);\
+	}\
+}
@@ -27,9 +27,9 @@
 #define fp float
 #define NUMBER_THREADS 256
 
-__attribute__((reqd_work_group_size(256,1,1)))
-__kernel void 
-srad_kernel(fp d_lambda, 
+// Body of srad_kernel, shared with srad_kernel_resident
+void
+srad_compute(fp d_lambda, 
 			int d_Nr, 
 			int d_Nc, 
 			long d_Ne, 
@@ -110,3 +110,176 @@ srad_kernel(fp d_lambda,
 	}
 	
 }
+
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void 
+srad_kernel(fp d_lambda, 
+			int d_Nr, 
+			int d_Nc, 
+			long d_Ne, 
+			__global int* d_iN, 
+			__global int* d_iS, 
+			__global int* d_jE, 
+			__global int* d_jW, 
+			__global fp* d_dN, 
+			__global fp* d_dS, 
+			__global fp* d_dE, 
+			__global fp* d_dW, 
+			fp d_q0sqr, 
+			__global fp* d_c, 
+			__global fp* d_I){
+
+	srad_compute(d_lambda, d_Nr, d_Nc, d_Ne, d_iN, d_iS, d_jE, d_jW, d_dN, d_dS, d_dE, d_dW, d_q0sqr, d_c, d_I);
+
+}
+
+// Same as srad_kernel, with q0sqr computed on the device by srad_q0sqr
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void 
+srad_kernel_resident(fp d_lambda, 
+			int d_Nr, 
+			int d_Nc, 
+			long d_Ne, 
+			__global int* d_iN, 
+			__global int* d_iS, 
+			__global int* d_jE, 
+			__global int* d_jW, 
+			__global fp* d_dN, 
+			__global fp* d_dS, 
+			__global fp* d_dE, 
+			__global fp* d_dW, 
+			__global fp* d_q0sqr, 
+			__global fp* d_c, 
+			__global fp* d_I){
+
+	srad_compute(d_lambda, d_Nr, d_Nc, d_Ne, d_iN, d_iS, d_jE, d_jW, d_dN, d_dS, d_dE, d_dW, *d_q0sqr, d_c, d_I);
+
+}
+
+// Sums the image and its squares over each work-group (the prepare and
+// reduce kernels of the original implementation), leaving one partial
+// per work-group
+__attribute__((reqd_work_group_size(NUMBER_THREADS,1,1)))
+__kernel void
+srad_reduce(long d_Ne,
+			__global fp* d_I,
+			__global fp* d_sums,
+			__global fp* d_sums2){
+
+	__local fp d_psum[NUMBER_THREADS];
+	__local fp d_psum2[NUMBER_THREADS];
+	int tx = get_local_id(0);
+	int ei = get_global_id(0);
+	fp d_Jc = (ei < d_Ne)? d_I[ei] : 0;
+
+	d_psum[tx] = d_Jc;
+	d_psum2[tx] = d_Jc * d_Jc;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int s = NUMBER_THREADS / 2; s > 0; s >>= 1){
+		if(tx < s){
+			d_psum[tx] += d_psum[tx + s];
+			d_psum2[tx] += d_psum2[tx + s];
+		}
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+
+	if(0 == tx){
+		d_sums[get_group_id(0)] = d_psum[0];
+		d_sums2[get_group_id(0)] = d_psum2[0];
+	}
+
+}
+
+// Reduces the d_ngroups partials of srad_reduce into the statistic of the
+// image used as q0sqr (variance over squared mean). Must be launched as a
+// single work-group
+__attribute__((reqd_work_group_size(NUMBER_THREADS,1,1)))
+__kernel void
+srad_q0sqr(long d_Ne,
+			int d_ngroups,
+			__global fp* d_sums,
+			__global fp* d_sums2,
+			__global fp* d_q0sqr){
+
+	__local fp d_psum[NUMBER_THREADS];
+	__local fp d_psum2[NUMBER_THREADS];
+	int tx = get_local_id(0);
+	fp sum = 0;
+	fp sum2 = 0;
+	fp d_mean, d_var;
+
+	for(int g = tx; g < d_ngroups; g += NUMBER_THREADS){
+		sum += d_sums[g];
+		sum2 += d_sums2[g];
+	}
+	d_psum[tx] = sum;
+	d_psum2[tx] = sum2;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	for(int s = NUMBER_THREADS / 2; s > 0; s >>= 1){
+		if(tx < s){
+			d_psum[tx] += d_psum[tx + s];
+			d_psum2[tx] += d_psum2[tx + s];
+		}
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}
+
+	if(0 == tx){
+		d_mean = d_psum[0] / d_Ne;
+		d_var = (d_psum2[0] / d_Ne) - d_mean * d_mean;
+		*d_q0sqr = d_var / (d_mean * d_mean);
+	}
+
+}
+
+// Device version of srad2_soft: updates the image in place from the
+// derivatives and diffusion coefficients of srad_kernel
+__attribute__((reqd_work_group_size(256,1,1)))
+__kernel void
+srad2_kernel(fp d_lambda,
+			int d_Nr,
+			int d_Nc,
+			long d_Ne,
+			__global int* d_iN,
+			__global int* d_iS,
+			__global int* d_jE,
+			__global int* d_jW,
+			__global fp* d_dN,
+			__global fp* d_dS,
+			__global fp* d_dE,
+			__global fp* d_dW,
+			__global fp* d_c,
+			__global fp* d_I){
+
+	int bx = get_group_id(0);
+	int tx = get_local_id(0);
+	int ei = bx*NUMBER_THREADS+tx;
+	int row;
+	int col;
+
+	fp d_cN, d_cS, d_cW, d_cE;
+	fp d_D;
+
+	row = (ei+1) % d_Nr - 1;
+	col = (ei+1) / d_Nr + 1 - 1;
+	if((ei+1) % d_Nr == 0){
+		row = d_Nr - 1;
+		col = col - 1;
+	}
+
+	if(ei<d_Ne){
+		// diffusion coefficients (west and north are the current element, as in the original implementation)
+		d_cN = d_c[ei];
+		d_cS = d_c[d_iS[row] + d_Nr*col];
+		d_cW = d_c[ei];
+		d_cE = d_c[row + d_Nr * d_jE[col]];
+
+		// divergence (equ 58)
+		d_D = d_cN*d_dN[ei] + d_cS*d_dS[ei] + d_cW*d_dW[ei] + d_cE*d_dE[ei];
+
+		// image update (equ 61)
+		d_I[ei] = d_I[ei] + 0.25*d_lambda*d_D;
+	}
+
+}
@@ -0,0 +1,129 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal);
+ *            POSTAMBLE(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal);
+ *            LOOPPREAMBLE(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal, loopFlag);
+ *            LOOPPOSTAMBLE(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal, loopFlag);
+ *            CLEANUP(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal);
+ *        where:
+ *            data: variable (float *);
+ *            dataSz: number of members in variable (unsigned int);
+ *            newData: variable (float *);
+ *            newDataSz: number of members in variable (unsigned int);
+ *            newDataC: variable (float *);
+ *            newDataCSz: number of members in variable (unsigned int);
+ *            alignment: variable (int);
+ *            wCenter: variable (float);
+ *            wCardinal: variable (float);
+ *            wDiagonal: variable (float);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *data = NULL;
+static unsigned int dataSz = 0;
+static float *newData = NULL;
+static unsigned int newDataSz = 0;
+static float *newDataC = NULL;
+static unsigned int newDataCSz = 0;
+static int alignment;
+static float wCenter;
+static float wCardinal;
+static float wDiagonal;
+
+/* Work sizes */
+static size_t *globalSizeStencilkernel = NULL;
+static size_t *localSizeStencilkernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(data),
+	RT_BIND_POINTER_C(newData),
+	RT_BIND_VALUE(alignment),
+	RT_BIND_VALUE(wCenter),
+	RT_BIND_VALUE(wCardinal),
+	RT_BIND_VALUE(wDiagonal),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(StencilKernel, Stencilkernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(data, dataSz, newData, newDataSz, newDataC, newDataCSz, alignment, wCenter, wCardinal, wDiagonal);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
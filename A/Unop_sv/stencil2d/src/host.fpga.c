@@ -96,6 +96,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueStencilkernel = NULL;
+	cl_command_queue transferQueueStencilkernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -106,6 +107,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
 	cl_uint workDimStencilkernel = 2;
 	size_t globalSizeStencilkernel[2] = {
 		64, 512
@@ -157,7 +159,13 @@ int main(void) {
 
 	/* Create command queue for StencilKernel kernel */
 	PRINT_STEP("Creating command queue for \"StencilKernel\"...");
-	queueStencilkernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueStencilkernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for StencilKernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"StencilKernel\"...");
+	transferQueueStencilkernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -226,9 +234,9 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueStencilkernel, dataK, CL_TRUE, 0, 271392 * sizeof(float), data, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueStencilkernel, dataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), data, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "data"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dataK)"));
-		fRet = clEnqueueWriteBuffer(queueStencilkernel, newDataK, CL_TRUE, 0, 271392 * sizeof(float), newData, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueStencilkernel, newDataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), newData, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "newData"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (newDataK)"));
 		fRet = clSetKernelArg(kernelStencilkernel, 2, sizeof(int), &alignment);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (alignment)"));
@@ -241,8 +249,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueStencilkernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueStencilkernel, kernelStencilkernel, workDimStencilkernel, NULL, globalSizeStencilkernel, localSizeStencilkernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueStencilkernel, kernelStencilkernel, workDimStencilkernel, NULL, globalSizeStencilkernel, localSizeStencilkernel, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "StencilKernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueStencilkernel);
 		gettimeofday(&tNow, NULL);
@@ -250,9 +259,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueStencilkernel, newDataK, CL_TRUE, 0, 271392 * sizeof(float), newData, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueStencilkernel, newDataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), newData, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "newData"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -263,6 +274,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -280,6 +292,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(dataK)
 		clReleaseMemObject(dataK);
@@ -306,6 +321,8 @@ _err:
 	/* Dealloc queues */
 	if(queueStencilkernel)
 		clReleaseCommandQueue(queueStencilkernel);
+	if(transferQueueStencilkernel)
+		clReleaseCommandQueue(transferQueueStencilkernel);
 
 	/* Last OpenCL variables */
 	if(context)
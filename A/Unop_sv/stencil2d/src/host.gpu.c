@@ -96,6 +96,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueStencilkernel = NULL;
+	cl_command_queue transferQueueStencilkernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -104,8 +105,10 @@ int main(void) {
 	cl_kernel kernelStencilkernel = NULL;
 	bool loopFlag = false;
 	bool invalidDataFound = false;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 4);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimStencilkernel = 2;
 	size_t globalSizeStencilkernel[2] = {
 		64, 512
@@ -157,7 +160,13 @@ int main(void) {
 
 	/* Create command queue for StencilKernel kernel */
 	PRINT_STEP("Creating command queue for \"StencilKernel\"...");
-	queueStencilkernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueStencilkernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for StencilKernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"StencilKernel\"...");
+	transferQueueStencilkernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -178,18 +187,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create StencilKernel kernel */
 	PRINT_STEP("Creating kernel \"StencilKernel\" from program...");
 	kernelStencilkernel = clCreateKernel(program, "StencilKernel", &fRet);
@@ -225,9 +247,9 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueStencilkernel, dataK, CL_TRUE, 0, 271392 * sizeof(float), data, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueStencilkernel, dataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), data, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "data"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dataK)"));
-		fRet = clEnqueueWriteBuffer(queueStencilkernel, newDataK, CL_TRUE, 0, 271392 * sizeof(float), newData, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueStencilkernel, newDataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), newData, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "newData"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (newDataK)"));
 		fRet = clSetKernelArg(kernelStencilkernel, 2, sizeof(int), &alignment);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (alignment)"));
@@ -240,8 +262,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueStencilkernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueStencilkernel, kernelStencilkernel, workDimStencilkernel, NULL, globalSizeStencilkernel, localSizeStencilkernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueStencilkernel, kernelStencilkernel, workDimStencilkernel, NULL, globalSizeStencilkernel, localSizeStencilkernel, ASYNC_WAIT_LIST(profileEvents, 0, 2), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "StencilKernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueStencilkernel);
 		gettimeofday(&tNow, NULL);
@@ -249,9 +272,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueStencilkernel, newDataK, CL_TRUE, 0, 271392 * sizeof(float), newData, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueStencilkernel, newDataK, TRANSFER_BLOCKING, 0, 271392 * sizeof(float), newData, ASYNC_WAIT_LIST(profileEvents, 2, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "newData"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 3, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -262,6 +287,8 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -279,6 +306,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(dataK)
 		clReleaseMemObject(dataK);
@@ -305,6 +335,8 @@ _err:
 	/* Dealloc queues */
 	if(queueStencilkernel)
 		clReleaseCommandQueue(queueStencilkernel);
+	if(transferQueueStencilkernel)
+		clReleaseCommandQueue(transferQueueStencilkernel);
 
 	/* Last OpenCL variables */
 	if(context)
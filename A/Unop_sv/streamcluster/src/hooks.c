@@ -0,0 +1,155 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K);
+ *            POSTAMBLE(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K);
+ *            LOOPPREAMBLE(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K, loopFlag);
+ *            LOOPPOSTAMBLE(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K, loopFlag);
+ *            CLEANUP(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K);
+ *        where:
+ *            p_weight: variable (float *);
+ *            p_weightSz: number of members in variable (unsigned int);
+ *            p_assign: variable (long *);
+ *            p_assignSz: number of members in variable (unsigned int);
+ *            p_cost: variable (float *);
+ *            p_costSz: number of members in variable (unsigned int);
+ *            coord_d: variable (float *);
+ *            coord_dSz: number of members in variable (unsigned int);
+ *            work_mem_d: variable (float *);
+ *            work_mem_dSz: number of members in variable (unsigned int);
+ *            work_mem_dC: variable (float *);
+ *            work_mem_dCSz: number of members in variable (unsigned int);
+ *            center_table_d: variable (int *);
+ *            center_table_dSz: number of members in variable (unsigned int);
+ *            switch_membership_d: variable (char *);
+ *            switch_membership_dSz: number of members in variable (unsigned int);
+ *            switch_membership_dC: variable (char *);
+ *            switch_membership_dCSz: number of members in variable (unsigned int);
+ *            dim: variable (int);
+ *            x: variable (long);
+ *            K: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *p_weight = NULL;
+static unsigned int p_weightSz = 0;
+static long *p_assign = NULL;
+static unsigned int p_assignSz = 0;
+static float *p_cost = NULL;
+static unsigned int p_costSz = 0;
+static float *coord_d = NULL;
+static unsigned int coord_dSz = 0;
+static float *work_mem_d = NULL;
+static unsigned int work_mem_dSz = 0;
+static float *work_mem_dC = NULL;
+static unsigned int work_mem_dCSz = 0;
+static int *center_table_d = NULL;
+static unsigned int center_table_dSz = 0;
+static char *switch_membership_d = NULL;
+static unsigned int switch_membership_dSz = 0;
+static char *switch_membership_dC = NULL;
+static unsigned int switch_membership_dCSz = 0;
+static int dim;
+static long x;
+static int K;
+
+/* Work sizes */
+static size_t *globalSizePgain_Kernel = NULL;
+static size_t *localSizePgain_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(p_weight),
+	RT_BIND_POINTER(p_assign),
+	RT_BIND_POINTER(p_cost),
+	RT_BIND_POINTER(coord_d),
+	RT_BIND_POINTER_C(work_mem_d),
+	RT_BIND_POINTER(center_table_d),
+	RT_BIND_POINTER_C(switch_membership_d),
+	RT_BIND_VALUE(dim),
+	RT_BIND_VALUE(x),
+	RT_BIND_VALUE(K),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(pgain_kernel, Pgain_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(p_weight, p_weightSz, p_assign, p_assignSz, p_cost, p_costSz, coord_d, coord_dSz, work_mem_d, work_mem_dSz, work_mem_dC, work_mem_dCSz, center_table_d, center_table_dSz, switch_membership_d, switch_membership_dSz, switch_membership_dC, switch_membership_dCSz, dim, x, K);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -107,6 +107,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queuePgain_Kernel = NULL;
+	cl_command_queue transferQueuePgain_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -117,6 +118,7 @@ int main(void) {
 	bool invalidDataFound = false;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 10);
 	cl_uint workDimPgain_Kernel = 2;
 	size_t globalSizePgain_Kernel[2] = {
 		65536, 1
@@ -178,7 +180,13 @@ int main(void) {
 
 	/* Create command queue for pgain_kernel kernel */
 	PRINT_STEP("Creating command queue for \"pgain_kernel\"...");
-	queuePgain_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queuePgain_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for pgain_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"pgain_kernel\"...");
+	transferQueuePgain_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -265,19 +273,19 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, p_weightK, CL_TRUE, 0, 65536 * sizeof(float), p_weight, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, p_weightK, TRANSFER_BLOCKING, 0, 65536 * sizeof(float), p_weight, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "p_weight"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (p_weightK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, p_assignK, CL_TRUE, 0, 65536 * sizeof(long), p_assign, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, p_assignK, TRANSFER_BLOCKING, 0, 65536 * sizeof(long), p_assign, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "p_assign"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (p_assignK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, p_costK, CL_TRUE, 0, 65536 * sizeof(float), p_cost, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, p_costK, TRANSFER_BLOCKING, 0, 65536 * sizeof(float), p_cost, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "p_cost"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (p_costK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, coord_dK, CL_TRUE, 0, 4194304 * sizeof(float), coord_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, coord_dK, TRANSFER_BLOCKING, 0, 4194304 * sizeof(float), coord_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "coord_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (coord_dK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, work_mem_dK, CL_TRUE, 0, 786432 * sizeof(float), work_mem_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, work_mem_dK, TRANSFER_BLOCKING, 0, 786432 * sizeof(float), work_mem_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "work_mem_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (work_mem_dK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, center_table_dK, CL_TRUE, 0, 65536 * sizeof(int), center_table_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, center_table_dK, TRANSFER_BLOCKING, 0, 65536 * sizeof(int), center_table_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "center_table_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (center_table_dK)"));
-		fRet = clEnqueueWriteBuffer(queuePgain_Kernel, switch_membership_dK, CL_TRUE, 0, 65536 * sizeof(char), switch_membership_d, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueuePgain_Kernel, switch_membership_dK, TRANSFER_BLOCKING, 0, 65536 * sizeof(char), switch_membership_d, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "switch_membership_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (switch_membership_dK)"));
 		fRet = clSetKernelArg(kernelPgain_Kernel, 8, sizeof(int), &dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (dim)"));
@@ -288,8 +296,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueuePgain_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queuePgain_Kernel, kernelPgain_Kernel, workDimPgain_Kernel, NULL, globalSizePgain_Kernel, localSizePgain_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queuePgain_Kernel, kernelPgain_Kernel, workDimPgain_Kernel, NULL, globalSizePgain_Kernel, localSizePgain_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 7), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "pgain_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queuePgain_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -297,10 +306,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queuePgain_Kernel, work_mem_dK, CL_TRUE, 0, 786432 * sizeof(float), work_mem_d, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queuePgain_Kernel, switch_membership_dK, CL_TRUE, 0, 65536 * sizeof(char), switch_membership_d, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueuePgain_Kernel, work_mem_dK, TRANSFER_BLOCKING, 0, 786432 * sizeof(float), work_mem_d, ASYNC_WAIT_LIST(profileEvents, 7, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "work_mem_d"));
+		fRet = clEnqueueReadBuffer(transferQueuePgain_Kernel, switch_membership_dK, TRANSFER_BLOCKING, 0, 65536 * sizeof(char), switch_membership_d, ASYNC_WAIT_LIST(profileEvents, 7, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "switch_membership_d"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 8, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -311,6 +322,7 @@ int main(void) {
 	/* Print profiling results */
 	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -337,6 +349,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(p_weightK)
 		clReleaseMemObject(p_weightK);
@@ -379,6 +394,8 @@ _err:
 	/* Dealloc queues */
 	if(queuePgain_Kernel)
 		clReleaseCommandQueue(queuePgain_Kernel);
+	if(transferQueuePgain_Kernel)
+		clReleaseCommandQueue(transferQueuePgain_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -61,41 +61,27 @@ PROJECTS=(
 	"ndrsdfull"
 )
 
-EXECTIMES=10
+WARMUP=3
+MAXSAMPLES=1000
+ERROR=0.01
 TIMEGPU="$(pwd)/gpu.csv"
+NASTRING=",---,---,---,---,---,---,---,---,---,---"
 
 echo "Initialising csv files..."
-echo -n "kernel" > $TIMEGPU
-for i in `seq 1 $EXECTIMES`; do
-	echo -n ",total$(($i-1))" >> $TIMEGPU
-	NASTRING="$NASTRING,---"
-done
-for i in `seq 1 $EXECTIMES`; do
-	echo -n ",periter$(($i-1))" >> $TIMEGPU
-	NASTRING="$NASTRING,---"
-done
-echo "" >> $TIMEGPU
+echo "kernel,clkernel,samples,min,median,p95,p99,stddev,cv,ci95,setup" > $TIMEGPU
 
 echo "Running GPU projects..."
 for i in ${PROJECTS[@]}; do
 	if [ -d $i ]; then
 		echo -e "\tRunning: $i"
-		if [ -a $i/gpu/execute ]; then
+		if [ -a $i/gpu/rtexecute ]; then
 			cd $i
 			cd gpu
-			./execute &> out.log
-			echo -e "\t\tIteration: 0"
-			FULLTIMES="$(grep "Elapsed time" out.log | sed "s/Elapsed time spent on kernels: \\(.\\+\\) us;.*/\\1/g")"
-			ITERTIMES="$(grep "Elapsed time" out.log | sed "s/.*Average time per iteration: \\(.\\+\\) us./\\1/g")"
-			for j in `seq 2 $EXECTIMES`; do
-				echo -e "\t\tIteration: $(($j-1))"
-				./execute &> out.log
-				FULLTIMES="$FULLTIMES,$(grep "Elapsed time" out.log | sed "s/Elapsed time spent on kernels: \\(.\\+\\) us;.*/\\1/g")"
-				ITERTIMES="$ITERTIMES,$(grep "Elapsed time" out.log | sed "s/.*Average time per iteration: \\(.\\+\\) us./\\1/g")"
-			done
+			./rtexecute -w $WARMUP -r $MAXSAMPLES -e $ERROR &> out.log
+			SETUPTIME="$(grep "Time spent on program setup" out.log | sed "s/Time spent on program setup: \\(.\\+\\) us.*/\\1/g")"
+			grep "Benchmark of kernel" out.log | sed "s/Benchmark of kernel \"\\(.\\+\\)\": \\(.\\+\\) samples after .\\+ warmup launches; min: \\(.\\+\\) us; median: \\(.\\+\\) us; p95: \\(.\\+\\) us; p99: \\(.\\+\\) us; standard deviation: \\(.\\+\\) us; CV: \\(.\\+\\)%; 95% CI: +\\/- \\(.\\+\\)%./$i,\\1,\\2,\\3,\\4,\\5,\\6,\\7,\\8,\\9,$SETUPTIME/g" >> $TIMEGPU
 			cd ..
 			cd ..
-			echo "$i,$FULLTIMES,$ITERTIMES" >> $TIMEGPU
 		else
 			echo -e "\t\tProject is not compiled"
 			echo "$i$NASTRING" >> $TIMEGPU
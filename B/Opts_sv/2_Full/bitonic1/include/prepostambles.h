@@ -33,3 +33,42 @@
 	}\
 }
 
+
+/* Full sorter (host.full.c): random keys with their indexes as values. Keys equal to 0xFFFFFFFF are reserved for padding up to length */
+#define FULLPREAMBLE(keys, vals, size, length, seed) {\
+	unsigned int _i;\
+\
+	srand(seed);\
+	for(_i = 0; _i < size; _i++) {\
+		keys[_i] = (((unsigned int) rand()) << 16) ^ ((unsigned int) rand());\
+		if(0xFFFFFFFFu == keys[_i])\
+			keys[_i]--;\
+		vals[_i] = _i;\
+	}\
+	for(; _i < length; _i++) {\
+		keys[_i] = 0xFFFFFFFFu;\
+		vals[_i] = _i;\
+	}\
+}
+
+/* Keys must be in ascending order and every value must point to the input key it came with, exactly once */
+#define FULLPOSTAMBLE(keys, dstKeys, dstVals, size) {\
+	unsigned int _i;\
+	unsigned int _wrong = 0;\
+	char *_seen = calloc(size, 1);\
+\
+	ASSERT_CALL(_seen, fprintf(stderr, "Error: %s: seen\n", strerror(errno)); rv = EXIT_FAILURE);\
+	for(_i = 0; _i < size; _i++) {\
+		if((_i && (dstKeys[_i - 1] > dstKeys[_i])) || (dstVals[_i] >= size) || _seen[dstVals[_i]] || (keys[dstVals[_i]] != dstKeys[_i])) {\
+			if(!_wrong)\
+				fprintf(stderr, "Error: first wrong pair at %u: key %u, value %u.\n", _i, dstKeys[_i], dstVals[_i]);\
+			_wrong++;\
+		}\
+		else {\
+			_seen[dstVals[_i]] = 1;\
+		}\
+	}\
+	free(_seen);\
+\
+	ASSERT_CALL(!_wrong, fprintf(stderr, "Error: %u of %u pairs are wrong.\n", _wrong, size); rv = EXIT_FAILURE);\
+}
@@ -98,6 +98,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBitonicsortlocal1 = NULL;
+	cl_command_queue transferQueueBitonicsortlocal1 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,6 +110,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimBitonicsortlocal1 = 1;
 	size_t globalSizeBitonicsortlocal1[1] = {
 		2048
@@ -160,7 +162,13 @@ int main(void) {
 
 	/* Create command queue for bitonicSortLocal1 kernel */
 	PRINT_STEP("Creating command queue for \"bitonicSortLocal1\"...");
-	queueBitonicsortlocal1 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBitonicsortlocal1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bitonicSortLocal1 kernel */
+	PRINT_STEP("Creating transfer command queue for \"bitonicSortLocal1\"...");
+	transferQueueBitonicsortlocal1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -227,19 +235,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBitonicsortlocal1, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicsortlocal1, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicsortlocal1, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicsortlocal1, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstValK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicsortlocal1, d_SrcKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicsortlocal1, d_SrcKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicsortlocal1, d_SrcValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicsortlocal1, d_SrcValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcValK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBitonicsortlocal1);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBitonicsortlocal1, kernelBitonicsortlocal1, workDimBitonicsortlocal1, NULL, globalSizeBitonicsortlocal1, localSizeBitonicsortlocal1, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBitonicsortlocal1, kernelBitonicsortlocal1, workDimBitonicsortlocal1, NULL, globalSizeBitonicsortlocal1, localSizeBitonicsortlocal1, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bitonicSortLocal1"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBitonicsortlocal1);
 		gettimeofday(&tNow, NULL);
@@ -247,10 +256,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBitonicsortlocal1, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBitonicsortlocal1, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBitonicsortlocal1, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstKey"));
+		fRet = clEnqueueReadBuffer(transferQueueBitonicsortlocal1, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -261,6 +272,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -287,6 +299,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_DstKeyK)
 		clReleaseMemObject(d_DstKeyK);
@@ -320,6 +335,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBitonicsortlocal1)
 		clReleaseCommandQueue(queueBitonicsortlocal1);
+	if(transferQueueBitonicsortlocal1)
+		clReleaseCommandQueue(transferQueueBitonicsortlocal1);
 
 	/* Last OpenCL variables */
 	if(context)
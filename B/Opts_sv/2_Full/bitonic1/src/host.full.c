@@ -0,0 +1,459 @@
+/* ********************************************************************************************* */
+/* * Full Bitonic Sort Host                                                                    * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2017 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            FULLPREAMBLE(keys, vals, size, length, seed);
+ *            FULLPOSTAMBLE(keys, dstKeys, dstVals, size);
+ *        where:
+ *            keys: input keys, padded up to length (unsigned int *);
+ *            vals: input values, padded up to length (unsigned int *);
+ *            dstKeys: keys sorted by the device (unsigned int *);
+ *            dstVals: values sorted by the device (unsigned int *);
+ *            size: number of pairs (unsigned int);
+ *            length: padded number of pairs (unsigned int);
+ *            seed: seed of the key generator (unsigned int).
+ */
+#include "prepostambles.h"
+
+/**
+ * @brief Elements sorted in local memory by each work-group (LOCAL_SIZE_LIMIT in kern.full.cl), with half as many work-items.
+ */
+#define LOCAL_SIZE_LIMIT 64
+
+/**
+ * @brief Smallest array length. bitonicSortLocal1 leaves even and odd blocks sorted in opposite directions, so there must be
+ *        at least one merge stage to get a single ascending array.
+ */
+#define MIN_LENGTH (2 * LOCAL_SIZE_LIMIT)
+
+/**
+ * @brief Default sweep, as log2 of the number of pairs.
+ */
+#define SWEEP_LOG_MIN 12
+#define SWEEP_LOG_MAX 26
+
+/**
+ * @brief Standard statements for function error handling and printing.
+ *
+ * @param funcName Function name that failed.
+ */
+#define FUNCTION_ERROR_STATEMENTS(funcName) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s failed with return code %d.\n", funcName, fRet);\
+}
+
+/**
+ * @brief Standard statements for POSIX error handling and printing.
+ *
+ * @param arg Arbitrary string to the printed at the end of error string.
+ */
+#define POSIX_ERROR_STATEMENTS(arg) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s: %s\n", strerror(errno), arg);\
+}
+
+/**
+ * @brief Set a kernel argument, jumping to _err on failure.
+ */
+#define SET_ARG(kernel, index, type, value) {\
+	fRet = clSetKernelArg(kernel, index, sizeof(type), value);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (" #kernel ", " #value ")"));\
+}
+
+/**
+ * @brief Enqueue a kernel over the whole array (one work-item per comparator), jumping to _err on failure.
+ */
+#define ENQUEUE_HALF(kernel) {\
+	size_t _globalSize[1] = {length / 2};\
+	size_t _localSize[1] = {LOCAL_SIZE_LIMIT / 2};\
+	fRet = clEnqueueNDRangeKernel(queue, kernel, 1, NULL, _globalSize, _localSize, 0, NULL, NULL);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel (" #kernel ")"));\
+}
+
+int main(int argc, char *argv[]) {
+	/* Return variable */
+	int rv = EXIT_SUCCESS;
+
+	/* OpenCL and aux variables */
+	int i, opt;
+	cl_uint platformsLen, devicesLen;
+	cl_int fRet;
+	cl_platform_id *platforms = NULL;
+	cl_device_id *devices = NULL;
+	cl_context context = NULL;
+	cl_command_queue queue = NULL;
+	FILE *programFile = NULL;
+	size_t programSz;
+	char *programContent = NULL;
+	cl_program program = NULL;
+	cl_kernel kernelSortLocal = NULL;
+	cl_kernel kernelMergeGlobal = NULL;
+	cl_kernel kernelMergeLocal = NULL;
+	cl_ulong maxAllocSize;
+	struct timeval tThen, tNow, tExecTime;
+#ifdef FULL_PROGRAM_BINARY
+	cl_int programRet;
+#else
+	struct timeval tProgramTime;
+	PROGRAM_CACHE_DECLARE(programCache);
+#endif
+
+	/* Sweep parameters */
+	int logMin = SWEEP_LOG_MIN;
+	int logMax = SWEEP_LOG_MAX;
+	unsigned int single = 0;
+	unsigned int seed = 7;
+	int runs = 1;
+	int l;
+	unsigned int size;
+	unsigned int length;
+	unsigned int maxLength;
+	unsigned int stage;
+	unsigned int stride;
+	unsigned int sortDir = 1;
+
+	/* Host and device variables */
+	unsigned int *keys = NULL;
+	unsigned int *vals = NULL;
+	unsigned int *dstKeys = NULL;
+	unsigned int *dstVals = NULL;
+	cl_mem srcKeyK = NULL;
+	cl_mem srcValK = NULL;
+	cl_mem dstKeyK = NULL;
+	cl_mem dstValK = NULL;
+
+	/* Parse command line */
+	while((opt = getopt(argc, argv, "l:u:n:s:r:")) != -1) {
+		switch(opt) {
+			case 'l':
+				logMin = strtol(optarg, NULL, 10);
+				break;
+			case 'u':
+				logMax = strtol(optarg, NULL, 10);
+				break;
+			case 'n':
+				single = strtoul(optarg, NULL, 10);
+				break;
+			case 's':
+				seed = strtoul(optarg, NULL, 10);
+				break;
+			case 'r':
+				runs = strtol(optarg, NULL, 10);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-l LOGMIN -u LOGMAX | -n PAIRS] [-s SEED] [-r RUNS]\n", argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	/* A single size replaces the sweep */
+	if(single) {
+		for(logMin = 0; (1u << logMin) < single && logMin < 31; logMin++);
+		logMax = logMin;
+	}
+	if(logMin < 0 || logMax > 30 || logMin > logMax || runs <= 0) {
+		fprintf(stderr, "Error: sizes must be between 1 and 2^30 pairs, and number of runs positive.\n");
+		return EXIT_FAILURE;
+	}
+	maxLength = 1u << logMax;
+	if(maxLength < MIN_LENGTH)
+		maxLength = MIN_LENGTH;
+
+	/* Host buffers hold the largest padded array of the sweep */
+	PRINT_STEP("Allocating host buffers...");
+	keys = malloc(maxLength * sizeof(unsigned int));
+	ASSERT_CALL(keys, POSIX_ERROR_STATEMENTS("keys"));
+	vals = malloc(maxLength * sizeof(unsigned int));
+	ASSERT_CALL(vals, POSIX_ERROR_STATEMENTS("vals"));
+	dstKeys = malloc(maxLength * sizeof(unsigned int));
+	ASSERT_CALL(dstKeys, POSIX_ERROR_STATEMENTS("dstKeys"));
+	dstVals = malloc(maxLength * sizeof(unsigned int));
+	ASSERT_CALL(dstVals, POSIX_ERROR_STATEMENTS("dstVals"));
+	PRINT_SUCCESS();
+
+	/* Get platforms IDs */
+	PRINT_STEP("Getting platforms IDs...");
+	fRet = clGetPlatformIDs(0, NULL, &platformsLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	platforms = malloc(platformsLen * sizeof(cl_platform_id));
+	fRet = clGetPlatformIDs(platformsLen, platforms, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	PRINT_SUCCESS();
+
+	/* Get devices IDs for first platform availble */
+	PRINT_STEP("Getting devices IDs for first platform...");
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, NULL, &devicesLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	devices = malloc(devicesLen * sizeof(cl_device_id));
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devicesLen, devices, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	PRINT_SUCCESS();
+
+	/* Device buffers hold the largest padded array of the sweep as well */
+	PRINT_STEP("Checking device memory...");
+	fRet = clGetDeviceInfo(devices[0], CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(cl_ulong), &maxAllocSize, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));
+	ASSERT_CALL(maxLength * sizeof(unsigned int) <= maxAllocSize, PRINT_FAIL(); fprintf(stderr, "Error: %u pairs need buffers of %zu bytes, device allows %llu.\n", maxLength, maxLength * sizeof(unsigned int), (unsigned long long) maxAllocSize); rv = EXIT_FAILURE);
+	PRINT_SUCCESS();
+
+	/* Create context for first available device */
+	PRINT_STEP("Creating context...");
+	context = clCreateContext(NULL, 1, devices, NULL, NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateContext"));
+	PRINT_SUCCESS();
+
+	/* Create command queue for first available device */
+	PRINT_STEP("Creating command queue...");
+	queue = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Open program file */
+	PRINT_STEP("Opening program file...");
+#ifdef FULL_PROGRAM_BINARY
+	programFile = fopen("program.full.aocx", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("program.full.aocx"));
+#else
+	programFile = fopen("kern.full.cl", "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS("kern.full.cl"));
+#endif
+	PRINT_SUCCESS();
+
+	/* Get size and read file */
+	PRINT_STEP("Reading program file...");
+	fseek(programFile, 0, SEEK_END);
+	programSz = ftell(programFile);
+	fseek(programFile, 0, SEEK_SET);
+	programContent = malloc(programSz);
+	fread(programContent, programSz, 1, programFile);
+	fclose(programFile);
+	programFile = NULL;
+	PRINT_SUCCESS();
+
+#ifdef FULL_PROGRAM_BINARY
+	/* Create program from binary file */
+	PRINT_STEP("Creating program from binary...");
+	program = clCreateProgramWithBinary(context, 1, devices, &programSz, (const unsigned char **) &programContent, &programRet, &fRet);
+	ASSERT_CALL(CL_SUCCESS == programRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary (when loading binary)"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary"));
+	PRINT_SUCCESS();
+#else
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
+	PRINT_SUCCESS();
+
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+#endif
+
+	/* Build program */
+	PRINT_STEP("Building program...");
+	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
+	PRINT_SUCCESS();
+
+#ifndef FULL_PROGRAM_BINARY
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+#endif
+
+	/* Create buffers and kernels */
+	PRINT_STEP("Creating buffers and kernels...");
+	srcKeyK = clCreateBuffer(context, CL_MEM_READ_ONLY, maxLength * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (srcKeyK)"));
+	srcValK = clCreateBuffer(context, CL_MEM_READ_ONLY, maxLength * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (srcValK)"));
+	dstKeyK = clCreateBuffer(context, CL_MEM_READ_WRITE, maxLength * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (dstKeyK)"));
+	dstValK = clCreateBuffer(context, CL_MEM_READ_WRITE, maxLength * sizeof(unsigned int), NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer (dstValK)"));
+	kernelSortLocal = clCreateKernel(program, "bitonicSortLocal1", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (bitonicSortLocal1)"));
+	kernelMergeGlobal = clCreateKernel(program, "bitonicMergeGlobal", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (bitonicMergeGlobal)"));
+	kernelMergeLocal = clCreateKernel(program, "bitonicMergeLocal", &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel (bitonicMergeLocal)"));
+	PRINT_SUCCESS();
+
+	/* bitonicSortLocal1 copies the input to the destination buffers, where both merges then work in place */
+	PRINT_STEP("Setting kernel arguments...");
+	SET_ARG(kernelSortLocal, 0, cl_mem, &dstKeyK);
+	SET_ARG(kernelSortLocal, 1, cl_mem, &dstValK);
+	SET_ARG(kernelSortLocal, 2, cl_mem, &srcKeyK);
+	SET_ARG(kernelSortLocal, 3, cl_mem, &srcValK);
+	SET_ARG(kernelMergeGlobal, 0, cl_mem, &dstKeyK);
+	SET_ARG(kernelMergeGlobal, 1, cl_mem, &dstValK);
+	SET_ARG(kernelMergeGlobal, 2, cl_mem, &dstKeyK);
+	SET_ARG(kernelMergeGlobal, 3, cl_mem, &dstValK);
+	SET_ARG(kernelMergeGlobal, 7, unsigned int, &sortDir);
+	SET_ARG(kernelMergeLocal, 0, cl_mem, &dstKeyK);
+	SET_ARG(kernelMergeLocal, 1, cl_mem, &dstValK);
+	SET_ARG(kernelMergeLocal, 2, cl_mem, &dstKeyK);
+	SET_ARG(kernelMergeLocal, 3, cl_mem, &dstValK);
+	SET_ARG(kernelMergeLocal, 7, unsigned int, &sortDir);
+	PRINT_SUCCESS();
+
+	for(l = logMin; l <= logMax; l++) {
+		size = single? single : (1u << l);
+		length = (1u << l) < MIN_LENGTH? MIN_LENGTH : (1u << l);
+
+		/* Calling preamble function */
+		PRINT_STEP("[%u] Calling preamble function...", size);
+		FULLPREAMBLE(keys, vals, size, length, seed);
+		PRINT_SUCCESS();
+
+		/* Padding is written along with the pairs, so that it is sorted to the end */
+		PRINT_STEP("[%u] Writing pairs...", size);
+		fRet = clEnqueueWriteBuffer(queue, srcKeyK, CL_FALSE, 0, length * sizeof(unsigned int), keys, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (srcKeyK)"));
+		fRet = clEnqueueWriteBuffer(queue, srcValK, CL_TRUE, 0, length * sizeof(unsigned int), vals, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (srcValK)"));
+		PRINT_SUCCESS();
+
+		/* Array length is the same for all kernels of this size */
+		SET_ARG(kernelMergeGlobal, 4, unsigned int, &length);
+		SET_ARG(kernelMergeLocal, 4, unsigned int, &length);
+
+		PRINT_STEP("[%u] Sorting...", size);
+		gettimeofday(&tThen, NULL);
+		for(i = 0; i < runs; i++) {
+			ENQUEUE_HALF(kernelSortLocal);
+
+			/* Strides of at least LOCAL_SIZE_LIMIT go through global memory, the remaining ones of a stage are done in local memory at once */
+			for(stage = 2 * LOCAL_SIZE_LIMIT; stage <= length; stage <<= 1) {
+				for(stride = stage / 2; stride > 0; stride >>= 1) {
+					if(stride >= LOCAL_SIZE_LIMIT) {
+						SET_ARG(kernelMergeGlobal, 5, unsigned int, &stage);
+						SET_ARG(kernelMergeGlobal, 6, unsigned int, &stride);
+						ENQUEUE_HALF(kernelMergeGlobal);
+					}
+					else {
+						SET_ARG(kernelMergeLocal, 5, unsigned int, &stride);
+						SET_ARG(kernelMergeLocal, 6, unsigned int, &stage);
+						ENQUEUE_HALF(kernelMergeLocal);
+						break;
+					}
+				}
+			}
+		}
+		clFinish(queue);
+		gettimeofday(&tNow, NULL);
+		timersub(&tNow, &tThen, &tExecTime);
+		PRINT_SUCCESS();
+
+		/* Only the actual pairs are read back */
+		PRINT_STEP("[%u] Reading sorted pairs...", size);
+		fRet = clEnqueueReadBuffer(queue, dstKeyK, CL_FALSE, 0, size * sizeof(unsigned int), dstKeys, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (dstKeyK)"));
+		fRet = clEnqueueReadBuffer(queue, dstValK, CL_TRUE, 0, size * sizeof(unsigned int), dstVals, 0, NULL, NULL);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer (dstValK)"));
+		PRINT_SUCCESS();
+
+		/* Calling postamble function */
+		PRINT_STEP("[%u] Calling postamble function...", size);
+		FULLPOSTAMBLE(keys, dstKeys, dstVals, size);
+		PRINT_SUCCESS();
+
+		/* Print profiling results */
+		long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
+		printf("%u pairs (padded to %u): elapsed time spent on kernels: %ld us; Average time per run: %lf us.\n", size, length, totalTime, totalTime / (double) runs);
+		if(totalTime)
+			printf("%u pairs: throughput: %lf keys/s.\n", size, (size * (double) runs * 1000000) / totalTime);
+	}
+#ifndef FULL_PROGRAM_BINARY
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
+#endif
+
+_err:
+
+	if(queue)
+		clFinish(queue);
+
+	/* Dealloc buffers */
+	if(srcKeyK)
+		clReleaseMemObject(srcKeyK);
+	if(srcValK)
+		clReleaseMemObject(srcValK);
+	if(dstKeyK)
+		clReleaseMemObject(dstKeyK);
+	if(dstValK)
+		clReleaseMemObject(dstValK);
+
+	/* Dealloc kernels */
+	if(kernelSortLocal)
+		clReleaseKernel(kernelSortLocal);
+	if(kernelMergeGlobal)
+		clReleaseKernel(kernelMergeGlobal);
+	if(kernelMergeLocal)
+		clReleaseKernel(kernelMergeLocal);
+
+	/* Dealloc variables */
+	free(keys);
+	free(vals);
+	free(dstKeys);
+	free(dstVals);
+
+	/* Dealloc program */
+	if(program)
+		clReleaseProgram(program);
+	if(programContent)
+		free(programContent);
+	if(programFile)
+		fclose(programFile);
+
+	/* Last OpenCL variables */
+	if(queue)
+		clReleaseCommandQueue(queue);
+	if(context)
+		clReleaseContext(context);
+	if(devices)
+		free(devices);
+	if(platforms)
+		free(platforms);
+
+	return rv;
+}
@@ -0,0 +1,143 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir);
+ *            POSTAMBLE(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir);
+ *            LOOPPREAMBLE(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir, loopFlag);
+ *            LOOPPOSTAMBLE(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir, loopFlag);
+ *            CLEANUP(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir);
+ *        where:
+ *            d_DstKey: variable (unsigned int *);
+ *            d_DstKeySz: number of members in variable (unsigned int);
+ *            d_DstKeyC: variable (unsigned int *);
+ *            d_DstKeyCSz: number of members in variable (unsigned int);
+ *            d_DstVal: variable (unsigned int *);
+ *            d_DstValSz: number of members in variable (unsigned int);
+ *            d_DstValC: variable (unsigned int *);
+ *            d_DstValCSz: number of members in variable (unsigned int);
+ *            d_SrcKey: variable (unsigned int *);
+ *            d_SrcKeySz: number of members in variable (unsigned int);
+ *            d_SrcVal: variable (unsigned int *);
+ *            d_SrcValSz: number of members in variable (unsigned int);
+ *            arrayLength: variable (unsigned int);
+ *            size: variable (unsigned int);
+ *            stride: variable (unsigned int);
+ *            sortDir: variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static unsigned int *d_DstKey = NULL;
+static unsigned int d_DstKeySz = 0;
+static unsigned int *d_DstKeyC = NULL;
+static unsigned int d_DstKeyCSz = 0;
+static unsigned int *d_DstVal = NULL;
+static unsigned int d_DstValSz = 0;
+static unsigned int *d_DstValC = NULL;
+static unsigned int d_DstValCSz = 0;
+static unsigned int *d_SrcKey = NULL;
+static unsigned int d_SrcKeySz = 0;
+static unsigned int *d_SrcVal = NULL;
+static unsigned int d_SrcValSz = 0;
+static unsigned int arrayLength;
+static unsigned int size;
+static unsigned int stride;
+static unsigned int sortDir;
+
+/* Work sizes */
+static size_t *globalSizeBitonicmergeglobal = NULL;
+static size_t *localSizeBitonicmergeglobal = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER_C(d_DstKey),
+	RT_BIND_POINTER_C(d_DstVal),
+	RT_BIND_POINTER(d_SrcKey),
+	RT_BIND_POINTER(d_SrcVal),
+	RT_BIND_VALUE(arrayLength),
+	RT_BIND_VALUE(size),
+	RT_BIND_VALUE(stride),
+	RT_BIND_VALUE(sortDir),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(bitonicMergeGlobal, Bitonicmergeglobal),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(d_DstKey, d_DstKeySz, d_DstKeyC, d_DstKeyCSz, d_DstVal, d_DstValSz, d_DstValC, d_DstValCSz, d_SrcKey, d_SrcKeySz, d_SrcVal, d_SrcValSz, arrayLength, size, stride, sortDir);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -102,6 +102,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBitonicmergeglobal = NULL;
+	cl_command_queue transferQueueBitonicmergeglobal = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -113,6 +114,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimBitonicmergeglobal = 1;
 	size_t globalSizeBitonicmergeglobal[1] = {
 		2048
@@ -168,7 +170,13 @@ int main(void) {
 
 	/* Create command queue for bitonicMergeGlobal kernel */
 	PRINT_STEP("Creating command queue for \"bitonicMergeGlobal\"...");
-	queueBitonicmergeglobal = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBitonicmergeglobal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bitonicMergeGlobal kernel */
+	PRINT_STEP("Creating transfer command queue for \"bitonicMergeGlobal\"...");
+	transferQueueBitonicmergeglobal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -243,13 +251,13 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBitonicmergeglobal, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergeglobal, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergeglobal, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergeglobal, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstValK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergeglobal, d_SrcKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergeglobal, d_SrcKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergeglobal, d_SrcValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergeglobal, d_SrcValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcValK)"));
 		fRet = clSetKernelArg(kernelBitonicmergeglobal, 4, sizeof(unsigned int), &arrayLength);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (arrayLength)"));
@@ -262,8 +270,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBitonicmergeglobal);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBitonicmergeglobal, kernelBitonicmergeglobal, workDimBitonicmergeglobal, NULL, globalSizeBitonicmergeglobal, localSizeBitonicmergeglobal, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBitonicmergeglobal, kernelBitonicmergeglobal, workDimBitonicmergeglobal, NULL, globalSizeBitonicmergeglobal, localSizeBitonicmergeglobal, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bitonicMergeGlobal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBitonicmergeglobal);
 		gettimeofday(&tNow, NULL);
@@ -271,10 +280,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBitonicmergeglobal, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBitonicmergeglobal, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBitonicmergeglobal, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstKey"));
+		fRet = clEnqueueReadBuffer(transferQueueBitonicmergeglobal, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -285,6 +296,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -311,6 +323,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_DstKeyK)
 		clReleaseMemObject(d_DstKeyK);
@@ -344,6 +359,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBitonicmergeglobal)
 		clReleaseCommandQueue(queueBitonicmergeglobal);
+	if(transferQueueBitonicmergeglobal)
+		clReleaseCommandQueue(transferQueueBitonicmergeglobal);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -102,6 +102,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueBitonicmergelocal = NULL;
+	cl_command_queue transferQueueBitonicmergelocal = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -113,6 +114,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimBitonicmergelocal = 1;
 	size_t globalSizeBitonicmergelocal[1] = {
 		2048
@@ -168,7 +170,13 @@ int main(void) {
 
 	/* Create command queue for bitonicMergeLocal kernel */
 	PRINT_STEP("Creating command queue for \"bitonicMergeLocal\"...");
-	queueBitonicmergelocal = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueBitonicmergelocal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for bitonicMergeLocal kernel */
+	PRINT_STEP("Creating transfer command queue for \"bitonicMergeLocal\"...");
+	transferQueueBitonicmergelocal = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -243,13 +251,13 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueBitonicmergelocal, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergelocal, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergelocal, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergelocal, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_DstValK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergelocal, d_SrcKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergelocal, d_SrcKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcKey, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcKey"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcKeyK)"));
-		fRet = clEnqueueWriteBuffer(queueBitonicmergelocal, d_SrcValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueBitonicmergelocal, d_SrcValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_SrcVal, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_SrcVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_SrcValK)"));
 		fRet = clSetKernelArg(kernelBitonicmergelocal, 4, sizeof(unsigned int), &arrayLength);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (arrayLength)"));
@@ -262,8 +270,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueBitonicmergelocal);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueBitonicmergelocal, kernelBitonicmergelocal, workDimBitonicmergelocal, NULL, globalSizeBitonicmergelocal, localSizeBitonicmergelocal, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueBitonicmergelocal, kernelBitonicmergelocal, workDimBitonicmergelocal, NULL, globalSizeBitonicmergelocal, localSizeBitonicmergelocal, ASYNC_WAIT_LIST(profileEvents, 0, 4), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "bitonicMergeLocal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueBitonicmergelocal);
 		gettimeofday(&tNow, NULL);
@@ -271,10 +280,12 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueBitonicmergelocal, d_DstKeyK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstKey, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueBitonicmergelocal, d_DstValK, CL_TRUE, 0, 4096 * sizeof(unsigned int), d_DstVal, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueBitonicmergelocal, d_DstKeyK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstKey, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstKey"));
+		fRet = clEnqueueReadBuffer(transferQueueBitonicmergelocal, d_DstValK, TRANSFER_BLOCKING, 0, 4096 * sizeof(unsigned int), d_DstVal, ASYNC_WAIT_LIST(profileEvents, 4, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_DstVal"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 5, 2);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -285,6 +296,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -311,6 +323,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_DstKeyK)
 		clReleaseMemObject(d_DstKeyK);
@@ -344,6 +359,8 @@ _err:
 	/* Dealloc queues */
 	if(queueBitonicmergelocal)
 		clReleaseCommandQueue(queueBitonicmergelocal);
+	if(transferQueueBitonicmergelocal)
+		clReleaseCommandQueue(transferQueueBitonicmergelocal);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -51,13 +51,7 @@ int iters = 0;
 }
 
 #define LOOPPOSTAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag) {\
-	int _i;\
-	float tmp[262144];\
-\
-	memcpy(tmp, temp_src, 262144 * sizeof(float));\
-	memcpy(temp_src, temp_dst, 262144 * sizeof(float));\
-	memcpy(temp_dst, tmp, 262144 * sizeof(float));\
-\
+	/* Source and destination buffers are swapped on device by the host loop */\
 	iters += PYRAMID_HEIGHT;\
 \
 	loopFlag = (iters < TOTAL_ITERATIONS);\
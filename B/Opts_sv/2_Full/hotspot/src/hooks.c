@@ -0,0 +1,170 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols);
+ *            POSTAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols);
+ *            LOOPPREAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag);
+ *            LOOPPOSTAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag);
+ *            CLEANUP(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols);
+ *        where:
+ *            iteration: variable (int);
+ *            power: variable (float *);
+ *            powerSz: number of members in variable (unsigned int);
+ *            temp_src: variable (float *);
+ *            temp_srcSz: number of members in variable (unsigned int);
+ *            temp_dst: variable (float *);
+ *            temp_dstSz: number of members in variable (unsigned int);
+ *            grid_cols: variable (int);
+ *            grid_rows: variable (int);
+ *            pyramid_height: variable (int);
+ *            step_div_cap: variable (float);
+ *            Rx: variable (float);
+ *            Ry: variable (float);
+ *            Rz: variable (float);
+ *            small_block_rows: variable (int);
+ *            small_block_cols: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int iteration;
+static float *power = NULL;
+static unsigned int powerSz = 0;
+static float *temp_src = NULL;
+static unsigned int temp_srcSz = 0;
+static float *temp_dst = NULL;
+static unsigned int temp_dstSz = 0;
+static int grid_cols;
+static int grid_rows;
+static int pyramid_height;
+static float step_div_cap;
+static float Rx;
+static float Ry;
+static float Rz;
+static int small_block_rows;
+static int small_block_cols;
+
+/* Work sizes */
+static size_t *globalSizeHotspot = NULL;
+static size_t *localSizeHotspot = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(iteration),
+	RT_BIND_POINTER(power),
+	RT_BIND_POINTER(temp_src),
+	RT_BIND_POINTER(temp_dst),
+	RT_BIND_VALUE(grid_cols),
+	RT_BIND_VALUE(grid_rows),
+	RT_BIND_VALUE(pyramid_height),
+	RT_BIND_VALUE(step_div_cap),
+	RT_BIND_VALUE(Rx),
+	RT_BIND_VALUE(Ry),
+	RT_BIND_VALUE(Rz),
+	RT_BIND_VALUE(small_block_rows),
+	RT_BIND_VALUE(small_block_cols),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(hotspot, Hotspot),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(iteration, power, powerSz, temp_src, temp_srcSz, temp_dst, temp_dstSz, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -102,6 +102,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueHotspot = NULL;
+	cl_command_queue transferQueueHotspot = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -111,8 +112,10 @@ int main(void) {
 	bool loopFlag = false;
 	bool invalidDataFound = false;
 	long totalTime;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 6);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimHotspot = 2;
 	size_t globalSizeHotspot[2] = {
 		640, 576
@@ -170,7 +173,13 @@ int main(void) {
 
 	/* Create command queue for hotspot kernel */
 	PRINT_STEP("Creating command queue for \"hotspot\"...");
-	queueHotspot = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueHotspot = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for hotspot kernel */
+	PRINT_STEP("Creating transfer command queue for \"hotspot\"...");
+	transferQueueHotspot = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -191,18 +200,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create hotspot kernel */
 	PRINT_STEP("Creating kernel \"hotspot\" from program...");
 	kernelHotspot = clCreateKernel(program, "hotspot", &fRet);
@@ -249,22 +271,31 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (small_block_cols)"));
 	PRINT_SUCCESS();
 
+	/* Setting input and output buffers (uploaded only once, kernel arguments are swapped on device) */
+	PRINT_STEP("Setting buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, powerK, CL_TRUE, 0, 262144 * sizeof(float), power, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "power"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (powerK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, temp_srcK, CL_TRUE, 0, 262144 * sizeof(float), temp_src, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "temp_src"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (temp_srcK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, temp_dstK, CL_TRUE, 0, 262144 * sizeof(float), temp_dst, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "temp_dst"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (temp_dstK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
 		/* Calling loop preamble function */
 		PRINT_STEP("[%d] Calling loop preamble function...", i);
 		LOOPPREAMBLE(iteration, power, 262144, temp_src, 262144, temp_dst, 262144, grid_cols, grid_rows, pyramid_height, step_div_cap, Rx, Ry, Rz, small_block_rows, small_block_cols, loopFlag);
 		PRINT_SUCCESS();
 
-		/* Setting input and output buffers */
+		/* Setting kernel arguments */
 		PRINT_STEP("[%d] Setting buffers...", i);
 		fRet = clSetKernelArg(kernelHotspot, 0, sizeof(int), &iteration);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (iteration)"));
-		fRet = clEnqueueWriteBuffer(queueHotspot, powerK, CL_TRUE, 0, 262144 * sizeof(float), power, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (powerK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspot, temp_srcK, CL_TRUE, 0, 262144 * sizeof(float), temp_src, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (temp_srcK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspot, temp_dstK, CL_TRUE, 0, 262144 * sizeof(float), temp_dst, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (temp_dstK)"));
+		fRet = clSetKernelArg(kernelHotspot, 2, sizeof(cl_mem), (i % 2)? &temp_dstK : &temp_srcK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (temp_srcK)"));
+		fRet = clSetKernelArg(kernelHotspot, 3, sizeof(cl_mem), (i % 2)? &temp_srcK : &temp_dstK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (temp_dstK)"));
 		fRet = clSetKernelArg(kernelHotspot, 4, sizeof(int), &grid_cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (grid_cols)"));
 		fRet = clSetKernelArg(kernelHotspot, 5, sizeof(int), &grid_rows);
@@ -287,18 +318,12 @@ int main(void) {
 
 		PRINT_STEP("[%d] Running kernels...", i);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueHotspot, kernelHotspot, workDimHotspot, NULL, globalSizeHotspot, localSizeHotspot, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueHotspot, kernelHotspot, workDimHotspot, NULL, globalSizeHotspot, localSizeHotspot, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "hotspot"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueHotspot);
 		gettimeofday(&tNow, NULL);
 		PRINT_SUCCESS();
-
-		/* Get output buffers */
-		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueHotspot, temp_srcK, CL_TRUE, 0, 262144 * sizeof(float), temp_src, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueHotspot, temp_dstK, CL_TRUE, 0, 262144 * sizeof(float), temp_dst, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
-		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -309,10 +334,20 @@ int main(void) {
 		i++;
 	} while(loopFlag);
 
+	/* Get output buffers */
+	PRINT_STEP("Getting kernels arguments...");
+	fRet = clEnqueueReadBuffer(transferQueueHotspot, (i % 2)? temp_dstK : temp_srcK, CL_TRUE, 0, 262144 * sizeof(float), temp_src, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "temp_src"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	fRet = clEnqueueReadBuffer(transferQueueHotspot, (i % 2)? temp_srcK : temp_dstK, CL_TRUE, 0, 262144 * sizeof(float), temp_dst, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "temp_dst"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
 
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -321,6 +356,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(powerK)
 		clReleaseMemObject(powerK);
@@ -349,6 +387,8 @@ _err:
 	/* Dealloc queues */
 	if(queueHotspot)
 		clReleaseCommandQueue(queueHotspot);
+	if(transferQueueHotspot)
+		clReleaseCommandQueue(transferQueueHotspot);
 
 	/* Last OpenCL variables */
 	if(context)
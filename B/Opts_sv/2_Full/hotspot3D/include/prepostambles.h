@@ -1,7 +1,5 @@
 #define MAX_ITERS 3
 
-float *gTemp = NULL;
-
 #define PREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc) {\
 	int _i, _j;\
 	unsigned int _vars = 3;\
@@ -50,8 +48,6 @@ float *gTemp = NULL;
 \
 	/* We are using another logic to break loop */\
 	loopFlag = true;\
-\
-	gTemp = malloc(tOutSz * sizeof(float));\
 }
 
 #define LOOPPREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag) {\
@@ -62,12 +58,8 @@ float *gTemp = NULL;
 }
 
 #define LOOPPOSTAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag) {\
-	memcpy(gTemp, tIn, tInSz * sizeof(float));\
-	memcpy(tIn, tOut, tInSz * sizeof(float));\
-	memcpy(tOut, gTemp, tInSz * sizeof(float));\
+	/* tIn and tOut buffers are swapped on device by the host loop */\
 }
 
 #define CLEANUP(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc) {\
-	if(gTemp)\
-		free(gTemp);\
 }
@@ -105,6 +105,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueHotspotopt1 = NULL;
+	cl_command_queue transferQueueHotspotopt1 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -116,6 +117,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 7);
 	cl_uint workDimHotspotopt1 = 2;
 	size_t globalSizeHotspotopt1[2] = {
 		512, 512
@@ -176,7 +178,13 @@ int main(void) {
 
 	/* Create command queue for hotspotOpt1 kernel */
 	PRINT_STEP("Creating command queue for \"hotspotOpt1\"...");
-	queueHotspotopt1 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueHotspotopt1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for hotspotOpt1 kernel */
+	PRINT_STEP("Creating transfer command queue for \"hotspotOpt1\"...");
+	transferQueueHotspotopt1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -258,20 +266,29 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cc)"));
 	PRINT_SUCCESS();
 
+	/* Setting input and output buffers (uploaded only once, kernel arguments are swapped on device) */
+	PRINT_STEP("Setting buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueHotspotopt1, pK, CL_TRUE, 0, 2097152 * sizeof(float), p, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "p"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (pK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspotopt1, tInK, CL_TRUE, 0, 2097152 * sizeof(float), tIn, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "tIn"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (tInK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspotopt1, tOutK, CL_TRUE, 0, 2097152 * sizeof(float), tOut, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "tOut"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (tOutK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
 		/* Calling loop preamble function */
 		PRINT_STEP("[%d] Calling loop preamble function...", i);
 		LOOPPREAMBLE(p, 2097152, tIn, 2097152, tOut, 2097152, tOutC, 2097152, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, loopFlag);
 		PRINT_SUCCESS();
 
-		/* Setting input and output buffers */
+		/* Setting kernel arguments */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueHotspotopt1, pK, CL_TRUE, 0, 2097152 * sizeof(float), p, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (pK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspotopt1, tInK, CL_TRUE, 0, 2097152 * sizeof(float), tIn, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (tInK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspotopt1, tOutK, CL_TRUE, 0, 2097152 * sizeof(float), tOut, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (tOutK)"));
+		fRet = clSetKernelArg(kernelHotspotopt1, 1, sizeof(cl_mem), (i % 2)? &tOutK : &tInK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (tInK)"));
+		fRet = clSetKernelArg(kernelHotspotopt1, 2, sizeof(cl_mem), (i % 2)? &tInK : &tOutK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (tOutK)"));
 		fRet = clSetKernelArg(kernelHotspotopt1, 3, sizeof(float), &sdc);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (sdc)"));
 		fRet = clSetKernelArg(kernelHotspotopt1, 4, sizeof(int), &nx);
@@ -298,19 +315,12 @@ int main(void) {
 
 		PRINT_STEP("[%d] Running kernels...", i);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueHotspotopt1, kernelHotspotopt1, workDimHotspotopt1, NULL, globalSizeHotspotopt1, localSizeHotspotopt1, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueHotspotopt1, kernelHotspotopt1, workDimHotspotopt1, NULL, globalSizeHotspotopt1, localSizeHotspotopt1, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "hotspotOpt1"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueHotspotopt1);
 		gettimeofday(&tNow, NULL);
 		PRINT_SUCCESS();
-
-		/* Get output buffers */
-		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueHotspotopt1, pK, CL_TRUE, 0, 2097152 * sizeof(float), p, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueHotspotopt1, tInK, CL_TRUE, 0, 2097152 * sizeof(float), tIn, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueHotspotopt1, tOutK, CL_TRUE, 0, 2097152 * sizeof(float), tOut, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
-		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -321,10 +331,19 @@ int main(void) {
 		i++;
 	} while(loopFlag);
 
+	/* Get output buffers */
+	PRINT_STEP("Getting kernels arguments...");
+	fRet = clEnqueueReadBuffer(transferQueueHotspotopt1, (i % 2)? tOutK : tInK, CL_TRUE, 0, 2097152 * sizeof(float), tIn, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "tIn"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	fRet = clEnqueueReadBuffer(transferQueueHotspotopt1, (i % 2)? tInK : tOutK, CL_TRUE, 0, 2097152 * sizeof(float), tOut, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "tOut"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
 
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -342,6 +361,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(pK)
 		clReleaseMemObject(pK);
@@ -371,6 +393,8 @@ _err:
 	/* Dealloc queues */
 	if(queueHotspotopt1)
 		clReleaseCommandQueue(queueHotspotopt1);
+	if(transferQueueHotspotopt1)
+		clReleaseCommandQueue(transferQueueHotspotopt1);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -104,4 +104,321 @@
 	printf("\r[" ANSI_COLOUR_RED "FAIL" ANSI_COLOUR_RESET "\n");\
 }
 
-#endif
\ No newline at end of file
+/**
+ * @brief Command categories accounted by the event macros.
+ */
+#define PROFILE_WRITE 0
+#define PROFILE_KERNEL 1
+#define PROFILE_READ 2
+
+/**
+ * @brief If event profiling or asynchronous transfers are activated, events are created for every command in an iteration.
+ *        Event profiling prints their timestamps, asynchronous transfers use them as wait lists.
+ * @note These macros expand to OpenCL calls and must be used after including the OpenCL header.
+ */
+#if defined(COMMON_EVENT_PROFILING) || defined(COMMON_ASYNC_TRANSFERS)
+
+/**
+ * @brief Release all events in the list.
+ * @param list List name.
+ * @note Also used for releasing events that were not reported (e.g. when an error occurred in the middle of an iteration).
+ */
+#define PROFILE_RELEASE(list) {\
+	int _p;\
+\
+	for(_p = 0; _p < list##Len; _p++) {\
+		if(list[_p])\
+			clReleaseEvent(list[_p]);\
+		list[_p] = NULL;\
+	}\
+	list##Len = 0;\
+}
+
+#endif
+
+/**
+ * @brief If event profiling is activated, these macros will print the collected event timestamps.
+ */
+#ifdef COMMON_EVENT_PROFILING
+
+/**
+ * @brief Properties to be used when creating command queues.
+ */
+#define PROFILE_QUEUE_PROPERTIES CL_QUEUE_PROFILING_ENABLE
+
+/**
+ * @brief Declare a list for holding the events of one iteration.
+ * @param list List name.
+ * @param size Maximum number of commands per iteration.
+ */
+#define PROFILE_DECLARE(list, size)\
+	cl_event list[size] = {NULL};\
+	const char *list##Names[size] = {NULL};\
+	int list##Types[size] = {0};\
+	int list##Len = 0;\
+	cl_ulong list##Totals[3] = {0, 0, 0}
+
+/**
+ * @brief Register a new command in the list and return the event pointer to be passed to clEnqueue* functions.
+ * @param list List name.
+ * @param type Command category (PROFILE_WRITE, PROFILE_KERNEL or PROFILE_READ).
+ * @param name Name of the command, used when printing.
+ */
+#define PROFILE_EVENT(list, type, name) (\
+	list##Types[list##Len] = (type),\
+	list##Names[list##Len] = (name),\
+	&list[list##Len++]\
+)
+
+/**
+ * @brief Print queued/submit/start/end timestamps for all commands in the list, relative to the first queued command.
+ *        Accumulate command durations per category and release all events.
+ * @param list List name.
+ * @param iter Current iteration.
+ * @note This macro uses fRet and FUNCTION_ERROR_STATEMENTS from the host code and jumps to _err on failure.
+ */
+#define PROFILE_REPORT(list, iter) {\
+	int _p, _q;\
+	cl_ulong _pTimes[4], _pBase = 0;\
+	const char *_pTypeNames[3] = {"write", "kernel", "read"};\
+	const cl_profiling_info _pInfos[4] = {\
+		CL_PROFILING_COMMAND_QUEUED, CL_PROFILING_COMMAND_SUBMIT, CL_PROFILING_COMMAND_START, CL_PROFILING_COMMAND_END\
+	};\
+\
+	if(list##Len) {\
+		fRet = clWaitForEvents(list##Len, list);\
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clWaitForEvents"));\
+	}\
+\
+	printf("[%d] Event profiling (us, relative to first queued command):\n", iter);\
+	for(_p = 0; _p < list##Len; _p++) {\
+		for(_q = 0; _q < 4; _q++) {\
+			fRet = clGetEventProfilingInfo(list[_p], _pInfos[_q], sizeof(cl_ulong), &_pTimes[_q], NULL);\
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetEventProfilingInfo"));\
+		}\
+		if(!_p)\
+			_pBase = _pTimes[0];\
+\
+		printf("\t%s %s: queued %.3lf; submit %.3lf; start %.3lf; end %.3lf; duration %.3lf\n",\
+			_pTypeNames[list##Types[_p]], list##Names[_p], (_pTimes[0] - _pBase) / 1000.0, (_pTimes[1] - _pBase) / 1000.0,\
+			(_pTimes[2] - _pBase) / 1000.0, (_pTimes[3] - _pBase) / 1000.0, (_pTimes[3] - _pTimes[2]) / 1000.0);\
+		list##Totals[list##Types[_p]] += _pTimes[3] - _pTimes[2];\
+	}\
+\
+	PROFILE_RELEASE(list);\
+}
+
+/**
+ * @brief Print accumulated device time per command category.
+ * @param list List name.
+ * @param iters Number of iterations executed.
+ */
+#define PROFILE_SUMMARY(list, iters) {\
+	printf("Device time spent on writes: %.3lf us; on kernels: %.3lf us; on reads: %.3lf us; Average device time per iteration: %.3lf us.\n",\
+		list##Totals[PROFILE_WRITE] / 1000.0, list##Totals[PROFILE_KERNEL] / 1000.0, list##Totals[PROFILE_READ] / 1000.0,\
+		(list##Totals[PROFILE_WRITE] + list##Totals[PROFILE_KERNEL] + list##Totals[PROFILE_READ]) / (1000.0 * (iters)));\
+}
+
+#elif defined(COMMON_ASYNC_TRANSFERS)
+
+/**
+ * @brief Without event profiling, lists only hold the events used as wait lists.
+ */
+#define PROFILE_DECLARE(list, size)\
+	cl_event list[size] = {NULL};\
+	int list##Len = 0
+#define PROFILE_EVENT(list, type, name) (&list[list##Len++])
+
+#define PROFILE_QUEUE_PROPERTIES 0
+#define PROFILE_REPORT(list, iter) PROFILE_RELEASE(list)
+#define PROFILE_SUMMARY(list, iters)
+
+#else
+
+#define PROFILE_QUEUE_PROPERTIES 0
+#define PROFILE_DECLARE(list, size)
+#define PROFILE_EVENT(list, type, name) NULL
+#define PROFILE_REPORT(list, iter)
+#define PROFILE_SUMMARY(list, iters)
+#define PROFILE_RELEASE(list)
+
+#endif
+
+/**
+ * @brief If asynchronous transfers are activated, buffer writes and reads are non-blocking and chained to the kernel through
+ *        event wait lists. Writes and reads are issued on a transfer queue, kernels on a compute queue.
+ */
+#ifdef COMMON_ASYNC_TRANSFERS
+
+/**
+ * @brief Blocking flag for buffer writes and reads.
+ */
+#define TRANSFER_BLOCKING CL_FALSE
+
+/**
+ * @brief Expand to the wait list arguments of a clEnqueue* function.
+ * @param list Event list name (see PROFILE_DECLARE).
+ * @param first Index of first event to wait for.
+ * @param n Number of events to wait for.
+ */
+#define ASYNC_WAIT_LIST(list, first, n) (n), &list[first]
+
+/**
+ * @brief Wait for events in the list.
+ * @param list Event list name (see PROFILE_DECLARE).
+ * @param first Index of first event to wait for.
+ * @param n Number of events to wait for.
+ * @note This macro uses fRet and FUNCTION_ERROR_STATEMENTS from the host code and jumps to _err on failure.
+ */
+#define ASYNC_WAIT(list, first, n) {\
+	fRet = clWaitForEvents((n), &list[first]);\
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clWaitForEvents"));\
+}
+
+#else
+
+#define TRANSFER_BLOCKING CL_TRUE
+#define ASYNC_WAIT_LIST(list, first, n) 0, NULL
+#define ASYNC_WAIT(list, first, n)
+
+#endif
+
+/**
+ * @brief If binary cache is activated, built programs are stored on disk and reused on later executions.
+ *        The cache key is a hash of the program source, build options and device name/version/driver version.
+ * @note These macros expand to OpenCL calls and must be used after including the OpenCL header.
+ */
+#ifdef COMMON_BINARY_CACHE
+
+#include <sys/stat.h>
+
+/**
+ * @brief Folder where program binaries are cached, relative to the working directory.
+ */
+#define PROGRAM_CACHE_DIR "clcache"
+
+/**
+ * @brief Accumulate a buffer into a FNV-1a hash. A zero byte is also accumulated to separate consecutive buffers.
+ * @param hash Hash variable (unsigned long long).
+ * @param buf Buffer to be accumulated.
+ * @param len Buffer length.
+ */
+#define PROGRAM_CACHE_HASH(hash, buf, len) {\
+	size_t _h;\
+\
+	for(_h = 0; _h < (size_t) (len); _h++)\
+		hash = (hash ^ ((const unsigned char *) (buf))[_h]) * 1099511628211ULL;\
+	hash *= 1099511628211ULL;\
+}
+
+/**
+ * @brief Declare the variables used by the cache.
+ * @param cache Cache name.
+ */
+#define PROGRAM_CACHE_DECLARE(cache)\
+	char cache##Path[64] = "";\
+	bool cache##Hit = false
+
+/**
+ * @brief Try to create a program from a cached binary. If found, cache##Hit is set to true.
+ * @param cache Cache name.
+ * @param program Program variable to be created.
+ * @param context OpenCL context.
+ * @param device OpenCL device.
+ * @param source Program source.
+ * @param sourceSz Program source size.
+ * @param options Build options (may be NULL).
+ * @note This macro uses fRet and FUNCTION_ERROR_STATEMENTS from the host code and jumps to _err on failure.
+ *       A missing or invalid cached binary is not a failure, the program is left as NULL.
+ */
+#define PROGRAM_CACHE_LOAD(cache, program, context, device, source, sourceSz, options) {\
+	unsigned long long _cHash = 14695981039346656037ULL;\
+	const char *_cOptions = (options);\
+	const cl_device_info _cInfos[3] = {CL_DEVICE_NAME, CL_DEVICE_VERSION, CL_DRIVER_VERSION};\
+	char _cInfo[1024];\
+	size_t _cBinSz;\
+	unsigned char *_cBin = NULL;\
+	cl_int _cStatus;\
+	FILE *_cFile;\
+	int _c;\
+\
+	/* No options hash as empty ones */\
+	if(!_cOptions)\
+		_cOptions = "";\
+	PROGRAM_CACHE_HASH(_cHash, source, sourceSz);\
+	PROGRAM_CACHE_HASH(_cHash, _cOptions, strlen(_cOptions));\
+	for(_c = 0; _c < 3; _c++) {\
+		fRet = clGetDeviceInfo(device, _cInfos[_c], sizeof(_cInfo), _cInfo, NULL);\
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));\
+		PROGRAM_CACHE_HASH(_cHash, _cInfo, strlen(_cInfo));\
+	}\
+	snprintf(cache##Path, sizeof(cache##Path), PROGRAM_CACHE_DIR "/%016llx.bin", _cHash);\
+\
+	_cFile = fopen(cache##Path, "rb");\
+	if(_cFile) {\
+		fseek(_cFile, 0, SEEK_END);\
+		_cBinSz = ftell(_cFile);\
+		fseek(_cFile, 0, SEEK_SET);\
+		_cBin = malloc(_cBinSz);\
+\
+		if(_cBin && _cBinSz && (1 == fread(_cBin, _cBinSz, 1, _cFile))) {\
+			program = clCreateProgramWithBinary(context, 1, &(device), &_cBinSz, (const unsigned char **) &_cBin, &_cStatus, &fRet);\
+			if(CL_SUCCESS == fRet && CL_SUCCESS == _cStatus) {\
+				cache##Hit = true;\
+			}\
+			else if(program) {\
+				clReleaseProgram(program);\
+				program = NULL;\
+			}\
+		}\
+\
+		if(_cBin)\
+			free(_cBin);\
+		fclose(_cFile);\
+	}\
+}
+
+/**
+ * @brief Store the binary of a built program in the cache, if it was not loaded from there.
+ * @param cache Cache name.
+ * @param program Built program.
+ * @note Failing to store the binary is not an error, the cache is simply not updated.
+ *       Binary is first written to a temporary file and then renamed, so that concurrent executions never read partial files.
+ */
+#define PROGRAM_CACHE_STORE(cache, program) {\
+	size_t _cBinSz = 0;\
+	unsigned char *_cBin = NULL;\
+	char _cTmpPath[sizeof(cache##Path) + 4];\
+	FILE *_cFile;\
+	bool _cWritten = false;\
+\
+	if(!cache##Hit && (CL_SUCCESS == clGetProgramInfo(program, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &_cBinSz, NULL)) && _cBinSz)\
+		_cBin = malloc(_cBinSz);\
+\
+	if(_cBin && (CL_SUCCESS == clGetProgramInfo(program, CL_PROGRAM_BINARIES, sizeof(unsigned char *), &_cBin, NULL))) {\
+		mkdir(PROGRAM_CACHE_DIR, 0755);\
+		snprintf(_cTmpPath, sizeof(_cTmpPath), "%s.tmp", cache##Path);\
+\
+		_cFile = fopen(_cTmpPath, "wb");\
+		if(_cFile) {\
+			_cWritten = (1 == fwrite(_cBin, _cBinSz, 1, _cFile));\
+			_cWritten = !fclose(_cFile) && _cWritten;\
+\
+			if(!_cWritten || rename(_cTmpPath, cache##Path))\
+				remove(_cTmpPath);\
+		}\
+	}\
+\
+	if(_cBin)\
+		free(_cBin);\
+}
+
+#else
+
+#define PROGRAM_CACHE_DECLARE(cache) bool cache##Hit = false
+#define PROGRAM_CACHE_LOAD(cache, program, context, device, source, sourceSz, options)
+#define PROGRAM_CACHE_STORE(cache, program)
+
+#endif
+
+#endif
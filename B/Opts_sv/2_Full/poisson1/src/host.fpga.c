@@ -94,6 +94,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueVectoradd = NULL;
+	cl_command_queue transferQueueVectoradd = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -105,6 +106,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimVectoradd = 1;
 	size_t globalSizeVectoradd[1] = {
 		65536
@@ -151,7 +153,13 @@ int main(void) {
 
 	/* Create command queue for vectorAdd kernel */
 	PRINT_STEP("Creating command queue for \"vectorAdd\"...");
-	queueVectoradd = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueVectoradd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for vectorAdd kernel */
+	PRINT_STEP("Creating transfer command queue for \"vectorAdd\"...");
+	transferQueueVectoradd = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -214,17 +222,18 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueVectoradd, xK, CL_TRUE, 0, 65536 * sizeof(cl_float16), x, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueVectoradd, xK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), x, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "x"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (xK)"));
-		fRet = clEnqueueWriteBuffer(queueVectoradd, yK, CL_TRUE, 0, 65536 * sizeof(cl_float16), y, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueVectoradd, yK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), y, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "y"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (yK)"));
-		fRet = clEnqueueWriteBuffer(queueVectoradd, zK, CL_TRUE, 0, 65536 * sizeof(cl_float16), z, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueVectoradd, zK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), z, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "z"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (zK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueVectoradd);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueVectoradd, kernelVectoradd, workDimVectoradd, NULL, globalSizeVectoradd, NULL, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueVectoradd, kernelVectoradd, workDimVectoradd, NULL, globalSizeVectoradd, NULL, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "vectorAdd"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueVectoradd);
 		gettimeofday(&tNow, NULL);
@@ -232,9 +241,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueVectoradd, zK, CL_TRUE, 0, 65536 * sizeof(cl_float16), z, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueVectoradd, zK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), z, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "z"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -245,6 +256,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -264,6 +276,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(xK)
 		clReleaseMemObject(xK);
@@ -293,6 +308,8 @@ _err:
 	/* Dealloc queues */
 	if(queueVectoradd)
 		clReleaseCommandQueue(queueVectoradd);
+	if(transferQueueVectoradd)
+		clReleaseCommandQueue(transferQueueVectoradd);
 
 	/* Last OpenCL variables */
 	if(context)
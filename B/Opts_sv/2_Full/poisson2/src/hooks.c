@@ -0,0 +1,125 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size);
+ *            POSTAMBLE(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size);
+ *            LOOPPREAMBLE(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size, loopFlag);
+ *            LOOPPOSTAMBLE(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size, loopFlag);
+ *            CLEANUP(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size);
+ *        where:
+ *            A: variable (cl_float16 *);
+ *            ASz: number of members in variable (unsigned int);
+ *            B: variable (cl_float16 *);
+ *            BSz: number of members in variable (unsigned int);
+ *            result: variable (float *);
+ *            resultSz: number of members in variable (unsigned int);
+ *            resultC: variable (float *);
+ *            resultCSz: number of members in variable (unsigned int);
+ *            size: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static cl_float16 *A = NULL;
+static unsigned int ASz = 0;
+static cl_float16 *B = NULL;
+static unsigned int BSz = 0;
+static float *result = NULL;
+static unsigned int resultSz = 0;
+static float *resultC = NULL;
+static unsigned int resultCSz = 0;
+static int size;
+
+/* Work sizes */
+static size_t *globalSizeCdot_Advanced = NULL;
+static size_t *localSizeCdot_Advanced = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(A),
+	RT_BIND_POINTER(B),
+	RT_BIND_POINTER_C(result),
+	RT_BIND_VALUE(size),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(cdot_advanced, Cdot_Advanced),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(A, ASz, B, BSz, result, resultSz, resultC, resultCSz, size);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -95,6 +95,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueCdot_Advanced = NULL;
+	cl_command_queue transferQueueCdot_Advanced = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -104,8 +105,10 @@ int main(void) {
 	bool loopFlag = false;
 	bool invalidDataFound = false;
 	long totalTime;
-	struct timeval tThen, tNow, tDelta, tExecTime;
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
+	PROGRAM_CACHE_DECLARE(programCache);
 	cl_uint workDimCdot_Advanced = 1;
 	size_t globalSizeCdot_Advanced[1] = {
 		65536
@@ -156,7 +159,13 @@ int main(void) {
 
 	/* Create command queue for cdot_advanced kernel */
 	PRINT_STEP("Creating command queue for \"cdot_advanced\"...");
-	queueCdot_Advanced = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueCdot_Advanced = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for cdot_advanced kernel */
+	PRINT_STEP("Creating transfer command queue for \"cdot_advanced\"...");
+	transferQueueCdot_Advanced = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -177,18 +186,31 @@ int main(void) {
 	programFile = NULL;
 	PRINT_SUCCESS();
 
-	/* Create program from source file */
-	PRINT_STEP("Creating program from source...");
-	program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
-	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+	/* Create program from cached binary, if available */
+	gettimeofday(&tThen, NULL);
+	PRINT_STEP("Looking for cached program binary...");
+	PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, NULL);
 	PRINT_SUCCESS();
 
+	/* Create program from source file */
+	if(!programCacheHit) {
+		PRINT_STEP("Creating program from source...");
+		program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+		PRINT_SUCCESS();
+	}
+
 	/* Build program */
 	PRINT_STEP("Building program...");
 	fRet = clBuildProgram(program, 1, devices, NULL, NULL, NULL);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
 	PRINT_SUCCESS();
 
+	/* Store program binary in cache */
+	PROGRAM_CACHE_STORE(programCache, program);
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
 	/* Create cdot_advanced kernel */
 	PRINT_STEP("Creating kernel \"cdot_advanced\" from program...");
 	kernelCdot_Advanced = clCreateKernel(program, "cdot_advanced", &fRet);
@@ -220,19 +242,20 @@ int main(void) {
 	do {
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueCdot_Advanced, AK, CL_TRUE, 0, 65536 * sizeof(cl_float16), A, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCdot_Advanced, AK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), A, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "A"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (AK)"));
-		fRet = clEnqueueWriteBuffer(queueCdot_Advanced, BK, CL_TRUE, 0, 65536 * sizeof(cl_float16), B, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCdot_Advanced, BK, TRANSFER_BLOCKING, 0, 65536 * sizeof(cl_float16), B, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "B"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (BK)"));
-		fRet = clEnqueueWriteBuffer(queueCdot_Advanced, resultK, CL_TRUE, 0, 1024 * sizeof(float), result, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueCdot_Advanced, resultK, TRANSFER_BLOCKING, 0, 1024 * sizeof(float), result, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (resultK)"));
 		fRet = clSetKernelArg(kernelCdot_Advanced, 3, sizeof(int), &size);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (size)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueCdot_Advanced);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueCdot_Advanced, kernelCdot_Advanced, workDimCdot_Advanced, NULL, globalSizeCdot_Advanced, localSizeCdot_Advanced, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueCdot_Advanced, kernelCdot_Advanced, workDimCdot_Advanced, NULL, globalSizeCdot_Advanced, localSizeCdot_Advanced, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "cdot_advanced"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueCdot_Advanced);
 		gettimeofday(&tNow, NULL);
@@ -240,9 +263,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueCdot_Advanced, resultK, CL_TRUE, 0, 1024 * sizeof(float), result, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueCdot_Advanced, resultK, TRANSFER_BLOCKING, 0, 1024 * sizeof(float), result, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "result"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		timersub(&tNow, &tThen, &tDelta);
 		timeradd(&tExecTime, &tDelta, &tExecTime);
@@ -253,6 +278,8 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -270,6 +297,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(AK)
 		clReleaseMemObject(AK);
@@ -299,6 +329,8 @@ _err:
 	/* Dealloc queues */
 	if(queueCdot_Advanced)
 		clReleaseCommandQueue(queueCdot_Advanced);
+	if(transferQueueCdot_Advanced)
+		clReleaseCommandQueue(transferQueueCdot_Advanced);
 
 	/* Last OpenCL variables */
 	if(context)
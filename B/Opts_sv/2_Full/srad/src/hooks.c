@@ -0,0 +1,191 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz);
+ *            POSTAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz);
+ *            LOOPPREAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz, loopFlag);
+ *            LOOPPOSTAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz, loopFlag);
+ *            CLEANUP(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz);
+ *        where:
+ *            d_Nr: variable (int);
+ *            d_Ne: variable (long);
+ *            d_iN: variable (int *);
+ *            d_iNSz: number of members in variable (unsigned int);
+ *            d_iS: variable (int *);
+ *            d_iSSz: number of members in variable (unsigned int);
+ *            d_jE: variable (int *);
+ *            d_jESz: number of members in variable (unsigned int);
+ *            d_jW: variable (int *);
+ *            d_jWSz: number of members in variable (unsigned int);
+ *            d_dN: variable (float *);
+ *            d_dNSz: number of members in variable (unsigned int);
+ *            d_dS: variable (float *);
+ *            d_dSSz: number of members in variable (unsigned int);
+ *            d_dE: variable (float *);
+ *            d_dESz: number of members in variable (unsigned int);
+ *            d_dW: variable (float *);
+ *            d_dWSz: number of members in variable (unsigned int);
+ *            d_q0sqr: variable (float);
+ *            d_c: variable (float *);
+ *            d_cSz: number of members in variable (unsigned int);
+ *            d_I: variable (float *);
+ *            d_ISz: number of members in variable (unsigned int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int d_Nr;
+static long d_Ne;
+static int *d_iN = NULL;
+static unsigned int d_iNSz = 0;
+static int *d_iS = NULL;
+static unsigned int d_iSSz = 0;
+static int *d_jE = NULL;
+static unsigned int d_jESz = 0;
+static int *d_jW = NULL;
+static unsigned int d_jWSz = 0;
+static float *d_dN = NULL;
+static unsigned int d_dNSz = 0;
+static float *d_dS = NULL;
+static unsigned int d_dSSz = 0;
+static float *d_dE = NULL;
+static unsigned int d_dESz = 0;
+static float *d_dW = NULL;
+static unsigned int d_dWSz = 0;
+static float d_q0sqr;
+static float *d_c = NULL;
+static unsigned int d_cSz = 0;
+static float *d_I = NULL;
+static unsigned int d_ISz = 0;
+
+/* Work sizes */
+static size_t *globalSizeSrad_Kernel = NULL;
+static size_t *localSizeSrad_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_VALUE(d_Nr),
+	RT_BIND_VALUE(d_Ne),
+	RT_BIND_POINTER(d_iN),
+	RT_BIND_POINTER(d_iS),
+	RT_BIND_POINTER(d_jE),
+	RT_BIND_POINTER(d_jW),
+	RT_BIND_POINTER(d_dN),
+	RT_BIND_POINTER(d_dS),
+	RT_BIND_POINTER(d_dE),
+	RT_BIND_POINTER(d_dW),
+	RT_BIND_VALUE(d_q0sqr),
+	RT_BIND_POINTER(d_c),
+	RT_BIND_POINTER(d_I),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(srad_kernel, Srad_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(d_Nr, d_Ne, d_iN, d_iNSz, d_iS, d_iSSz, d_jE, d_jESz, d_jW, d_jWSz, d_dN, d_dNSz, d_dS, d_dSSz, d_dE, d_dESz, d_dW, d_dWSz, d_q0sqr, d_c, d_cSz, d_I, d_ISz);
+	PRINT_SUCCESS();
+
+	return rv;
+}
+
+void hooks_cleanup(void) {
+}
@@ -109,6 +109,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueSrad_Kernel = NULL;
+	cl_command_queue transferQueueSrad_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -120,6 +121,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 16);
 	cl_uint workDimSrad_Kernel = 1;
 	size_t globalSizeSrad_Kernel[1] = {
 		230144
@@ -184,7 +186,13 @@ int main(void) {
 
 	/* Create command queue for srad_kernel kernel */
 	PRINT_STEP("Creating command queue for \"srad_kernel\"...");
-	queueSrad_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueSrad_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for srad_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"srad_kernel\"...");
+	transferQueueSrad_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -278,6 +286,19 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_IK)"));
 	PRINT_SUCCESS();
 
+	/* Setting loop-invariant input buffers (uploaded only once) */
+	PRINT_STEP("Setting loop-invariant buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueSrad_Kernel, d_iNK, CL_TRUE, 0, 502 * sizeof(int), d_iN, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_iN"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_iNK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueSrad_Kernel, d_iSK, CL_TRUE, 0, 502 * sizeof(int), d_iS, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_iS"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_iSK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueSrad_Kernel, d_jEK, CL_TRUE, 0, 458 * sizeof(int), d_jE, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_jE"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_jEK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueSrad_Kernel, d_jWK, CL_TRUE, 0, 458 * sizeof(int), d_jW, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_jW"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_jWK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
 		/* Calling loop preamble function */
 		PRINT_STEP("[%d] Calling loop preamble function...", i);
@@ -290,33 +311,16 @@ int main(void) {
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_Nr)"));
 		fRet = clSetKernelArg(kernelSrad_Kernel, 1, sizeof(long), &d_Ne);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_Ne)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_iNK, CL_TRUE, 0, 502 * sizeof(int), d_iN, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_iNK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_iSK, CL_TRUE, 0, 502 * sizeof(int), d_iS, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_iSK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_jEK, CL_TRUE, 0, 458 * sizeof(int), d_jE, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_jEK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_jWK, CL_TRUE, 0, 458 * sizeof(int), d_jW, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_jWK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_dNK, CL_TRUE, 0, 229916 * sizeof(float), d_dN, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_dNK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_dSK, CL_TRUE, 0, 229916 * sizeof(float), d_dS, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_dSK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_dEK, CL_TRUE, 0, 229916 * sizeof(float), d_dE, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_dEK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_dWK, CL_TRUE, 0, 229916 * sizeof(float), d_dW, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_dWK)"));
 		fRet = clSetKernelArg(kernelSrad_Kernel, 10, sizeof(float), &d_q0sqr);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (d_q0sqr)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_cK, CL_TRUE, 0, 229916 * sizeof(float), d_c, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_cK)"));
-		fRet = clEnqueueWriteBuffer(queueSrad_Kernel, d_IK, CL_TRUE, 0, 229916 * sizeof(float), d_I, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueSrad_Kernel, d_IK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_I, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "d_I"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (d_IK)"));
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueSrad_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueSrad_Kernel, kernelSrad_Kernel, workDimSrad_Kernel, NULL, globalSizeSrad_Kernel, localSizeSrad_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueSrad_Kernel, kernelSrad_Kernel, workDimSrad_Kernel, NULL, globalSizeSrad_Kernel, localSizeSrad_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 1), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "srad_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueSrad_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -324,13 +328,15 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueSrad_Kernel, d_dNK, CL_TRUE, 0, 229916 * sizeof(float), d_dN, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueSrad_Kernel, d_dSK, CL_TRUE, 0, 229916 * sizeof(float), d_dS, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueSrad_Kernel, d_dEK, CL_TRUE, 0, 229916 * sizeof(float), d_dE, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueSrad_Kernel, d_dWK, CL_TRUE, 0, 229916 * sizeof(float), d_dW, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueSrad_Kernel, d_cK, CL_TRUE, 0, 229916 * sizeof(float), d_c, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueSrad_Kernel, d_dNK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_dN, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_dN"));
+		fRet = clEnqueueReadBuffer(transferQueueSrad_Kernel, d_dSK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_dS, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_dS"));
+		fRet = clEnqueueReadBuffer(transferQueueSrad_Kernel, d_dEK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_dE, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_dE"));
+		fRet = clEnqueueReadBuffer(transferQueueSrad_Kernel, d_dWK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_dW, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_dW"));
+		fRet = clEnqueueReadBuffer(transferQueueSrad_Kernel, d_cK, TRANSFER_BLOCKING, 0, 229916 * sizeof(float), d_c, ASYNC_WAIT_LIST(profileEvents, 1, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "d_c"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 2, 5);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -349,6 +355,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -357,6 +364,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(d_iNK)
 		clReleaseMemObject(d_iNK);
@@ -406,6 +416,8 @@ _err:
 	/* Dealloc queues */
 	if(queueSrad_Kernel)
 		clReleaseCommandQueue(queueSrad_Kernel);
+	if(transferQueueSrad_Kernel)
+		clReleaseCommandQueue(transferQueueSrad_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -52,13 +52,7 @@ int iters = 0;
 }
 
 #define LOOPPOSTAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit, loopFlag) {\
-	int _i;\
-	float tmp[262144];\
-\
-	memcpy(tmp, src, 262144 * sizeof(float));\
-	memcpy(src, dst, 262144 * sizeof(float));\
-	memcpy(dst, tmp, 262144 * sizeof(float));\
-\
+	/* Source and destination buffers are swapped on device by the host loop */\
 	iters++;\
 \
 	loopFlag = (iters < TOTAL_ITERATIONS);\
@@ -0,0 +1,145 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit);
+ *            POSTAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit);
+ *            LOOPPREAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit, loopFlag);
+ *            LOOPPOSTAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit, loopFlag);
+ *            CLEANUP(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit);
+ *        where:
+ *            power: variable (float *);
+ *            powerSz: number of members in variable (unsigned int);
+ *            src: variable (float *);
+ *            srcSz: number of members in variable (unsigned int);
+ *            dst: variable (float *);
+ *            dstSz: number of members in variable (unsigned int);
+ *            grid_cols: variable (int);
+ *            grid_rows: variable (int);
+ *            sdc: variable (float);
+ *            Rx_1: variable (float);
+ *            Ry_1: variable (float);
+ *            Rz_1: variable (float);
+ *            comp_exit: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static float *power = NULL;
+static unsigned int powerSz = 0;
+static float *src = NULL;
+static unsigned int srcSz = 0;
+static float *dst = NULL;
+static unsigned int dstSz = 0;
+static int grid_cols;
+static int grid_rows;
+static float sdc;
+static float Rx_1;
+static float Ry_1;
+static float Rz_1;
+static int comp_exit;
+
+/* Work sizes */
+static size_t *globalSizeHotspot = NULL;
+static size_t *localSizeHotspot = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(power),
+	RT_BIND_POINTER(src),
+	RT_BIND_POINTER(dst),
+	RT_BIND_VALUE(grid_cols),
+	RT_BIND_VALUE(grid_rows),
+	RT_BIND_VALUE(sdc),
+	RT_BIND_VALUE(Rx_1),
+	RT_BIND_VALUE(Ry_1),
+	RT_BIND_VALUE(Rz_1),
+	RT_BIND_VALUE(comp_exit),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(hotspot, Hotspot),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	(void) i;
+	(void) loopFlagPtr;
+
+	return EXIT_SUCCESS;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(power, powerSz, src, srcSz, dst, dstSz, grid_cols, grid_rows, sdc, Rx_1, Ry_1, Rz_1, comp_exit, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
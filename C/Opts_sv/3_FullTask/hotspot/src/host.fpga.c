@@ -99,6 +99,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueHotspot = NULL;
+	cl_command_queue transferQueueHotspot = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -110,6 +111,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 6);
 	cl_uint workDimHotspot = 1;
 	size_t globalSizeHotspot[1] = {
 		1
@@ -164,7 +166,13 @@ int main(void) {
 
 	/* Create command queue for hotspot kernel */
 	PRINT_STEP("Creating command queue for \"hotspot\"...");
-	queueHotspot = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueHotspot = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for hotspot kernel */
+	PRINT_STEP("Creating transfer command queue for \"hotspot\"...");
+	transferQueueHotspot = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -238,15 +246,24 @@ int main(void) {
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (comp_exit)"));
 	PRINT_SUCCESS();
 
+	/* Setting input and output buffers (uploaded only once, kernel arguments are swapped on device) */
+	PRINT_STEP("Setting buffers...");
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, powerK, CL_TRUE, 0, 262144 * sizeof(float), power, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "power"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (powerK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, srcK, CL_TRUE, 0, 262144 * sizeof(float), src, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "src"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (srcK)"));
+	fRet = clEnqueueWriteBuffer(transferQueueHotspot, dstK, CL_TRUE, 0, 262144 * sizeof(float), dst, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "dst"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dstK)"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
 	do {
-		/* Setting input and output buffers */
+		/* Setting kernel arguments */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueHotspot, powerK, CL_TRUE, 0, 262144 * sizeof(float), power, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (powerK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspot, srcK, CL_TRUE, 0, 262144 * sizeof(float), src, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (srcK)"));
-		fRet = clEnqueueWriteBuffer(queueHotspot, dstK, CL_TRUE, 0, 262144 * sizeof(float), dst, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dstK)"));
+		fRet = clSetKernelArg(kernelHotspot, 1, sizeof(cl_mem), (i % 2)? &dstK : &srcK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (srcK)"));
+		fRet = clSetKernelArg(kernelHotspot, 2, sizeof(cl_mem), (i % 2)? &srcK : &dstK);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (dstK)"));
 		fRet = clSetKernelArg(kernelHotspot, 3, sizeof(int), &grid_cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (grid_cols)"));
 		fRet = clSetKernelArg(kernelHotspot, 4, sizeof(int), &grid_rows);
@@ -265,18 +282,12 @@ int main(void) {
 
 		PRINT_STEP("[%d] Running kernels...", i);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueHotspot, kernelHotspot, workDimHotspot, NULL, globalSizeHotspot, localSizeHotspot, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueHotspot, kernelHotspot, workDimHotspot, NULL, globalSizeHotspot, localSizeHotspot, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "hotspot"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueHotspot);
 		gettimeofday(&tNow, NULL);
 		PRINT_SUCCESS();
-
-		/* Get output buffers */
-		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueHotspot, srcK, CL_TRUE, 0, 262144 * sizeof(float), src, 0, NULL, NULL);
-		fRet = clEnqueueReadBuffer(queueHotspot, dstK, CL_TRUE, 0, 262144 * sizeof(float), dst, 0, NULL, NULL);
-		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
-		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -287,10 +298,19 @@ int main(void) {
 		i++;
 	} while(loopFlag);
 
+	/* Get output buffers */
+	PRINT_STEP("Getting kernels arguments...");
+	fRet = clEnqueueReadBuffer(transferQueueHotspot, (i % 2)? dstK : srcK, CL_TRUE, 0, 262144 * sizeof(float), src, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "src"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	fRet = clEnqueueReadBuffer(transferQueueHotspot, (i % 2)? srcK : dstK, CL_TRUE, 0, 262144 * sizeof(float), dst, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, "dst"));
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
 
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -299,6 +319,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(powerK)
 		clReleaseMemObject(powerK);
@@ -327,6 +350,8 @@ _err:
 	/* Dealloc queues */
 	if(queueHotspot)
 		clReleaseCommandQueue(queueHotspot);
+	if(transferQueueHotspot)
+		clReleaseCommandQueue(transferQueueHotspot);
 
 	/* Last OpenCL variables */
 	if(context)
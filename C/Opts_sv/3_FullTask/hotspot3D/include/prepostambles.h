@@ -1,8 +1,5 @@
 #include "constants.h"
 
-float *gTemp = NULL;
-
-
 #define PREAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, last_col, comp_exit) {\
 	int _i, _j;\
 	unsigned int _vars = 3;\
@@ -51,8 +48,6 @@ float *gTemp = NULL;
 \
 	/* We are using another logic to break loop */\
 	loopFlag = true;\
-\
-	gTemp = malloc(tOutSz * sizeof(float));\
 \
 	int _compBSizeX = BLOCK_X - 2;\
 	int _compBSizeY = BLOCK_Y - 2;\
@@ -71,12 +66,8 @@ float *gTemp = NULL;
 }
 
 #define LOOPPOSTAMBLE(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, last_col, comp_exit, loopFlag) {\
-	memcpy(gTemp, tIn, tInSz * sizeof(float));\
-	memcpy(tIn, tOut, tInSz * sizeof(float));\
-	memcpy(tOut, gTemp, tInSz * sizeof(float));\
+	/* tIn and tOut buffers are swapped on device by the host loop */\
 }
 
 #define CLEANUP(p, pSz, tIn, tInSz, tOut, tOutSz, tOutC, tOutCSz, sdc, nx, ny, nz, ce, cw, cn, cs, ct, cb, cc, last_col, comp_exit) {\
-	if(gTemp)\
-		free(gTemp);\
 }
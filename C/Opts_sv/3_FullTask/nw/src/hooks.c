@@ -0,0 +1,156 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset);
+ *            POSTAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset);
+ *            LOOPPREAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset, loopFlag);
+ *            LOOPPOSTAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset, loopFlag);
+ *            CLEANUP(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset);
+ *        where:
+ *            reference: variable (int *);
+ *            referenceSz: number of members in variable (unsigned int);
+ *            data: variable (int *);
+ *            dataSz: number of members in variable (unsigned int);
+ *            dataC: variable (int *);
+ *            dataCSz: number of members in variable (unsigned int);
+ *            input_v: variable (int *);
+ *            input_vSz: number of members in variable (unsigned int);
+ *            dim: variable (int);
+ *            penalty: variable (int);
+ *            loop_exit: variable (int);
+ *            block_offset: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int *reference = NULL;
+static unsigned int referenceSz = 0;
+static int *data = NULL;
+static unsigned int dataSz = 0;
+static int *dataC = NULL;
+static unsigned int dataCSz = 0;
+static int *input_v = NULL;
+static unsigned int input_vSz = 0;
+static int dim;
+static int penalty;
+static int loop_exit;
+static int block_offset;
+
+/* Work sizes */
+static size_t *globalSizeNw_Kernel1 = NULL;
+static size_t *localSizeNw_Kernel1 = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(reference),
+	RT_BIND_POINTER_C(data),
+	RT_BIND_POINTER(input_v),
+	RT_BIND_VALUE(dim),
+	RT_BIND_VALUE(penalty),
+	RT_BIND_VALUE(loop_exit),
+	RT_BIND_VALUE(block_offset),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(nw_kernel1, Nw_Kernel1),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(reference, referenceSz, data, dataSz, dataC, dataCSz, input_v, input_vSz, dim, penalty, loop_exit, block_offset, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	(void) i;
+
+	return EXIT_SUCCESS;
+}
+
+void hooks_cleanup(void) {
+}
@@ -98,6 +98,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueNw_Kernel1 = NULL;
+	cl_command_queue transferQueueNw_Kernel1 = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -109,6 +110,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimNw_Kernel1 = 1;
 	size_t globalSizeNw_Kernel1[1] = {
 		1
@@ -161,7 +163,13 @@ int main(void) {
 
 	/* Create command queue for nw_kernel1 kernel */
 	PRINT_STEP("Creating command queue for \"nw_kernel1\"...");
-	queueNw_Kernel1 = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueNw_Kernel1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for nw_kernel1 kernel */
+	PRINT_STEP("Creating transfer command queue for \"nw_kernel1\"...");
+	transferQueueNw_Kernel1 = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -237,11 +245,11 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel1, referenceK, CL_TRUE, 0, 4196352 * sizeof(int), reference, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel1, referenceK, TRANSFER_BLOCKING, 0, 4196352 * sizeof(int), reference, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "reference"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (referenceK)"));
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel1, dataK, CL_TRUE, 0, 4196352 * sizeof(int), data, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel1, dataK, TRANSFER_BLOCKING, 0, 4196352 * sizeof(int), data, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "data"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dataK)"));
-		fRet = clEnqueueWriteBuffer(queueNw_Kernel1, input_vK, CL_TRUE, 0, 2049 * sizeof(int), input_v, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueNw_Kernel1, input_vK, TRANSFER_BLOCKING, 0, 2049 * sizeof(int), input_v, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "input_v"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (input_vK)"));
 		fRet = clSetKernelArg(kernelNw_Kernel1, 3, sizeof(int), &dim);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (dim)"));
@@ -254,8 +262,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueNw_Kernel1);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueNw_Kernel1, kernelNw_Kernel1, workDimNw_Kernel1, NULL, globalSizeNw_Kernel1, localSizeNw_Kernel1, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueNw_Kernel1, kernelNw_Kernel1, workDimNw_Kernel1, NULL, globalSizeNw_Kernel1, localSizeNw_Kernel1, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "nw_kernel1"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueNw_Kernel1);
 		gettimeofday(&tNow, NULL);
@@ -263,9 +272,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueNw_Kernel1, dataK, CL_TRUE, 0, 4196352 * sizeof(int), data, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueNw_Kernel1, dataK, TRANSFER_BLOCKING, 0, 4196352 * sizeof(int), data, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "data"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -280,6 +291,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -297,6 +309,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(referenceK)
 		clReleaseMemObject(referenceK);
@@ -326,6 +341,8 @@ _err:
 	/* Dealloc queues */
 	if(queueNw_Kernel1)
 		clReleaseCommandQueue(queueNw_Kernel1);
+	if(transferQueueNw_Kernel1)
+		clReleaseCommandQueue(transferQueueNw_Kernel1);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -0,0 +1,161 @@
+/* ********************************************************************************************* */
+/* * Pre/Postamble Hooks for the Shared Runtime                                                * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "runtime.h"
+
+/**
+ * @brief Header where pre/postamble macro functions should be located.
+ *        Function headers:
+ *            PREAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+ *            POSTAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+ *            LOOPPREAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit, loopFlag);
+ *            LOOPPOSTAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit, loopFlag);
+ *            CLEANUP(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+ *        where:
+ *            wall: variable (int *);
+ *            wallSz: number of members in variable (unsigned int);
+ *            src: variable (int *);
+ *            srcSz: number of members in variable (unsigned int);
+ *            dst: variable (int *);
+ *            dstSz: number of members in variable (unsigned int);
+ *            cols: variable (int);
+ *            rem_rows: variable (int);
+ *            starting_row: variable (int);
+ *            comp_exit: variable (int);
+ *            loopFlag: loop condition variable (bool).
+ */
+#include "prepostambles.h"
+
+/* Input/output variables */
+static int *wall = NULL;
+static unsigned int wallSz = 0;
+static int *src = NULL;
+static unsigned int srcSz = 0;
+static int *dst = NULL;
+static unsigned int dstSz = 0;
+static int cols;
+static int rem_rows;
+static int starting_row;
+static int comp_exit;
+
+/* Work sizes */
+static size_t *globalSizeDynproc_Kernel = NULL;
+static size_t *localSizeDynproc_Kernel = NULL;
+
+/**
+ * @brief Variables bound to the kernel description.
+ */
+rt_binding_t rtBindings[] = {
+	RT_BIND_POINTER(wall),
+	RT_BIND_POINTER(src),
+	RT_BIND_POINTER(dst),
+	RT_BIND_VALUE(cols),
+	RT_BIND_VALUE(rem_rows),
+	RT_BIND_VALUE(starting_row),
+	RT_BIND_VALUE(comp_exit),
+	RT_BIND_END
+};
+
+/**
+ * @brief Work sizes bound to the kernel description.
+ */
+rt_ndrange_t rtNDRanges[] = {
+	RT_NDRANGE(dynproc_kernel, Dynproc_Kernel),
+	RT_NDRANGE_END
+};
+
+int hooks_preamble(bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling preamble function */
+	PRINT_STEP("Calling preamble function...");
+	PREAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPreamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+	int once;
+
+	/* Calling loop preamble function */
+	PRINT_STEP("[%d] Calling loop preamble function...", i);
+	for(once = 0; once < 1; once++) {
+		LOOPPREAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit, loopFlag);
+		PRINT_SUCCESS();
+
+		*loopFlagPtr = loopFlag;
+		return rv;
+	}
+
+	/* Loop preamble left the loop */
+	*loopFlagPtr = loopFlag;
+	return RT_HOOK_BREAK;
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_loopPostamble(int i, bool *loopFlagPtr) {
+	int rv = EXIT_SUCCESS;
+	bool loopFlag = *loopFlagPtr;
+
+	/* Calling loop postamble function */
+	PRINT_STEP("[%d] Calling loop postamble function...", i);
+	LOOPPOSTAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit, loopFlag);
+	PRINT_SUCCESS();
+
+	*loopFlagPtr = loopFlag;
+	return rv;
+}
+
+int hooks_postamble(int i) {
+	int rv = EXIT_SUCCESS;
+
+	(void) i;
+
+	/* Calling postamble function */
+	PRINT_STEP("Calling postamble function...");
+	POSTAMBLE(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+	PRINT_SUCCESS();
+
+	return rv;
+}
+
+void hooks_cleanup(void) {
+	/* Calling cleanup function */
+	CLEANUP(wall, wallSz, src, srcSz, dst, dstSz, cols, rem_rows, starting_row, comp_exit);
+}
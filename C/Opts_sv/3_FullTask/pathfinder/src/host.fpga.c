@@ -96,6 +96,7 @@ int main(void) {
 	cl_device_id *devices = NULL;
 	cl_context context = NULL;
 	cl_command_queue queueDynproc_Kernel = NULL;
+	cl_command_queue transferQueueDynproc_Kernel = NULL;
 	FILE *programFile = NULL;
 	long programSz;
 	char *programContent = NULL;
@@ -107,6 +108,7 @@ int main(void) {
 	long totalTime;
 	struct timeval tThen, tNow, tDelta, tExecTime;
 	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, 5);
 	cl_uint workDimDynproc_Kernel = 1;
 	size_t globalSizeDynproc_Kernel[1] = {
 		1
@@ -158,7 +160,13 @@ int main(void) {
 
 	/* Create command queue for dynproc_kernel kernel */
 	PRINT_STEP("Creating command queue for \"dynproc_kernel\"...");
-	queueDynproc_Kernel = clCreateCommandQueue(context, devices[0], 0, &fRet);
+	queueDynproc_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Create transfer command queue for dynproc_kernel kernel */
+	PRINT_STEP("Creating transfer command queue for \"dynproc_kernel\"...");
+	transferQueueDynproc_Kernel = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
 	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
 	PRINT_SUCCESS();
 
@@ -234,11 +242,11 @@ int main(void) {
 
 		/* Setting input and output buffers */
 		PRINT_STEP("[%d] Setting buffers...", i);
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, wallK, CL_TRUE, 0, 990000 * sizeof(int), wall, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, wallK, TRANSFER_BLOCKING, 0, 990000 * sizeof(int), wall, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "wall"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (wallK)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, srcK, CL_TRUE, 0, 10000 * sizeof(int), src, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, srcK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), src, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "src"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (srcK)"));
-		fRet = clEnqueueWriteBuffer(queueDynproc_Kernel, dstK, CL_TRUE, 0, 10000 * sizeof(int), dst, 0, NULL, NULL);
+		fRet = clEnqueueWriteBuffer(transferQueueDynproc_Kernel, dstK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), dst, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, "dst"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer (dstK)"));
 		fRet = clSetKernelArg(kernelDynproc_Kernel, 3, sizeof(int), &cols);
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg (cols)"));
@@ -251,8 +259,9 @@ int main(void) {
 		PRINT_SUCCESS();
 
 		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueueDynproc_Kernel);
 		gettimeofday(&tThen, NULL);
-		fRet = clEnqueueNDRangeKernel(queueDynproc_Kernel, kernelDynproc_Kernel, workDimDynproc_Kernel, NULL, globalSizeDynproc_Kernel, localSizeDynproc_Kernel, 0, NULL, NULL);
+		fRet = clEnqueueNDRangeKernel(queueDynproc_Kernel, kernelDynproc_Kernel, workDimDynproc_Kernel, NULL, globalSizeDynproc_Kernel, localSizeDynproc_Kernel, ASYNC_WAIT_LIST(profileEvents, 0, 3), PROFILE_EVENT(profileEvents, PROFILE_KERNEL, "dynproc_kernel"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
 		clFinish(queueDynproc_Kernel);
 		gettimeofday(&tNow, NULL);
@@ -260,9 +269,11 @@ int main(void) {
 
 		/* Get output buffers */
 		PRINT_STEP("[%d] Getting kernels arguments...", i);
-		fRet = clEnqueueReadBuffer(queueDynproc_Kernel, dstK, CL_TRUE, 0, 10000 * sizeof(int), dst, 0, NULL, NULL);
+		fRet = clEnqueueReadBuffer(transferQueueDynproc_Kernel, dstK, TRANSFER_BLOCKING, 0, 10000 * sizeof(int), dst, ASYNC_WAIT_LIST(profileEvents, 3, 1), PROFILE_EVENT(profileEvents, PROFILE_READ, "dst"));
 		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		ASYNC_WAIT(profileEvents, 4, 1);
 		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
 
 		/* Calling loop postamble function */
 		PRINT_STEP("[%d] Calling loop postamble function...", i);
@@ -281,6 +292,7 @@ int main(void) {
 	/* Print profiling results */
 	totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
 	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	PROFILE_SUMMARY(profileEvents, i);
 
 	/* Validate received data */
 	PRINT_STEP("Validating received data...");
@@ -289,6 +301,9 @@ int main(void) {
 
 _err:
 
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
 	/* Dealloc buffers */
 	if(wallK)
 		clReleaseMemObject(wallK);
@@ -317,6 +332,8 @@ _err:
 	/* Dealloc queues */
 	if(queueDynproc_Kernel)
 		clReleaseCommandQueue(queueDynproc_Kernel);
+	if(transferQueueDynproc_Kernel)
+		clReleaseCommandQueue(transferQueueDynproc_Kernel);
 
 	/* Last OpenCL variables */
 	if(context)
@@ -32,5 +32,6 @@ for i in ${PROJECTS[@]}; do
 	echo -e "\tCompiling: $i"
 	cd $i
 	make gpu/execute
+	make gpu/rtexecute
 	cd ..
 done
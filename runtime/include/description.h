@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DESCRIPTION_H
+#define DESCRIPTION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Variable kinds, according to the XML node name.
+ */
+#define DESC_INPUT 0
+#define DESC_OUTPUT 1
+#define DESC_LOCAL 2
+
+/**
+ * @brief Type classes, used for parsing initial values and validating data.
+ */
+#define DESC_CLASS_SIGNED 0
+#define DESC_CLASS_UNSIGNED 1
+#define DESC_CLASS_FLOAT 2
+
+/**
+ * @brief Maximum number of NDRange dimensions.
+ */
+#define DESC_MAX_DIMS 3
+
+typedef struct {
+	char *name;
+	long long value;
+	bool isReal;
+	double real;
+} desc_param_t;
+
+typedef struct {
+	const char *name;
+	size_t size;
+	size_t componentSize;
+	unsigned int components;
+	unsigned int typeClass;
+} desc_type_t;
+
+typedef struct {
+	char *name;
+	const desc_type_t *type;
+	unsigned int kind;
+	unsigned int nmemb;
+	unsigned int arg;
+	char *value;
+	bool forcePointer;
+	bool noValidation;
+	bool hasEpsilon;
+	double epsilon;
+	bool resident;
+	bool noUpload;
+	bool noDownload;
+	char *swap;
+	unsigned int split;
+} desc_var_t;
+
+typedef struct {
+	char *name;
+	unsigned int dim;
+	size_t global[DESC_MAX_DIMS];
+	size_t local[DESC_MAX_DIMS];
+	bool hasLocal;
+	bool split;
+	bool tune;
+	char *localMacro;
+	desc_var_t *vars;
+	unsigned int varsLen;
+} desc_kernel_t;
+
+typedef struct {
+	char *source;
+	char *binary;
+	unsigned int items;
+	char *itemsUnit;
+	unsigned long long bytes;
+	unsigned long long flops;
+	double peakBandwidth;
+	desc_param_t *params;
+	unsigned int paramsLen;
+	desc_kernel_t *kernels;
+	unsigned int kernelsLen;
+} desc_t;
+
+desc_t *desc_parse(const char *fileName, char **overrides, unsigned int overridesLen);
+void desc_destroy(desc_t **desc);
+const desc_type_t *desc_getType(const char *name);
+bool desc_isPointer(desc_var_t *var);
+bool desc_hasBuffer(desc_var_t *var);
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Default kernel description file, relative to the working directory.
+ */
+#define RT_DEFAULT_DESCRIPTION "kern.xml"
+
+/**
+ * @brief Maximum number of commands (writes, kernels and reads) in one iteration.
+ */
+#define RT_MAX_EVENTS 256
+
+/**
+ * @brief Maximum number of devices used when splitting kernels across devices.
+ */
+#define RT_MAX_DEVICES 16
+
+/**
+ * @brief File where the work partitioning weights of each device are stored, relative to the working directory.
+ */
+#define RT_CALIBRATION_FILE "rtcalibration"
+
+/**
+ * @brief Benchmark mode defaults: warmup launches per kernel, minimum number of samples per kernel and target half-width of the
+ *        95% confidence interval of the mean, relative to the mean.
+ */
+#define RT_BENCH_WARMUP 3
+#define RT_BENCH_MIN_SAMPLES 10
+#define RT_BENCH_ERROR 0.01
+
+/**
+ * @brief Work-group tuning: file where the best local sizes of each device are stored (relative to the working directory),
+ *        launches timed per candidate and maximum length of the build options holding local size macros.
+ */
+#define RT_TUNING_FILE "rttuning"
+#define RT_TUNE_REPETITIONS 3
+#define RT_MAX_OPTIONS 1024
+
+/**
+ * @brief Value returned by hooks_loopPreamble when the loop preamble left the loop.
+ */
+#define RT_HOOK_BREAK -1
+
+/**
+ * @brief Binding between a variable described in the XML file and the variable used by the project's pre/postambles.
+ *        For pointer variables, var, varC point to the pointer variables and the runtime allocates their memory.
+ *        For value variables, var, varC point to the variables themselves.
+ */
+typedef struct {
+	const char *name;
+	void *var;
+	void *varC;
+	unsigned int *varSz;
+	unsigned int *varCSz;
+	bool isPointer;
+} rt_binding_t;
+
+/**
+ * @brief Binding initialisers. Variables suffixed with C hold the expected output (see hostcodegen).
+ * @param var Variable name, as in the XML file.
+ */
+#define RT_BIND_VALUE(var) {#var, &var, NULL, NULL, NULL, false}
+#define RT_BIND_VALUE_C(var) {#var, &var, &var##C, NULL, NULL, false}
+#define RT_BIND_POINTER(var) {#var, &var, NULL, &var##Sz, NULL, true}
+#define RT_BIND_POINTER_C(var) {#var, &var, &var##C, &var##Sz, &var##CSz, true}
+#define RT_BIND_END {NULL, NULL, NULL, NULL, NULL, false}
+
+/**
+ * @brief Binding between a kernel described in the XML file and the work sizes used by the project's pre/postambles.
+ *        The runtime points global, local to the work sizes read from the XML file, which may then be changed by the hooks.
+ */
+typedef struct {
+	const char *name;
+	size_t **global;
+	size_t **local;
+} rt_ndrange_t;
+
+/**
+ * @brief NDRange binding initialisers.
+ * @param kernel Kernel name, as in the XML file.
+ * @param suffix Suffix of the work size variables (e.g. globalSizeSuffix, localSizeSuffix, see hostcodegen).
+ */
+#define RT_NDRANGE(kernel, suffix) {#kernel, &globalSize##suffix, &localSize##suffix}
+#define RT_NDRANGE_END {NULL, NULL, NULL}
+
+/**
+ * @brief Bindings of the project, terminated by RT_BIND_END and RT_NDRANGE_END.
+ */
+extern rt_binding_t rtBindings[];
+extern rt_ndrange_t rtNDRanges[];
+
+/**
+ * @brief Project hooks calling the pre/postamble macros from prepostambles.h.
+ *        All return EXIT_SUCCESS or EXIT_FAILURE, except where noted.
+ */
+int hooks_preamble(bool *loopFlag);
+/* Also returns RT_HOOK_BREAK if the loop should be left before executing the kernels */
+int hooks_loopPreamble(int i, bool *loopFlag);
+int hooks_loopPostamble(int i, bool *loopFlag);
+int hooks_postamble(int i);
+void hooks_cleanup(void);
+
+/**
+ * @brief Get an integer parameter of the kernel description (as overridden with -p), so that hooks may follow it.
+ * @param name Parameter name.
+ * @param def Value returned when the description does not declare the parameter.
+ * @return Parameter value.
+ */
+long long rt_getParam(const char *name, long long def);
+
+/**
+ * @brief Set the number of items processed by the current iteration, when it differs from the items of the kernel description
+ *        (e.g. a partial last batch). Only the reported throughput is affected.
+ * @param items Items processed by the current iteration.
+ */
+void rt_setItems(unsigned int items);
+
+#endif
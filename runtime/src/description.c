@@ -0,0 +1,644 @@
+/**
+ * Copyright (c) 2018 Andre Bannwart Perina
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <CL/opencl.h>
+#include "description.h"
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const desc_type_t types[] = {
+	{"bool", sizeof(bool), sizeof(bool), 1, DESC_CLASS_UNSIGNED},
+	{"char", sizeof(char), sizeof(char), 1, DESC_CLASS_SIGNED},
+	{"unsigned char", sizeof(unsigned char), sizeof(unsigned char), 1, DESC_CLASS_UNSIGNED},
+	{"short", sizeof(short), sizeof(short), 1, DESC_CLASS_SIGNED},
+	{"unsigned short", sizeof(unsigned short), sizeof(unsigned short), 1, DESC_CLASS_UNSIGNED},
+	{"int", sizeof(int), sizeof(int), 1, DESC_CLASS_SIGNED},
+	{"unsigned int", sizeof(unsigned int), sizeof(unsigned int), 1, DESC_CLASS_UNSIGNED},
+	{"long", sizeof(long), sizeof(long), 1, DESC_CLASS_SIGNED},
+	{"unsigned long", sizeof(unsigned long), sizeof(unsigned long), 1, DESC_CLASS_UNSIGNED},
+	{"float", sizeof(float), sizeof(float), 1, DESC_CLASS_FLOAT},
+	{"double", sizeof(double), sizeof(double), 1, DESC_CLASS_FLOAT},
+	{"cl_float2", sizeof(cl_float2), sizeof(cl_float), 2, DESC_CLASS_FLOAT},
+	{"cl_float3", sizeof(cl_float3), sizeof(cl_float), 3, DESC_CLASS_FLOAT},
+	{"cl_float4", sizeof(cl_float4), sizeof(cl_float), 4, DESC_CLASS_FLOAT},
+	{"cl_float8", sizeof(cl_float8), sizeof(cl_float), 8, DESC_CLASS_FLOAT},
+	{"cl_float16", sizeof(cl_float16), sizeof(cl_float), 16, DESC_CLASS_FLOAT},
+	{"cl_int2", sizeof(cl_int2), sizeof(cl_int), 2, DESC_CLASS_SIGNED},
+	{"cl_int4", sizeof(cl_int4), sizeof(cl_int), 4, DESC_CLASS_SIGNED},
+	{"cl_uint2", sizeof(cl_uint2), sizeof(cl_uint), 2, DESC_CLASS_UNSIGNED},
+	{"cl_uint4", sizeof(cl_uint4), sizeof(cl_uint), 4, DESC_CLASS_UNSIGNED},
+	{NULL, 0, 0, 0, 0}
+};
+
+static bool evalSum(desc_t *desc, const char **curr, long long *value);
+
+static const desc_param_t *findParam(desc_t *desc, const char *name, size_t len) {
+	unsigned int p;
+
+	for(p = 0; p < desc->paramsLen; p++) {
+		if((strlen(desc->params[p].name) == len) && !strncmp(desc->params[p].name, name, len))
+			return &(desc->params[p]);
+	}
+
+	return NULL;
+}
+
+static bool evalFactor(desc_t *desc, const char **curr, long long *value) {
+	const char *start;
+	const desc_param_t *param;
+
+	while(isspace((unsigned char) **curr))
+		(*curr)++;
+
+	if('(' == **curr) {
+		(*curr)++;
+		if(!evalSum(desc, curr, value))
+			return false;
+		while(isspace((unsigned char) **curr))
+			(*curr)++;
+		if(**curr != ')')
+			return false;
+		(*curr)++;
+		return true;
+	}
+
+	if('-' == **curr) {
+		(*curr)++;
+		if(!evalFactor(desc, curr, value))
+			return false;
+		*value = -(*value);
+		return true;
+	}
+
+	if(isdigit((unsigned char) **curr)) {
+		char *end;
+
+		*value = strtoll(*curr, &end, 10);
+		*curr = end;
+		return true;
+	}
+
+	/* Identifiers refer to previously defined parameters */
+	start = *curr;
+	while(isalnum((unsigned char) **curr) || ('_' == **curr))
+		(*curr)++;
+	param = (*curr != start)? findParam(desc, start, *curr - start) : NULL;
+	if(!param || param->isReal)
+		return false;
+	*value = param->value;
+
+	return true;
+}
+
+static bool evalProduct(desc_t *desc, const char **curr, long long *value) {
+	long long rhs;
+	char op;
+
+	if(!evalFactor(desc, curr, value))
+		return false;
+
+	while(true) {
+		while(isspace((unsigned char) **curr))
+			(*curr)++;
+		op = **curr;
+		if(op != '*' && op != '/' && op != '%')
+			return true;
+
+		(*curr)++;
+		if(!evalFactor(desc, curr, &rhs) || (('*' != op) && !rhs))
+			return false;
+		*value = ('*' == op)? *value * rhs : (('/' == op)? *value / rhs : *value % rhs);
+	}
+}
+
+static bool evalSum(desc_t *desc, const char **curr, long long *value) {
+	long long rhs;
+	char op;
+
+	if(!evalProduct(desc, curr, value))
+		return false;
+
+	while(true) {
+		while(isspace((unsigned char) **curr))
+			(*curr)++;
+		op = **curr;
+		if(op != '+' && op != '-')
+			return true;
+
+		(*curr)++;
+		if(!evalProduct(desc, curr, &rhs))
+			return false;
+		*value = ('+' == op)? *value + rhs : *value - rhs;
+	}
+}
+
+/**
+ * @brief Evaluate an integer expression (+, -, *, /, %, parentheses, literals and parameters) that spans the whole string.
+ */
+static bool evaluate(desc_t *desc, const char *str, long long *value) {
+	const char *curr = str;
+
+	if(!evalSum(desc, &curr, value))
+		return false;
+	while(isspace((unsigned char) *curr))
+		curr++;
+
+	return !(*curr);
+}
+
+static char *getProp(xmlNodePtr node, const char *prop) {
+	xmlChar *value = xmlGetProp(node, (const xmlChar *) prop);
+	char *ret = NULL;
+
+	if(value) {
+		ret = strdup((const char *) value);
+		xmlFree(value);
+	}
+
+	return ret;
+}
+
+static bool getBoolProp(xmlNodePtr node, const char *prop) {
+	char *value = getProp(node, prop);
+	bool ret = value && (!strcmp(value, "yes") || !strcmp(value, "true"));
+
+	free(value);
+
+	return ret;
+}
+
+/**
+ * @brief Get an unsigned integer property, rejecting anything but a plain decimal number.
+ */
+static bool getUIntProp(xmlNodePtr node, const char *prop, unsigned int *value) {
+	char *str = getProp(node, prop);
+	char *end;
+	unsigned long result;
+	bool valid;
+
+	if(!str)
+		return false;
+
+	errno = 0;
+	result = strtoul(str, &end, 10);
+	valid = isdigit((unsigned char) *str) && (end != str) && !(*end) && !errno && (result <= UINT_MAX);
+	if(!valid)
+		fprintf(stderr, "Error: invalid %s \"%s\" on <%s>.\n", prop, str, (const char *) node->name);
+	*value = result;
+	free(str);
+
+	return valid;
+}
+
+static bool getExprProp(desc_t *desc, xmlNodePtr node, const char *prop, unsigned int *value) {
+	char *str = getProp(node, prop);
+	long long result;
+	bool valid;
+
+	if(!str)
+		return false;
+
+	valid = evaluate(desc, str, &result) && (result >= 0) && (result <= UINT_MAX);
+	if(!valid)
+		fprintf(stderr, "Error: invalid expression \"%s\".\n", str);
+	*value = result;
+	free(str);
+
+	return valid;
+}
+
+/**
+ * @brief Check whether a property is a plain integer literal, rather than an expression or a parameter.
+ */
+static bool isLiteralProp(xmlNodePtr node, const char *prop) {
+	char *str = getProp(node, prop);
+	char *curr;
+	bool literal = str;
+
+	for(curr = str; literal && *curr; curr++)
+		literal = isdigit((unsigned char) *curr) || isspace((unsigned char) *curr);
+	free(str);
+
+	return literal;
+}
+
+/**
+ * @brief Get an integer expression property that may not fit in an unsigned int (e.g. bytes or operations).
+ */
+static bool getLongExprProp(desc_t *desc, xmlNodePtr node, const char *prop, unsigned long long *value) {
+	char *str = getProp(node, prop);
+	long long result;
+	bool valid;
+
+	if(!str)
+		return false;
+
+	valid = evaluate(desc, str, &result) && (result >= 0);
+	if(!valid)
+		fprintf(stderr, "Error: invalid expression \"%s\".\n", str);
+	*value = result;
+	free(str);
+
+	return valid;
+}
+
+/**
+ * @brief Get a real property, which is either an integer expression or a real number, given directly or as a parameter.
+ */
+static bool getRealProp(desc_t *desc, xmlNodePtr node, const char *prop, double *value) {
+	char *str = getProp(node, prop);
+	const desc_param_t *param;
+	long long result;
+	char *end;
+	bool valid;
+
+	if(!str)
+		return false;
+
+	param = findParam(desc, str, strlen(str));
+	if(param && param->isReal) {
+		*value = param->real;
+		valid = true;
+	}
+	else if(evaluate(desc, str, &result)) {
+		*value = result;
+		valid = true;
+	}
+	else {
+		*value = strtod(str, &end);
+		valid = strlen(str) && !(*end);
+	}
+	if(!valid)
+		fprintf(stderr, "Error: invalid expression \"%s\".\n", str);
+	free(str);
+
+	return valid;
+}
+
+static unsigned int parseSizes(desc_t *desc, xmlNodePtr node, size_t *sizes) {
+	xmlChar *content = xmlNodeGetContent(node);
+	char *curr = (char *) content;
+	char *end;
+	long long size;
+	unsigned int n = 0;
+
+	/* Sizes are comma-separated expressions */
+	while(curr && *curr && n <= DESC_MAX_DIMS) {
+		end = strchr(curr, ',');
+		if(end)
+			*end = '\0';
+
+		if(!evaluate(desc, curr, &size) || (size <= 0) || (DESC_MAX_DIMS == n)) {
+			fprintf(stderr, "Error: invalid size expression \"%s\".\n", curr);
+			n = 0;
+			break;
+		}
+		sizes[n++] = size;
+
+		curr = end? end + 1 : NULL;
+	}
+
+	xmlFree(content);
+
+	return n;
+}
+
+static bool parseVar(desc_t *desc, xmlNodePtr node, unsigned int kind, desc_var_t *var) {
+	char *type = getProp(node, "type");
+	char *epsilon;
+	xmlChar *content;
+	long long value;
+
+	var->kind = kind;
+	var->name = getProp(node, "name");
+	var->type = type? desc_getType(type) : NULL;
+	if(!var->type) {
+		fprintf(stderr, "Error: unknown or missing type \"%s\" on variable \"%s\".\n", type? type : "", var->name? var->name : "");
+		free(type);
+		return false;
+	}
+	free(type);
+
+	if(!getExprProp(desc, node, "nmemb", &(var->nmemb)) || !getUIntProp(node, "arg", &(var->arg))) {
+		fprintf(stderr, "Error: missing or invalid nmemb or arg on variable \"%s\".\n", var->name? var->name : "");
+		return false;
+	}
+
+	if(!var->name && kind != DESC_LOCAL) {
+		fprintf(stderr, "Error: missing name on argument %u.\n", var->arg);
+		return false;
+	}
+
+	/* Pointer-ness follows the declaration: arrays sized by an expression stay pointers even if it evaluates to 1 */
+	var->forcePointer = getBoolProp(node, "forcepointer") || !isLiteralProp(node, "nmemb");
+	var->noDownload = getBoolProp(node, "nodownload");
+	var->noValidation = (kind != DESC_OUTPUT) || var->noDownload || getBoolProp(node, "novalidation");
+	var->resident = getBoolProp(node, "resident");
+	var->noUpload = getBoolProp(node, "noupload");
+	var->swap = getProp(node, "swap");
+	if(var->swap)
+		var->resident = true;
+
+	/* Elements per work-group (work-item, without local size) of a variable partitioned when the kernel is split across devices */
+	if(xmlHasProp(node, (const xmlChar *) "split") && !getExprProp(desc, node, "split", &(var->split)))
+		return false;
+
+	epsilon = getProp(node, "epsilon");
+	var->hasEpsilon = epsilon;
+	if(epsilon) {
+		var->epsilon = strtod(epsilon, NULL);
+		free(epsilon);
+	}
+
+	/* Initial values that are integer expressions or real parameters are evaluated, anything else is kept as is */
+	content = xmlNodeGetContent(node);
+	if(content && strlen((const char *) content)) {
+		const desc_param_t *param = findParam(desc, (const char *) content, strlen((const char *) content));
+
+		if(evaluate(desc, (const char *) content, &value)) {
+			var->value = malloc(32);
+			snprintf(var->value, 32, "%lld", value);
+		}
+		else if(param && param->isReal) {
+			var->value = malloc(32);
+			snprintf(var->value, 32, "%.17g", param->real);
+		}
+		else {
+			var->value = strdup((const char *) content);
+		}
+	}
+	xmlFree(content);
+
+	return true;
+}
+
+static bool parseKernel(desc_t *desc, xmlNodePtr node, desc_kernel_t *kernel) {
+	xmlNodePtr child, range;
+	unsigned int n = 0;
+
+	kernel->name = getProp(node, "name");
+	if(!kernel->name) {
+		fprintf(stderr, "Error: missing kernel name.\n");
+		return false;
+	}
+	kernel->split = getBoolProp(node, "split");
+	kernel->tune = getBoolProp(node, "tune");
+	kernel->localMacro = getProp(node, "localmacro");
+
+	for(child = node->children; child; child = child->next) {
+		if(XML_ELEMENT_NODE != child->type)
+			continue;
+
+		if(!xmlStrcmp(child->name, (const xmlChar *) "input") || !xmlStrcmp(child->name, (const xmlChar *) "output") ||
+			!xmlStrcmp(child->name, (const xmlChar *) "local"))
+			kernel->varsLen++;
+	}
+	kernel->vars = calloc(kernel->varsLen, sizeof(desc_var_t));
+
+	for(child = node->children; child; child = child->next) {
+		if(XML_ELEMENT_NODE != child->type)
+			continue;
+
+		if(!xmlStrcmp(child->name, (const xmlChar *) "ndrange")) {
+			if(!getUIntProp(child, "dim", &(kernel->dim)) || kernel->dim < 1 || kernel->dim > DESC_MAX_DIMS) {
+				fprintf(stderr, "Error: invalid NDRange dimension on kernel \"%s\".\n", kernel->name);
+				return false;
+			}
+
+			for(range = child->children; range; range = range->next) {
+				if(XML_ELEMENT_NODE != range->type)
+					continue;
+
+				if(!xmlStrcmp(range->name, (const xmlChar *) "global")) {
+					if(parseSizes(desc, range, kernel->global) != kernel->dim) {
+						fprintf(stderr, "Error: global size does not match NDRange dimension on kernel \"%s\".\n", kernel->name);
+						return false;
+					}
+				}
+				else if(!xmlStrcmp(range->name, (const xmlChar *) "local")) {
+					if(parseSizes(desc, range, kernel->local) != kernel->dim) {
+						fprintf(stderr, "Error: local size does not match NDRange dimension on kernel \"%s\".\n", kernel->name);
+						return false;
+					}
+					kernel->hasLocal = true;
+				}
+			}
+		}
+		else if(!xmlStrcmp(child->name, (const xmlChar *) "input")) {
+			if(!parseVar(desc, child, DESC_INPUT, &(kernel->vars[n++])))
+				return false;
+		}
+		else if(!xmlStrcmp(child->name, (const xmlChar *) "output")) {
+			if(!parseVar(desc, child, DESC_OUTPUT, &(kernel->vars[n++])))
+				return false;
+		}
+		else if(!xmlStrcmp(child->name, (const xmlChar *) "local")) {
+			if(!parseVar(desc, child, DESC_LOCAL, &(kernel->vars[n++])))
+				return false;
+		}
+	}
+
+	if(!kernel->dim) {
+		fprintf(stderr, "Error: missing NDRange on kernel \"%s\".\n", kernel->name);
+		return false;
+	}
+
+	return true;
+}
+
+static bool parseParam(desc_t *desc, xmlNodePtr node, char **overrides, unsigned int overridesLen) {
+	desc_param_t *param = &(desc->params[desc->paramsLen]);
+	xmlChar *content = xmlNodeGetContent(node);
+	const char *value = (const char *) content;
+	unsigned int o;
+	bool valid;
+
+	param->name = getProp(node, "name");
+	if(!param->name) {
+		fprintf(stderr, "Error: missing parameter name.\n");
+		xmlFree(content);
+		return false;
+	}
+
+	/* Overrides have the form name=value */
+	for(o = 0; o < overridesLen; o++) {
+		size_t len = strcspn(overrides[o], "=");
+
+		if(overrides[o][len] && (strlen(param->name) == len) && !strncmp(overrides[o], param->name, len))
+			value = overrides[o] + len + 1;
+	}
+
+	/* Parameters that are not integer expressions may still be real numbers, which can only be used as initial values */
+	param->isReal = false;
+	valid = value && evaluate(desc, value, &(param->value));
+	if(!valid && value && strlen(value)) {
+		char *end;
+
+		param->real = strtod(value, &end);
+		param->isReal = valid = !(*end);
+	}
+	if(!valid)
+		fprintf(stderr, "Error: invalid value \"%s\" for parameter \"%s\".\n", value? value : "", param->name);
+	xmlFree(content);
+	desc->paramsLen++;
+
+	return valid;
+}
+
+desc_t *desc_parse(const char *fileName, char **overrides, unsigned int overridesLen) {
+	xmlDocPtr doc = NULL;
+	xmlNodePtr root, child;
+	desc_t *desc = NULL;
+	unsigned int n = 0, o;
+	bool success = false;
+
+	doc = xmlReadFile(fileName, NULL, XML_PARSE_NOBLANKS);
+	if(!doc) {
+		fprintf(stderr, "Error: could not parse \"%s\".\n", fileName);
+		goto _err;
+	}
+
+	root = xmlDocGetRootElement(doc);
+	if(!root || xmlStrcmp(root->name, (const xmlChar *) "kernels")) {
+		fprintf(stderr, "Error: \"%s\" has no kernels root node.\n", fileName);
+		goto _err;
+	}
+
+	desc = calloc(1, sizeof(desc_t));
+	desc->source = getProp(root, "source");
+	desc->binary = getProp(root, "binary");
+	if(!desc->source == !desc->binary) {
+		fprintf(stderr, "Error: exactly one of source or binary must be specified in \"%s\".\n", fileName);
+		goto _err;
+	}
+
+	for(child = root->children; child; child = child->next) {
+		if(XML_ELEMENT_NODE == child->type && !xmlStrcmp(child->name, (const xmlChar *) "kernel"))
+			desc->kernelsLen++;
+		else if(XML_ELEMENT_NODE == child->type && !xmlStrcmp(child->name, (const xmlChar *) "parameter"))
+			n++;
+	}
+	desc->kernels = calloc(desc->kernelsLen, sizeof(desc_kernel_t));
+	desc->params = calloc(n, sizeof(desc_param_t));
+
+	/* Parameters are evaluated in order, before any kernel */
+	for(child = root->children; child; child = child->next) {
+		if(XML_ELEMENT_NODE == child->type && !xmlStrcmp(child->name, (const xmlChar *) "parameter")) {
+			if(!parseParam(desc, child, overrides, overridesLen))
+				goto _err;
+		}
+	}
+
+	for(o = 0; o < overridesLen; o++) {
+		if(!findParam(desc, overrides[o], strcspn(overrides[o], "="))) {
+			fprintf(stderr, "Error: unknown parameter \"%s\".\n", overrides[o]);
+			goto _err;
+		}
+	}
+
+	/* Items processed per iteration (e.g. queries), used to report throughput */
+	desc->itemsUnit = getProp(root, "itemsunit");
+	if(xmlHasProp(root, (const xmlChar *) "items") && !getExprProp(desc, root, "items", &(desc->items)))
+		goto _err;
+
+	/* Bytes accessed and floating-point operations per iteration, and peak bandwidth of the device (GB/s) */
+	if(xmlHasProp(root, (const xmlChar *) "bytes") && !getLongExprProp(desc, root, "bytes", &(desc->bytes)))
+		goto _err;
+	if(xmlHasProp(root, (const xmlChar *) "flops") && !getLongExprProp(desc, root, "flops", &(desc->flops)))
+		goto _err;
+	if(xmlHasProp(root, (const xmlChar *) "peakbandwidth") && !getRealProp(desc, root, "peakbandwidth", &(desc->peakBandwidth)))
+		goto _err;
+
+	n = 0;
+	for(child = root->children; child; child = child->next) {
+		if(XML_ELEMENT_NODE == child->type && !xmlStrcmp(child->name, (const xmlChar *) "kernel")) {
+			if(!parseKernel(desc, child, &(desc->kernels[n++])))
+				goto _err;
+		}
+	}
+
+	success = true;
+
+_err:
+	if(doc)
+		xmlFreeDoc(doc);
+	xmlCleanupParser();
+
+	if(!success)
+		desc_destroy(&desc);
+
+	return desc;
+}
+
+void desc_destroy(desc_t **desc) {
+	unsigned int k, v, p;
+
+	if(!(*desc))
+		return;
+
+	for(k = 0; k < (*desc)->kernelsLen; k++) {
+		for(v = 0; v < (*desc)->kernels[k].varsLen; v++) {
+			free((*desc)->kernels[k].vars[v].name);
+			free((*desc)->kernels[k].vars[v].value);
+			free((*desc)->kernels[k].vars[v].swap);
+		}
+		free((*desc)->kernels[k].vars);
+		free((*desc)->kernels[k].name);
+		free((*desc)->kernels[k].localMacro);
+	}
+	free((*desc)->kernels);
+	for(p = 0; p < (*desc)->paramsLen; p++)
+		free((*desc)->params[p].name);
+	free((*desc)->params);
+	free((*desc)->source);
+	free((*desc)->binary);
+	free((*desc)->itemsUnit);
+	free(*desc);
+	*desc = NULL;
+}
+
+const desc_type_t *desc_getType(const char *name) {
+	unsigned int t;
+
+	for(t = 0; types[t].name; t++) {
+		if(!strcmp(types[t].name, name))
+			return &types[t];
+	}
+
+	return NULL;
+}
+
+bool desc_isPointer(desc_var_t *var) {
+	return (var->nmemb > 1) || var->forcePointer;
+}
+
+bool desc_hasBuffer(desc_var_t *var) {
+	return (var->kind != DESC_LOCAL) && (desc_isPointer(var) || (DESC_OUTPUT == var->kind));
+}
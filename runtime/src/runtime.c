@@ -0,0 +1,1825 @@
+/* ********************************************************************************************* */
+/* * Shared Runtime for Kernel Execution                                                       * */
+/* * Author: André Bannwart Perina                                                             * */
+/* ********************************************************************************************* */
+/* * Copyright (c) 2018 André B. Perina                                                        * */
+/* *                                                                                           * */
+/* * Permission is hereby granted, free of charge, to any person obtaining a copy of this      * */
+/* * software and associated documentation files (the "Software"), to deal in the Software     * */
+/* * without restriction, including without limitation the rights to use, copy, modify,        * */
+/* * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to        * */
+/* * permit persons to whom the Software is furnished to do so, subject to the following       * */
+/* * conditions:                                                                               * */
+/* *                                                                                           * */
+/* * The above copyright notice and this permission notice shall be included in all copies     * */
+/* * or substantial portions of the Software.                                                  * */
+/* *                                                                                           * */
+/* * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,       * */
+/* * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR  * */
+/* * PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE * */
+/* * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      * */
+/* * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER    * */
+/* * DEALINGS IN THE SOFTWARE.                                                                 * */
+/* ********************************************************************************************* */
+
+#include <CL/opencl.h>
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/* common.h is the one of the project being built (-Iinclude), so that the runtime uses the same macros as the hooks */
+#include "common.h"
+#include "description.h"
+#include "runtime.h"
+
+/**
+ * @brief Test if two operands are outside an epsilon range.
+ *
+ * @param a First operand.
+ * @param b Second operand.
+ * @param e Epsilon value.
+ */
+#define TEST_EPSILON(a, b, e) (((a > b) && (a - b > e)) || ((b >= a) && (b - a > e)))
+
+/**
+ * @brief Standard statements for function error handling and printing.
+ *
+ * @param funcName Function name that failed.
+ */
+#define FUNCTION_ERROR_STATEMENTS(funcName) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s failed with return code %d.\n", funcName, fRet);\
+}
+
+/**
+ * @brief Standard statements for POSIX error handling and printing.
+ *
+ * @param arg Arbitrary string to the printed at the end of error string.
+ */
+#define POSIX_ERROR_STATEMENTS(arg) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: %s: %s\n", strerror(errno), arg);\
+}
+
+/**
+ * @brief Standard statements for description error handling and printing.
+ *
+ * @param ... Standard arguments for printf.
+ */
+#define DESCRIPTION_ERROR_STATEMENTS(...) {\
+	rv = EXIT_FAILURE;\
+	PRINT_FAIL();\
+	fprintf(stderr, "Error: " __VA_ARGS__);\
+}
+
+#ifdef RT_PINNED_BUFFERS
+/**
+ * @brief Pinned buffers mode: host memory of pointer variables is allocated by OpenCL (CL_MEM_ALLOC_HOST_PTR) and
+ *        accessed through mapping. Unmapping replaces buffer writes and mapping replaces buffer reads.
+ */
+#define PINNED_BUFFERS true
+#define PINNED_MEM_FLAGS CL_MEM_ALLOC_HOST_PTR
+#else
+#define PINNED_BUFFERS false
+#define PINNED_MEM_FLAGS 0
+#endif
+
+#if defined(RT_PINNED_BUFFERS) && defined(RT_MULTI_DEVICE)
+#error "Pinned buffers and multi-device splitting can't be used together"
+#endif
+
+typedef struct rt_var_t {
+	desc_var_t *desc;
+	rt_binding_t *binding;
+	void *host;
+	void *hostC;
+	cl_mem buffer;
+	cl_mem mapped;
+	bool owner;
+	bool sliced;
+	struct rt_var_t *swap;
+} rt_var_t;
+
+/**
+ * @brief Benchmark state of a kernel. Backups are indexed as the kernel variables and samples are in us.
+ */
+typedef struct {
+	cl_mem *backups;
+	double *samples;
+	unsigned int samplesLen;
+	unsigned int samplesCap;
+	unsigned int warmups;
+} rt_bench_t;
+
+typedef struct {
+	desc_kernel_t *desc;
+	cl_kernel kernel;
+	rt_var_t *vars;
+	rt_bench_t bench;
+	cl_program program;
+	size_t tuneGlobal[DESC_MAX_DIMS];
+	bool tuned;
+} rt_kernel_t;
+
+#ifdef RT_MULTI_DEVICE
+/**
+ * @brief Device executing a partition of the NDRange. The first device uses the main queue and kernel.
+ *        Sub-buffers are indexed as the kernel variables and only exist for partitioned variables.
+ */
+typedef struct {
+	cl_command_queue queue;
+	cl_kernel kernel;
+	cl_mem *subBuffers;
+} rt_helper_t;
+
+static bool isSplittable(desc_t *desc) {
+	unsigned int v;
+
+	/* Devices only write to their own partition, so every output must be partitioned */
+	if(!desc->source || (desc->kernelsLen != 1) || !desc->kernels[0].split)
+		return false;
+	for(v = 0; v < desc->kernels[0].varsLen; v++) {
+		desc_var_t *var = &(desc->kernels[0].vars[v]);
+
+		if(((DESC_OUTPUT == var->kind) && !var->split) || (var->split && (!desc_hasBuffer(var) || var->swap)))
+			return false;
+	}
+
+	return true;
+}
+
+static size_t gcd(size_t a, size_t b) {
+	while(b) {
+		size_t t = a % b;
+
+		a = b;
+		b = t;
+	}
+
+	return a;
+}
+
+static size_t partitionStep(desc_kernel_t *kernel, size_t align) {
+	unsigned int v;
+	size_t step = 1;
+
+	/* Smallest number of work-groups after which every partitioned variable is aligned as required for sub-buffer origins */
+	for(v = 0; v < kernel->varsLen; v++) {
+		size_t bytes = kernel->vars[v].split * kernel->vars[v].type->size;
+		size_t groups;
+
+		if(!bytes)
+			continue;
+		groups = align / gcd(align, bytes);
+		step = (step / gcd(step, groups)) * groups;
+	}
+
+	return step;
+}
+
+static size_t dataUnits(desc_kernel_t *kernel) {
+	unsigned int v;
+	size_t units = kernel->global[0] / (kernel->hasLocal? kernel->local[0] : 1);
+
+	/* Work-groups past the end of a partitioned variable (NDRange padding) hold no data */
+	for(v = 0; v < kernel->varsLen; v++) {
+		size_t varUnits = kernel->vars[v].split? (kernel->vars[v].nmemb + kernel->vars[v].split - 1) / kernel->vars[v].split : units;
+
+		if(varUnits < units)
+			units = varUnits;
+	}
+
+	return units;
+}
+
+static void partition(desc_kernel_t *kernel, double *weights, unsigned int devicesLen, size_t step, size_t *offsets, size_t *sizes) {
+	unsigned int d;
+	size_t granularity = kernel->hasLocal? kernel->local[0] : 1;
+	size_t groups = kernel->global[0] / granularity;
+	size_t units = dataUnits(kernel);
+	size_t acc = 0;
+	double total = 0;
+
+	for(d = 0; d < devicesLen; d++)
+		total += weights[d];
+
+	/* Every device receives at least one step of work-groups holding data, the last one also receives the padding */
+	for(d = 0; d < devicesLen; d++) {
+		size_t left = units - acc - (devicesLen - d - 1) * step;
+		size_t share = (size_t) (units * weights[d] / (total * step) + 0.5) * step;
+
+		if(share < step)
+			share = step;
+		if(share > left)
+			share = left;
+		if(d == devicesLen - 1)
+			share = groups - acc;
+
+		offsets[d] = acc * granularity;
+		sizes[d] = share * granularity;
+		acc += share;
+	}
+}
+
+static void sliceRange(desc_kernel_t *kernel, desc_var_t *var, size_t offset, size_t size, bool last, cl_buffer_region *region) {
+	size_t granularity = kernel->hasLocal? kernel->local[0] : 1;
+	size_t first = (offset / granularity) * var->split;
+	size_t end = last? var->nmemb : first + (size / granularity) * var->split;
+
+	if(end > var->nmemb)
+		end = var->nmemb;
+
+	region->origin = first * var->type->size;
+	region->size = (end - first) * var->type->size;
+}
+
+static cl_int splitVars(rt_helper_t *helpers, unsigned int devicesLen, rt_kernel_t *kernel, size_t *offsets, size_t *sizes, const char **funcName) {
+	unsigned int d, v;
+	cl_int fRet = CL_SUCCESS;
+
+	/* Partitions change every iteration, and so do the sub-buffers and the slices uploaded to each device */
+	for(d = 0; d < devicesLen; d++) {
+		for(v = 0; (CL_SUCCESS == fRet) && (v < kernel->desc->varsLen); v++) {
+			rt_var_t *var = &(kernel->vars[v]);
+			cl_buffer_region region;
+
+			if(var->sliced) {
+				if(helpers[d].subBuffers[v])
+					clReleaseMemObject(helpers[d].subBuffers[v]);
+
+				*funcName = "clCreateSubBuffer";
+				sliceRange(kernel->desc, var->desc, offsets[d], sizes[d], d == devicesLen - 1, &region);
+				helpers[d].subBuffers[v] = clCreateSubBuffer(var->buffer, (DESC_INPUT == var->desc->kind)? CL_MEM_READ_ONLY : CL_MEM_READ_WRITE,
+					CL_BUFFER_CREATE_TYPE_REGION, &region, &fRet);
+				if(CL_SUCCESS != fRet)
+					break;
+
+				*funcName = "clSetKernelArg";
+				fRet = clSetKernelArg(helpers[d].kernel, var->desc->arg, sizeof(cl_mem), &(helpers[d].subBuffers[v]));
+				if((CL_SUCCESS == fRet) && !var->desc->resident && !var->desc->noUpload) {
+					*funcName = "clEnqueueWriteBuffer";
+					fRet = clEnqueueWriteBuffer(helpers[d].queue, helpers[d].subBuffers[v], CL_FALSE, 0, region.size, ((char *) var->host) + region.origin,
+						0, NULL, NULL);
+				}
+			}
+			else if(d && (DESC_LOCAL != var->desc->kind) && !desc_hasBuffer(var->desc)) {
+				/* Values may be changed by the hooks every iteration */
+				*funcName = "clSetKernelArg";
+				fRet = clSetKernelArg(helpers[d].kernel, var->desc->arg, var->desc->type->size, var->host);
+			}
+		}
+	}
+
+	/* Slices are uploaded in parallel, but before the kernels are timed */
+	*funcName = "clFinish";
+	for(d = 0; (CL_SUCCESS == fRet) && (d < devicesLen); d++)
+		fRet = clFinish(helpers[d].queue);
+
+	return fRet;
+}
+
+static cl_int gatherVars(rt_helper_t *helpers, unsigned int devicesLen, rt_kernel_t *kernel, size_t *offsets, size_t *sizes) {
+	unsigned int d, v;
+	cl_int fRet = CL_SUCCESS;
+
+	/* Each device only sends back its own slice of the outputs */
+	for(d = 0; d < devicesLen; d++) {
+		for(v = 0; (CL_SUCCESS == fRet) && (v < kernel->desc->varsLen); v++) {
+			rt_var_t *var = &(kernel->vars[v]);
+			cl_buffer_region region;
+
+			if(!var->sliced || (var->desc->kind != DESC_OUTPUT) || var->desc->resident || var->desc->noDownload)
+				continue;
+
+			sliceRange(kernel->desc, var->desc, offsets[d], sizes[d], d == devicesLen - 1, &region);
+			fRet = clEnqueueReadBuffer(helpers[d].queue, helpers[d].subBuffers[v], CL_FALSE, 0, region.size, ((char *) var->host) + region.origin,
+				0, NULL, NULL);
+		}
+	}
+
+	for(d = 0; (CL_SUCCESS == fRet) && (d < devicesLen); d++)
+		fRet = clFinish(helpers[d].queue);
+
+	return fRet;
+}
+
+static cl_int measureDevices(cl_event *events, unsigned int devicesLen, double *times) {
+	unsigned int d;
+	cl_ulong start, end;
+	cl_int fRet = clWaitForEvents(devicesLen, events);
+
+	/* Throughput of each device is measured by the execution time of its partition */
+	for(d = 0; (CL_SUCCESS == fRet) && (d < devicesLen); d++) {
+		fRet = clGetEventProfilingInfo(events[d], CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, NULL);
+		if(CL_SUCCESS == fRet)
+			fRet = clGetEventProfilingInfo(events[d], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, NULL);
+		if(CL_SUCCESS == fRet)
+			times[d] = (end - start) / 1000.0;
+	}
+
+	return fRet;
+}
+
+static void loadCalibration(cl_device_id *devices, unsigned int devicesLen, double *weights) {
+	unsigned int d;
+	char name[256], line[512];
+	bool valid = true;
+	FILE *calFile = fopen(RT_CALIBRATION_FILE, "r");
+
+	for(d = 0; d < devicesLen; d++) {
+		char *sep;
+
+		clGetDeviceInfo(devices[d], CL_DEVICE_NAME, sizeof(name), name, NULL);
+		valid = valid && calFile && fgets(line, sizeof(line), calFile) && (sep = strchr(line, '\t'));
+		if(valid) {
+			line[strcspn(line, "\n")] = '\0';
+			weights[d] = strtod(line, NULL);
+			valid = !strcmp(sep + 1, name) && (weights[d] > 0);
+		}
+	}
+
+	/* Without a matching calibration, work is split evenly */
+	if(!valid) {
+		for(d = 0; d < devicesLen; d++)
+			weights[d] = 1;
+	}
+
+	if(calFile)
+		fclose(calFile);
+}
+
+static void storeCalibration(cl_device_id *devices, unsigned int devicesLen, double *weights) {
+	unsigned int d;
+	char name[256];
+	FILE *calFile = fopen(RT_CALIBRATION_FILE, "w");
+
+	if(!calFile)
+		return;
+
+	for(d = 0; d < devicesLen; d++) {
+		clGetDeviceInfo(devices[d], CL_DEVICE_NAME, sizeof(name), name, NULL);
+		fprintf(calFile, "%.9g\t%s\n", weights[d], name);
+	}
+
+	fclose(calFile);
+}
+#endif
+
+static cl_mem currentBuffer(rt_var_t *var, int i) {
+	return (var->swap && (i % 2))? var->swap->buffer : var->buffer;
+}
+
+static int compareSamples(const void *a, const void *b) {
+	double x = *((const double *) a);
+	double y = *((const double *) b);
+
+	return (x > y) - (x < y);
+}
+
+static void sampleStats(rt_bench_t *bench, double *mean, double *stdDev, double *halfWidth) {
+	unsigned int s, n = bench->samplesLen;
+	double z = 1.959964, df = n - 1;
+
+	*mean = 0;
+	for(s = 0; s < n; s++)
+		*mean += bench->samples[s];
+	*mean /= n;
+
+	*stdDev = 0;
+	for(s = 0; s < n; s++)
+		*stdDev += (bench->samples[s] - *mean) * (bench->samples[s] - *mean);
+	*stdDev = (n > 1)? sqrt(*stdDev / df) : 0;
+
+	/* Student's t quantile approximated by its first order expansion around the normal quantile */
+	*halfWidth = (n > 1)? (z + (z * z * z + z) / (4 * df)) * *stdDev / sqrt(n) : INFINITY;
+}
+
+static bool isConverged(rt_bench_t *bench, double error) {
+	double mean, stdDev, halfWidth;
+
+	if(bench->samplesLen < RT_BENCH_MIN_SAMPLES)
+		return false;
+
+	sampleStats(bench, &mean, &stdDev, &halfWidth);
+	return halfWidth <= error * mean;
+}
+
+static cl_int copyVars(cl_command_queue queue, rt_kernel_t *kernel, int i, bool restore) {
+	unsigned int v;
+	cl_int fRet = CL_SUCCESS;
+
+	for(v = 0; (CL_SUCCESS == fRet) && (v < kernel->desc->varsLen); v++) {
+		rt_var_t *var = &(kernel->vars[v]);
+		cl_mem buffer = currentBuffer(var, i);
+
+		if(kernel->bench.backups[v]) {
+			fRet = clEnqueueCopyBuffer(queue, restore? kernel->bench.backups[v] : buffer, restore? buffer : kernel->bench.backups[v],
+				0, 0, var->desc->nmemb * var->desc->type->size, 0, NULL, NULL);
+		}
+	}
+
+	return fRet;
+}
+
+static cl_int createBackups(cl_context context, rt_kernel_t *kernel) {
+	unsigned int v;
+	cl_int fRet = CL_SUCCESS;
+
+	if(kernel->bench.backups)
+		return CL_SUCCESS;
+
+	/* Buffers written by the kernel are backed up on device, so that every launch starts from the same state */
+	kernel->bench.backups = calloc(kernel->desc->varsLen, sizeof(cl_mem));
+	for(v = 0; (CL_SUCCESS == fRet) && (v < kernel->desc->varsLen); v++) {
+		rt_var_t *var = &(kernel->vars[v]);
+
+		if(desc_hasBuffer(var->desc) && ((DESC_OUTPUT == var->desc->kind) || var->swap))
+			kernel->bench.backups[v] = clCreateBuffer(context, CL_MEM_READ_WRITE, var->desc->nmemb * var->desc->type->size, NULL, &fRet);
+	}
+
+	return fRet;
+}
+
+static cl_int benchmarkKernel(cl_context context, cl_command_queue queue, rt_kernel_t *kernel, int i, unsigned int warmup, unsigned int maxSamples,
+		double error, const char **funcName) {
+	rt_bench_t *bench = &(kernel->bench);
+	unsigned int n = 0;
+	cl_int fRet = CL_SUCCESS;
+	cl_event event;
+	cl_ulong start, end;
+
+	*funcName = "clCreateBuffer";
+	fRet = createBackups(context, kernel);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+
+	*funcName = "clEnqueueCopyBuffer";
+	fRet = copyVars(queue, kernel, i, false);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+
+	/* Every launch takes at least one sample, more until the confidence interval is tight enough */
+	while((bench->warmups < warmup) || !n || ((bench->samplesLen < maxSamples) && !isConverged(bench, error))) {
+		*funcName = "clEnqueueCopyBuffer";
+		fRet = copyVars(queue, kernel, i, true);
+		if(CL_SUCCESS != fRet)
+			return fRet;
+
+		*funcName = "clEnqueueNDRangeKernel";
+		fRet = clEnqueueNDRangeKernel(queue, kernel->kernel, kernel->desc->dim, NULL, kernel->desc->global, kernel->desc->hasLocal? kernel->desc->local : NULL,
+			0, NULL, &event);
+		if(CL_SUCCESS != fRet)
+			return fRet;
+
+		*funcName = "clWaitForEvents";
+		fRet = clWaitForEvents(1, &event);
+		if(CL_SUCCESS == fRet) {
+			*funcName = "clGetEventProfilingInfo";
+			fRet = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, NULL);
+		}
+		if(CL_SUCCESS == fRet)
+			fRet = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, NULL);
+		clReleaseEvent(event);
+		if(CL_SUCCESS != fRet)
+			return fRet;
+
+		if(bench->warmups < warmup) {
+			bench->warmups++;
+			continue;
+		}
+
+		if(bench->samplesLen == bench->samplesCap) {
+			bench->samplesCap = bench->samplesCap? 2 * bench->samplesCap : 64;
+			bench->samples = realloc(bench->samples, bench->samplesCap * sizeof(double));
+			*funcName = "realloc";
+			if(!bench->samples)
+				return CL_OUT_OF_HOST_MEMORY;
+		}
+		bench->samples[bench->samplesLen++] = (end - start) / 1000.0;
+		n++;
+	}
+
+	/* Leave buffers as they were, the actual launch comes next */
+	*funcName = "clEnqueueCopyBuffer";
+	fRet = copyVars(queue, kernel, i, true);
+	if(CL_SUCCESS == fRet)
+		fRet = clFinish(queue);
+
+	return fRet;
+}
+
+static void getLocalMacros(desc_t *desc, desc_kernel_t *tuned, const size_t *tunedLocal, char *options) {
+	unsigned int k, d;
+	size_t len = 0;
+
+	/* Kernels exposing their local size through macros (e.g. for reqd_work_group_size) receive it as NAME_0, NAME_1, NAME_2 */
+	options[0] = '\0';
+	for(k = 0; k < desc->kernelsLen; k++) {
+		desc_kernel_t *kernel = &(desc->kernels[k]);
+
+		if(!kernel->localMacro)
+			continue;
+
+		for(d = 0; (d < DESC_MAX_DIMS) && (len < RT_MAX_OPTIONS); d++) {
+			size_t local = (d >= kernel->dim)? 1 : ((kernel == tuned)? tunedLocal[d] : (kernel->hasLocal? kernel->local[d] : 1));
+
+			len += snprintf(options + len, RT_MAX_OPTIONS - len, "%s-D%s_%u=%lu", len? " " : "", kernel->localMacro, d, (unsigned long) local);
+		}
+	}
+}
+
+static void formatSizes(const size_t *sizes, unsigned int dim, char *str, size_t len) {
+	unsigned int d;
+	size_t pos = 0;
+
+	for(d = 0; (d < dim) && (pos < len); d++)
+		pos += snprintf(str + pos, len - pos, d? ",%lu" : "%lu", (unsigned long) sizes[d]);
+}
+
+static bool loadTuning(cl_device_id device, rt_kernel_t *kernel) {
+	char name[256], global[64], line[512], key[512];
+	size_t local[DESC_MAX_DIMS];
+	unsigned int d;
+	bool found = false;
+	FILE *tuneFile = fopen(RT_TUNING_FILE, "r");
+
+	if(!tuneFile)
+		return false;
+
+	/* Entries are "device\tkernel\tglobal\tlocal", global and local comma-separated */
+	clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(name), name, NULL);
+	formatSizes(kernel->tuneGlobal, kernel->desc->dim, global, sizeof(global));
+	snprintf(key, sizeof(key), "%s\t%s\t%s\t", name, kernel->desc->name, global);
+	while(!found && fgets(line, sizeof(line), tuneFile)) {
+		char *curr = line + strlen(key);
+
+		if(strncmp(line, key, strlen(key)))
+			continue;
+
+		for(d = 0; d < kernel->desc->dim; d++) {
+			local[d] = strtoul(curr, &curr, 10);
+			if(!local[d] || (kernel->desc->global[d] % local[d]))
+				break;
+			curr += (',' == *curr);
+		}
+
+		found = (d == kernel->desc->dim);
+	}
+	fclose(tuneFile);
+
+	if(found) {
+		memcpy(kernel->desc->local, local, sizeof(local));
+		kernel->desc->hasLocal = true;
+	}
+
+	return found;
+}
+
+static void storeTuning(cl_device_id device, rt_kernel_t *kernel) {
+	char name[256], global[64], local[64], line[512], key[512];
+	char tmpPath[] = RT_TUNING_FILE ".tmp";
+	FILE *tuneFile = fopen(RT_TUNING_FILE, "r");
+	FILE *tmpFile = fopen(tmpPath, "w");
+
+	if(!tmpFile) {
+		if(tuneFile)
+			fclose(tuneFile);
+		return;
+	}
+
+	clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(name), name, NULL);
+	formatSizes(kernel->tuneGlobal, kernel->desc->dim, global, sizeof(global));
+	formatSizes(kernel->desc->local, kernel->desc->dim, local, sizeof(local));
+	snprintf(key, sizeof(key), "%s\t%s\t%s\t", name, kernel->desc->name, global);
+
+	/* Other entries are kept, the one of this device, kernel and global size is replaced */
+	while(tuneFile && fgets(line, sizeof(line), tuneFile)) {
+		if(strncmp(line, key, strlen(key)))
+			fputs(line, tmpFile);
+	}
+	fprintf(tmpFile, "%s%s\n", key, local);
+
+	if(tuneFile)
+		fclose(tuneFile);
+	if(fclose(tmpFile) || rename(tmpPath, RT_TUNING_FILE))
+		remove(tmpPath);
+}
+
+static cl_int setKernelArgs(cl_kernel clKernel, rt_kernel_t *kernel, int i) {
+	unsigned int v;
+	cl_int fRet = CL_SUCCESS;
+
+	for(v = 0; (CL_SUCCESS == fRet) && (v < kernel->desc->varsLen); v++) {
+		rt_var_t *var = &(kernel->vars[v]);
+		cl_mem buffer = currentBuffer(var, i);
+
+		if(DESC_LOCAL == var->desc->kind)
+			fRet = clSetKernelArg(clKernel, var->desc->arg, var->desc->nmemb * var->desc->type->size, NULL);
+		else if(desc_hasBuffer(var->desc))
+			fRet = clSetKernelArg(clKernel, var->desc->arg, sizeof(cl_mem), &buffer);
+		else
+			fRet = clSetKernelArg(clKernel, var->desc->arg, var->desc->type->size, var->host);
+	}
+
+	return fRet;
+}
+
+static bool nextCandidate(desc_kernel_t *desc, const size_t *maxItems, size_t *candidate) {
+	unsigned int d;
+
+	/* Candidates are all combinations of powers of two dividing the global size of each dimension */
+	for(d = 0; d < desc->dim; d++) {
+		if((2 * candidate[d] <= maxItems[d]) && !(desc->global[d] % (2 * candidate[d]))) {
+			candidate[d] *= 2;
+			return true;
+		}
+		candidate[d] = 1;
+	}
+
+	return false;
+}
+
+static cl_int timeCandidate(cl_command_queue queue, rt_kernel_t *kernel, cl_kernel clKernel, const size_t *local, int i, double *time) {
+	unsigned int r;
+	cl_int fRet = CL_SUCCESS;
+	cl_event event;
+	cl_ulong start, end;
+
+	/* Best of a few launches, all starting from the same state */
+	*time = INFINITY;
+	for(r = 0; (CL_SUCCESS == fRet) && (r < RT_TUNE_REPETITIONS); r++) {
+		fRet = copyVars(queue, kernel, i, true);
+		if(CL_SUCCESS == fRet)
+			fRet = clEnqueueNDRangeKernel(queue, clKernel, kernel->desc->dim, NULL, kernel->desc->global, local, 0, NULL, &event);
+		if(CL_SUCCESS != fRet)
+			break;
+
+		fRet = clWaitForEvents(1, &event);
+		if(CL_SUCCESS == fRet)
+			fRet = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, NULL);
+		if(CL_SUCCESS == fRet)
+			fRet = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, NULL);
+		clReleaseEvent(event);
+
+		if((CL_SUCCESS == fRet) && ((end - start) / 1000.0 < *time))
+			*time = (end - start) / 1000.0;
+	}
+
+	return fRet;
+}
+
+static cl_int tuneKernel(cl_context context, cl_device_id device, cl_command_queue queue, desc_t *desc, rt_kernel_t *kernel, int i,
+		const char *source, size_t sourceSz, const char **funcName) {
+	size_t maxItems[3], maxGroup, kernelGroup, compileGroup[3];
+	size_t candidate[DESC_MAX_DIMS] = {1, 1, 1};
+	size_t best[DESC_MAX_DIMS];
+	size_t group;
+	unsigned int d;
+	char options[RT_MAX_OPTIONS];
+	char sizes[64];
+	bool rebuild = kernel->desc->localMacro && source;
+	double time, bestTime = INFINITY;
+	cl_program program, bestProgram = NULL;
+	cl_kernel clKernel, bestKernel = NULL;
+	cl_int fRet;
+
+	*funcName = "clGetDeviceInfo";
+	fRet = clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_ITEM_SIZES, sizeof(maxItems), maxItems, NULL);
+	if(CL_SUCCESS == fRet)
+		fRet = clGetDeviceInfo(device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size_t), &maxGroup, NULL);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+
+	/* A fixed reqd_work_group_size leaves nothing to tune */
+	*funcName = "clGetKernelWorkGroupInfo";
+	fRet = clGetKernelWorkGroupInfo(kernel->kernel, device, CL_KERNEL_COMPILE_WORK_GROUP_SIZE, sizeof(compileGroup), compileGroup, NULL);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+	if(!rebuild && compileGroup[0]) {
+		printf("Kernel \"%s\" has a fixed required work-group size, skipping tuning.\n", kernel->desc->name);
+		return CL_SUCCESS;
+	}
+
+	*funcName = "clCreateBuffer";
+	fRet = createBackups(context, kernel);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+	*funcName = "clEnqueueCopyBuffer";
+	fRet = copyVars(queue, kernel, i, false);
+	if(CL_SUCCESS != fRet)
+		return fRet;
+
+	do {
+		for(group = 1, d = 0; d < kernel->desc->dim; d++)
+			group *= candidate[d];
+		if(group > maxGroup)
+			continue;
+
+		/* Kernels exposing local size macros are rebuilt for every candidate */
+		program = NULL;
+		clKernel = kernel->kernel;
+		if(rebuild) {
+			getLocalMacros(desc, kernel->desc, candidate, options);
+			program = clCreateProgramWithSource(context, 1, &source, &sourceSz, &fRet);
+			if((CL_SUCCESS != fRet) || (CL_SUCCESS != clBuildProgram(program, 1, &device, options, NULL, NULL))) {
+				if(program)
+					clReleaseProgram(program);
+				continue;
+			}
+
+			clKernel = clCreateKernel(program, kernel->desc->name, &fRet);
+			if((CL_SUCCESS != fRet) || (CL_SUCCESS != setKernelArgs(clKernel, kernel, i))) {
+				if(CL_SUCCESS == fRet)
+					clReleaseKernel(clKernel);
+				clReleaseProgram(program);
+				continue;
+			}
+		}
+
+		/* Candidates the kernel can't be launched with are skipped */
+		fRet = clGetKernelWorkGroupInfo(clKernel, device, CL_KERNEL_WORK_GROUP_SIZE, sizeof(size_t), &kernelGroup, NULL);
+		if((CL_SUCCESS == fRet) && (group <= kernelGroup))
+			fRet = timeCandidate(queue, kernel, clKernel, candidate, i, &time);
+
+		formatSizes(candidate, kernel->desc->dim, sizes, sizeof(sizes));
+		if((CL_SUCCESS == fRet) && (group <= kernelGroup)) {
+			printf("Tuning kernel \"%s\": local size %s took %lf us.\n", kernel->desc->name, sizes, time);
+
+			if(time < bestTime) {
+				bestTime = time;
+				memcpy(best, candidate, sizeof(best));
+				if(bestProgram) {
+					clReleaseKernel(bestKernel);
+					clReleaseProgram(bestProgram);
+				}
+				bestProgram = program;
+				bestKernel = clKernel;
+				continue;
+			}
+		}
+
+		if(program) {
+			clReleaseKernel(clKernel);
+			clReleaseProgram(program);
+		}
+	} while(nextCandidate(kernel->desc, maxItems, candidate));
+
+	/* Leave buffers as they were, the actual launch comes next */
+	*funcName = "clEnqueueCopyBuffer";
+	fRet = copyVars(queue, kernel, i, true);
+	if(CL_SUCCESS == fRet)
+		fRet = clFinish(queue);
+
+	if(isinf(bestTime)) {
+		printf("No valid local size found for kernel \"%s\".\n", kernel->desc->name);
+		return fRet;
+	}
+
+	memcpy(kernel->desc->local, best, sizeof(best));
+	kernel->desc->hasLocal = true;
+	if(bestProgram) {
+		clReleaseKernel(kernel->kernel);
+		if(kernel->program)
+			clReleaseProgram(kernel->program);
+		kernel->kernel = bestKernel;
+		kernel->program = bestProgram;
+	}
+
+	formatSizes(best, kernel->desc->dim, sizes, sizeof(sizes));
+	printf("Tuned kernel \"%s\": local size %s (%lf us).\n", kernel->desc->name, sizes, bestTime);
+	storeTuning(device, kernel);
+
+	return fRet;
+}
+
+static void reportBenchmark(rt_kernel_t *kernel) {
+	rt_bench_t *bench = &(kernel->bench);
+	unsigned int n = bench->samplesLen;
+	double mean, stdDev, halfWidth;
+	double *sorted = malloc(n * sizeof(double));
+
+	if(!sorted)
+		return;
+
+	/* Percentiles use the nearest-rank method */
+	memcpy(sorted, bench->samples, n * sizeof(double));
+	qsort(sorted, n, sizeof(double), compareSamples);
+	sampleStats(bench, &mean, &stdDev, &halfWidth);
+
+	printf("Benchmark of kernel \"%s\": %u samples after %u warmup launches; min: %lf us; median: %lf us; p95: %lf us; p99: %lf us; "
+		"standard deviation: %lf us; CV: %lf%%; 95%% CI: +/- %lf%%.\n", kernel->desc->name, n, bench->warmups,
+		sorted[0], sorted[(n - 1) / 2], sorted[(unsigned int) ceil(0.95 * n) - 1], sorted[(unsigned int) ceil(0.99 * n) - 1],
+		stdDev, 100 * stdDev / mean, (n > 1)? 100 * halfWidth / mean : 0);
+
+	free(sorted);
+}
+
+/**
+ * @brief Kernel description being executed, whose parameters are exposed to the hooks by rt_getParam.
+ */
+static desc_t *currentDesc = NULL;
+
+long long rt_getParam(const char *name, long long def) {
+	unsigned int p;
+
+	for(p = 0; currentDesc && (p < currentDesc->paramsLen); p++) {
+		if(!strcmp(currentDesc->params[p].name, name))
+			return currentDesc->params[p].value;
+	}
+
+	return def;
+}
+
+/**
+ * @brief Items processed by the current iteration as set by the hooks through rt_setItems, negative for the items of the description.
+ */
+static long long iterationItems = -1;
+
+void rt_setItems(unsigned int items) {
+	iterationItems = items;
+}
+
+static rt_binding_t *findBinding(const char *name) {
+	unsigned int b;
+
+	for(b = 0; rtBindings[b].name; b++) {
+		if(!strcmp(rtBindings[b].name, name))
+			return &rtBindings[b];
+	}
+
+	return NULL;
+}
+
+static bool isPinned(rt_var_t *var) {
+	return PINNED_BUFFERS && var->owner && var->binding->isPointer && desc_hasBuffer(var->desc) && !var->desc->noDownload;
+}
+
+static cl_int mapVar(cl_command_queue queue, rt_var_t *var, cl_mem buffer, cl_bool blocking, cl_uint waitListLen, const cl_event *waitList, cl_event *event) {
+	cl_int fRet;
+	cl_map_flags flags = (DESC_INPUT == var->desc->kind)? CL_MAP_WRITE : (CL_MAP_READ | CL_MAP_WRITE);
+	void *host = clEnqueueMapBuffer(queue, buffer, blocking, flags, 0, var->desc->nmemb * var->desc->type->size, waitListLen, waitList, event, &fRet);
+
+	/* Pre/postambles access the variable through the mapped region */
+	if(CL_SUCCESS == fRet) {
+		var->host = host;
+		var->mapped = buffer;
+		*((void **) var->binding->var) = host;
+	}
+
+	return fRet;
+}
+
+static cl_int unmapVar(cl_command_queue queue, rt_var_t *var, cl_event *event) {
+	cl_int fRet = clEnqueueUnmapMemObject(queue, var->mapped, var->host, 0, NULL, event);
+
+	if(CL_SUCCESS == fRet)
+		var->mapped = NULL;
+
+	return fRet;
+}
+
+static rt_ndrange_t *findNDRange(const char *name) {
+	unsigned int n;
+
+	for(n = 0; rtNDRanges[n].name; n++) {
+		if(!strcmp(rtNDRanges[n].name, name))
+			return &rtNDRanges[n];
+	}
+
+	return NULL;
+}
+
+static rt_var_t *findVar(rt_kernel_t *kernels, unsigned int kernelsLen, const char *name, rt_var_t *until) {
+	unsigned int k, v;
+
+	for(k = 0; k < kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			if(&(kernels[k].vars[v]) == until)
+				return NULL;
+			if(kernels[k].desc->vars[v].name && !strcmp(kernels[k].desc->vars[v].name, name))
+				return &(kernels[k].vars[v]);
+		}
+	}
+
+	return NULL;
+}
+
+static void setValue(void *dst, const desc_type_t *type, const char *value) {
+	unsigned int c;
+	char *end;
+	long long sValue;
+	unsigned long long uValue;
+	double fValue;
+
+	for(c = 0; c < type->components; c++) {
+		void *comp = ((char *) dst) + c * type->componentSize;
+
+		switch(type->typeClass) {
+			case DESC_CLASS_SIGNED:
+				sValue = strtoll(value, &end, 0);
+				if(1 == type->componentSize)
+					*((signed char *) comp) = sValue;
+				else if(sizeof(short) == type->componentSize)
+					*((short *) comp) = sValue;
+				else if(sizeof(int) == type->componentSize)
+					*((int *) comp) = sValue;
+				else
+					*((long long *) comp) = sValue;
+				break;
+			case DESC_CLASS_UNSIGNED:
+				uValue = strtoull(value, &end, 0);
+				if(1 == type->componentSize)
+					*((unsigned char *) comp) = uValue;
+				else if(sizeof(short) == type->componentSize)
+					*((unsigned short *) comp) = uValue;
+				else if(sizeof(int) == type->componentSize)
+					*((unsigned int *) comp) = uValue;
+				else
+					*((unsigned long long *) comp) = uValue;
+				break;
+			default:
+				fValue = strtod(value, &end);
+				if(sizeof(float) == type->componentSize)
+					*((float *) comp) = fValue;
+				else
+					*((double *) comp) = fValue;
+				break;
+		}
+
+		/* Vector values are separated by commas. If less values are given, last one is repeated */
+		for(; ' ' == *end || ',' == *end; end++);
+		if(*end)
+			value = end;
+	}
+}
+
+static double getFloat(const void *src, size_t sz) {
+	return (sizeof(float) == sz)? *((const float *) src) : *((const double *) src);
+}
+
+static long long getSigned(const void *src, size_t sz) {
+	switch(sz) {
+		case 1:
+			return *((const signed char *) src);
+		case sizeof(short):
+			return *((const short *) src);
+		case sizeof(int):
+			return *((const int *) src);
+		default:
+			return *((const long long *) src);
+	}
+}
+
+static unsigned long long getUnsigned(const void *src, size_t sz) {
+	switch(sz) {
+		case 1:
+			return *((const unsigned char *) src);
+		case sizeof(short):
+			return *((const unsigned short *) src);
+		case sizeof(int):
+			return *((const unsigned int *) src);
+		default:
+			return *((const unsigned long long *) src);
+	}
+}
+
+static bool validate(rt_var_t *var, bool invalidDataFound) {
+	const desc_type_t *type = var->desc->type;
+	unsigned int i, c;
+
+	for(i = 0; i < var->desc->nmemb; i++) {
+		for(c = 0; c < type->components; c++) {
+			size_t offset = i * type->size + c * type->componentSize;
+			const void *got = ((char *) var->host) + offset;
+			const void *expected = ((char *) var->hostC) + offset;
+			bool invalid;
+
+			if(DESC_CLASS_FLOAT == type->typeClass) {
+				double gotF = getFloat(got, type->componentSize);
+				double expectedF = getFloat(expected, type->componentSize);
+
+				invalid = var->desc->hasEpsilon? TEST_EPSILON(expectedF, gotF, var->desc->epsilon) : (expectedF != gotF);
+				if(invalid && !invalidDataFound) {
+					PRINT_FAIL();
+					invalidDataFound = true;
+				}
+				if(invalid && type->components > 1)
+					printf("Variable %s[%u].s[%u]: expected %f got %f.\n", var->desc->name, i, c, expectedF, gotF);
+				else if(invalid)
+					printf("Variable %s[%u]: expected %f got %f.\n", var->desc->name, i, expectedF, gotF);
+			}
+			else {
+				bool isSigned = (DESC_CLASS_SIGNED == type->typeClass);
+				long long gotL = isSigned? getSigned(got, type->componentSize) : (long long) getUnsigned(got, type->componentSize);
+				long long expectedL = isSigned? getSigned(expected, type->componentSize) : (long long) getUnsigned(expected, type->componentSize);
+
+				invalid = var->desc->hasEpsilon? TEST_EPSILON(expectedL, gotL, var->desc->epsilon) : (expectedL != gotL);
+				if(invalid && !invalidDataFound) {
+					PRINT_FAIL();
+					invalidDataFound = true;
+				}
+				if(invalid && type->components > 1)
+					printf("Variable %s[%u].s[%u]: expected %lld got %lld.\n", var->desc->name, i, c, expectedL, gotL);
+				else if(invalid)
+					printf("Variable %s[%u]: expected %lld got %lld.\n", var->desc->name, i, expectedL, gotL);
+			}
+		}
+	}
+
+	return invalidDataFound;
+}
+
+int main(int argc, char *argv[]) {
+	/* Return variable */
+	int rv = EXIT_SUCCESS;
+	int hookRet;
+
+	/* Kernel description */
+	const char *descFileName = RT_DEFAULT_DESCRIPTION;
+	desc_t *desc = NULL;
+	rt_kernel_t *kernels = NULL;
+	unsigned int k, v, nWrites = 0, nReads = 0;
+	char **overrides = NULL;
+	unsigned int overridesLen = 0;
+
+	/* OpenCL and aux variables */
+	int i = 0;
+	unsigned long long totalItems = 0;
+	cl_uint platformsLen, devicesLen;
+	cl_int fRet;
+	cl_platform_id *platforms = NULL;
+	cl_device_id *devices = NULL;
+	cl_context context = NULL;
+	cl_command_queue queue = NULL;
+	cl_command_queue transferQueue = NULL;
+	FILE *programFile = NULL;
+	const char *programFileName;
+	size_t programSz;
+	char *programContent = NULL;
+	cl_int programRet;
+	cl_program program = NULL;
+	cl_uint waitListLen = 0;
+	cl_event *waitList = NULL;
+	bool loopFlag = false;
+	bool invalidDataFound = false;
+
+	/* Benchmark mode, enabled by a maximum number of samples */
+	int opt;
+	unsigned int benchWarmup = RT_BENCH_WARMUP, benchMaxSamples = 0;
+	double benchError = RT_BENCH_ERROR;
+	const char *benchFuncName = NULL;
+	bool tuneMode = false;
+	char buildOptions[RT_MAX_OPTIONS];
+
+	/* Devices in the context, more than one only when splitting a kernel across devices */
+	bool multiDevice = false;
+	cl_uint contextDevicesLen = 1;
+#ifdef RT_MULTI_DEVICE
+	rt_helper_t *helpers = NULL;
+	unsigned int d;
+	cl_uint align, maxAlign = 0;
+	size_t splitStep = 1;
+	const char *splitFuncName = NULL;
+	cl_event doneEvents[RT_MAX_DEVICES];
+	bool ownDoneEvent = false;
+	double weights[RT_MAX_DEVICES], times[RT_MAX_DEVICES];
+	size_t offsets[RT_MAX_DEVICES], sizes[RT_MAX_DEVICES];
+	size_t splitOffset[DESC_MAX_DIMS] = {0, 0, 0};
+	size_t splitGlobal[DESC_MAX_DIMS];
+#endif
+	struct timeval tThen, tNow, tDelta, tExecTime, tProgramTime, tBenchThen, tBenchNow, tBench;
+	timerclear(&tExecTime);
+	PROFILE_DECLARE(profileEvents, RT_MAX_EVENTS);
+	PROGRAM_CACHE_DECLARE(programCache);
+
+	/* Parse command line */
+	overrides = malloc(argc * sizeof(char *));
+	while((opt = getopt(argc, argv, "p:tw:r:e:")) != -1) {
+		switch(opt) {
+			case 'p':
+				overrides[overridesLen++] = optarg;
+				break;
+			case 't':
+				tuneMode = true;
+				break;
+			case 'w':
+				benchWarmup = strtoul(optarg, NULL, 10);
+				break;
+			case 'r':
+				benchMaxSamples = strtoul(optarg, NULL, 10);
+				break;
+			case 'e':
+				benchError = strtod(optarg, NULL);
+				break;
+			default:
+				fprintf(stderr, "Usage: %s [-p NAME=VALUE]... [-t] [-r MAXSAMPLES [-w WARMUP] [-e ERROR]] [DESCRIPTION]\n", argv[0]);
+				free(overrides);
+				return EXIT_FAILURE;
+		}
+	}
+	if(optind < argc)
+		descFileName = argv[optind];
+
+	/* Parse kernel description */
+	PRINT_STEP("Parsing kernel description...");
+	desc = desc_parse(descFileName, overrides, overridesLen);
+	ASSERT_CALL(desc, DESCRIPTION_ERROR_STATEMENTS("could not load kernel description \"%s\".\n", descFileName));
+	currentDesc = desc;
+	kernels = calloc(desc->kernelsLen, sizeof(rt_kernel_t));
+	for(k = 0; k < desc->kernelsLen; k++) {
+		kernels[k].desc = &(desc->kernels[k]);
+		kernels[k].vars = calloc(desc->kernels[k].varsLen, sizeof(rt_var_t));
+		for(v = 0; v < desc->kernels[k].varsLen; v++)
+			kernels[k].vars[v].desc = &(desc->kernels[k].vars[v]);
+	}
+	PRINT_SUCCESS();
+	for(k = 0; k < desc->paramsLen; k++) {
+		if(desc->params[k].isReal)
+			printf("Parameter \"%s\": %g.\n", desc->params[k].name, desc->params[k].real);
+		else
+			printf("Parameter \"%s\": %lld.\n", desc->params[k].name, desc->params[k].value);
+	}
+
+	/* Bind variables and allocate host memory */
+	PRINT_STEP("Binding variables...");
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+			rt_var_t *first;
+
+			if(DESC_LOCAL == var->desc->kind)
+				continue;
+
+			/* Variables with the same name in different kernels share host memory and buffer */
+			first = findVar(kernels, desc->kernelsLen, var->desc->name, var);
+			if(first) {
+				var->binding = first->binding;
+				var->host = first->host;
+				var->hostC = first->hostC;
+				continue;
+			}
+
+			var->owner = true;
+			var->binding = findBinding(var->desc->name);
+			ASSERT_CALL(var->binding, DESCRIPTION_ERROR_STATEMENTS("variable \"%s\" is not bound.\n", var->desc->name));
+			ASSERT_CALL(var->binding->isPointer == desc_isPointer(var->desc),
+				DESCRIPTION_ERROR_STATEMENTS("variable \"%s\" is bound with wrong pointerness.\n", var->desc->name));
+
+			if(var->binding->isPointer) {
+				/* In pinned mode, memory is allocated when creating buffers */
+				if(!isPinned(var)) {
+					var->host = calloc(var->desc->nmemb, var->desc->type->size);
+					ASSERT_CALL(var->host, POSIX_ERROR_STATEMENTS(var->desc->name));
+					*((void **) var->binding->var) = var->host;
+				}
+				*(var->binding->varSz) = var->desc->nmemb;
+
+				if(var->binding->varC && !var->desc->noValidation) {
+					var->hostC = calloc(var->desc->nmemb, var->desc->type->size);
+					ASSERT_CALL(var->hostC, POSIX_ERROR_STATEMENTS(var->desc->name));
+					*((void **) var->binding->varC) = var->hostC;
+					*(var->binding->varCSz) = var->desc->nmemb;
+				}
+			}
+			else {
+				var->host = var->binding->var;
+				if(!var->desc->noValidation)
+					var->hostC = var->binding->varC;
+			}
+
+			if(var->desc->value)
+				setValue(var->host, var->desc->type, var->desc->value);
+		}
+	}
+
+	/* Swapped pairs point to each other and are both resident */
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+
+			if(!var->owner || !var->desc->swap)
+				continue;
+
+			var->swap = findVar(kernels, desc->kernelsLen, var->desc->swap, NULL);
+			ASSERT_CALL(var->swap && desc_hasBuffer(var->desc) && desc_hasBuffer(var->swap->desc) && (var->swap->desc->nmemb == var->desc->nmemb),
+				DESCRIPTION_ERROR_STATEMENTS("invalid swap pair \"%s\" and \"%s\".\n", var->desc->name, var->desc->swap));
+			var->swap->swap = var;
+			var->swap->desc->resident = true;
+		}
+	}
+
+	/* Bind work sizes, which may be changed by the pre/postambles */
+	for(k = 0; k < desc->kernelsLen; k++) {
+		rt_ndrange_t *ndrange = findNDRange(kernels[k].desc->name);
+
+		if(ndrange) {
+			*(ndrange->global) = kernels[k].desc->global;
+			*(ndrange->local) = kernels[k].desc->local;
+		}
+	}
+	PRINT_SUCCESS();
+
+	/* Get platforms IDs */
+	PRINT_STEP("Getting platforms IDs...");
+	fRet = clGetPlatformIDs(0, NULL, &platformsLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	platforms = malloc(platformsLen * sizeof(cl_platform_id));
+	fRet = clGetPlatformIDs(platformsLen, platforms, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetPlatformIDs"));
+	PRINT_SUCCESS();
+
+	/* Get devices IDs for first platform availble */
+	PRINT_STEP("Getting devices IDs for first platform...");
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, NULL, &devicesLen);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	devices = malloc(devicesLen * sizeof(cl_device_id));
+	fRet = clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devicesLen, devices, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDevicesIDs"));
+	PRINT_SUCCESS();
+
+#ifdef RT_MULTI_DEVICE
+	/* Split kernels run on all devices of the platform, which share the context so that partitioned variables are sub-buffers of one buffer */
+	multiDevice = isSplittable(desc);
+	if(multiDevice) {
+		contextDevicesLen = (devicesLen < RT_MAX_DEVICES)? devicesLen : RT_MAX_DEVICES;
+		for(d = 0; d < contextDevicesLen; d++) {
+			fRet = clGetDeviceInfo(devices[d], CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &align, NULL);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clGetDeviceInfo"));
+			if(align > maxAlign)
+				maxAlign = align;
+		}
+
+		/* Every device needs at least one aligned step of work-groups holding data */
+		splitStep = partitionStep(kernels[0].desc, (maxAlign + 7) / 8);
+		if(contextDevicesLen > dataUnits(kernels[0].desc) / splitStep)
+			contextDevicesLen = dataUnits(kernels[0].desc) / splitStep;
+		if(contextDevicesLen < 2)
+			contextDevicesLen = 1;
+		multiDevice = (contextDevicesLen > 1);
+		for(v = 0; multiDevice && (v < kernels[0].desc->varsLen); v++)
+			kernels[0].vars[v].sliced = kernels[0].vars[v].desc->split;
+	}
+#endif
+
+	/* Create context for first available device (or all split devices) */
+	PRINT_STEP("Creating context...");
+	context = clCreateContext(NULL, contextDevicesLen, devices, NULL, NULL, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateContext"));
+	PRINT_SUCCESS();
+
+	/* Create command queues */
+	PRINT_STEP("Creating command queues...");
+	queue = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES | ((benchMaxSamples || tuneMode || multiDevice)? CL_QUEUE_PROFILING_ENABLE : 0), &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	transferQueue = clCreateCommandQueue(context, devices[0], PROFILE_QUEUE_PROPERTIES, &fRet);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+	PRINT_SUCCESS();
+
+	/* Load local sizes tuned for this device, which may be needed to build the program. Partitions of split kernels follow the described local size */
+	for(k = 0; k < desc->kernelsLen; k++) {
+		memcpy(kernels[k].tuneGlobal, kernels[k].desc->global, sizeof(kernels[k].tuneGlobal));
+		if(kernels[k].desc->tune && !multiDevice && loadTuning(devices[0], &kernels[k]))
+			printf("Using tuned local size for kernel \"%s\" from " RT_TUNING_FILE ".\n", kernels[k].desc->name);
+	}
+	getLocalMacros(desc, NULL, NULL, buildOptions);
+
+	/* Split kernels index partitioned variables relative to the global offset */
+	if(multiDevice)
+		strncat(buildOptions, " -DRT_SPLIT", RT_MAX_OPTIONS - strlen(buildOptions) - 1);
+
+	/* Open program file */
+	programFileName = desc->source? desc->source : desc->binary;
+	PRINT_STEP("Opening program file...");
+	programFile = fopen(programFileName, "rb");
+	ASSERT_CALL(programFile, POSIX_ERROR_STATEMENTS(programFileName));
+	PRINT_SUCCESS();
+
+	/* Get size and read file */
+	PRINT_STEP("Reading program file...");
+	fseek(programFile, 0, SEEK_END);
+	programSz = ftell(programFile);
+	fseek(programFile, 0, SEEK_SET);
+	programContent = malloc(programSz);
+	fread(programContent, programSz, 1, programFile);
+	fclose(programFile);
+	programFile = NULL;
+	PRINT_SUCCESS();
+
+	gettimeofday(&tThen, NULL);
+	if(desc->source) {
+		/* Create program from cached binary, if available. Cached binaries are built for a single device */
+		if(1 == contextDevicesLen) {
+			PRINT_STEP("Looking for cached program binary...");
+			PROGRAM_CACHE_LOAD(programCache, program, context, devices[0], programContent, programSz, buildOptions);
+			PRINT_SUCCESS();
+		}
+
+		/* Create program from source file */
+		if(!programCacheHit) {
+			PRINT_STEP("Creating program from source...");
+			program = clCreateProgramWithSource(context, 1, (const char **) &programContent, &programSz, &fRet);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithSource"));
+			PRINT_SUCCESS();
+		}
+	}
+	else {
+		/* Create program from binary file */
+		PRINT_STEP("Creating program from binary...");
+		program = clCreateProgramWithBinary(context, 1, devices, &programSz, (const unsigned char **) &programContent, &programRet, &fRet);
+		ASSERT_CALL(CL_SUCCESS == programRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary (when loading binary)"));
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateProgramWithBinary"));
+		PRINT_SUCCESS();
+	}
+
+	/* Build program */
+	PRINT_STEP("Building program...");
+	fRet = clBuildProgram(program, contextDevicesLen, devices, buildOptions, NULL, NULL);
+	ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clBuildProgram"));
+	PRINT_SUCCESS();
+
+	/* Store program binary in cache */
+	if(desc->source && (1 == contextDevicesLen)) {
+		PROGRAM_CACHE_STORE(programCache, program);
+	}
+	gettimeofday(&tNow, NULL);
+	timersub(&tNow, &tThen, &tProgramTime);
+
+	/* Create kernels */
+	for(k = 0; k < desc->kernelsLen; k++) {
+		PRINT_STEP("Creating kernel \"%s\" from program...", kernels[k].desc->name);
+		kernels[k].kernel = clCreateKernel(program, kernels[k].desc->name, &fRet);
+		ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel"));
+		PRINT_SUCCESS();
+	}
+
+	/* Create input and output buffers */
+	PRINT_STEP("Creating buffers...");
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+
+			if(!desc_hasBuffer(var->desc))
+				continue;
+
+			if(var->owner) {
+				var->buffer = clCreateBuffer(context, ((DESC_INPUT == var->desc->kind)? CL_MEM_READ_ONLY : CL_MEM_READ_WRITE) | (isPinned(var)? PINNED_MEM_FLAGS : 0),
+					var->desc->nmemb * var->desc->type->size, NULL, &fRet);
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateBuffer"));
+
+				if(isPinned(var)) {
+					fRet = mapVar(transferQueue, var, var->buffer, CL_TRUE, 0, NULL, NULL);
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueMapBuffer"));
+					memset(var->host, 0, var->desc->nmemb * var->desc->type->size);
+				}
+
+				/* Pinned buffers are unmapped and mapped back every iteration, even when not uploaded. Sliced variables are transferred per device */
+				if(!var->desc->resident && !var->sliced && (isPinned(var) || !var->desc->noUpload))
+					nWrites++;
+				if(!var->desc->resident && !var->sliced && (isPinned(var) || ((DESC_OUTPUT == var->desc->kind) && !var->desc->noDownload)))
+					nReads++;
+			}
+			else {
+				var->buffer = findVar(kernels, desc->kernelsLen, var->desc->name, var)->buffer;
+			}
+
+		}
+	}
+	ASSERT_CALL(nWrites + desc->kernelsLen + nReads <= RT_MAX_EVENTS, DESCRIPTION_ERROR_STATEMENTS("too many commands per iteration.\n"));
+	PRINT_SUCCESS();
+
+	/* Calling preamble function */
+	hookRet = hooks_preamble(&loopFlag);
+	ASSERT_CALL(EXIT_SUCCESS == hookRet, rv = EXIT_FAILURE);
+
+	/* Set kernel arguments */
+	for(k = 0; k < desc->kernelsLen; k++) {
+		PRINT_STEP("Setting kernel arguments for \"%s\"...", kernels[k].desc->name);
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+
+			if(DESC_LOCAL == var->desc->kind)
+				fRet = clSetKernelArg(kernels[k].kernel, var->desc->arg, var->desc->nmemb * var->desc->type->size, NULL);
+			else if(desc_hasBuffer(var->desc))
+				fRet = clSetKernelArg(kernels[k].kernel, var->desc->arg, sizeof(cl_mem), &(var->buffer));
+			else
+				fRet = clSetKernelArg(kernels[k].kernel, var->desc->arg, var->desc->type->size, var->host);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg"));
+		}
+		PRINT_SUCCESS();
+	}
+
+#ifdef RT_MULTI_DEVICE
+	/* Set up a queue and kernel for every other device of the context, sharing the program and the buffers */
+	if(multiDevice) {
+		PRINT_STEP("Setting up additional devices...");
+		helpers = calloc(contextDevicesLen, sizeof(rt_helper_t));
+		for(d = 0; d < contextDevicesLen; d++) {
+			rt_helper_t *helper = &helpers[d];
+
+			helper->subBuffers = calloc(kernels[0].desc->varsLen, sizeof(cl_mem));
+			if(!d) {
+				helper->queue = queue;
+				helper->kernel = kernels[0].kernel;
+				continue;
+			}
+
+			helper->queue = clCreateCommandQueue(context, devices[d], CL_QUEUE_PROFILING_ENABLE, &fRet);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateCommandQueue"));
+			helper->kernel = clCreateKernel(program, kernels[0].desc->name, &fRet);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clCreateKernel"));
+
+			/* Sliced variables and values are set every iteration */
+			for(v = 0; v < kernels[0].desc->varsLen; v++) {
+				rt_var_t *var = &(kernels[0].vars[v]);
+
+				if(DESC_LOCAL == var->desc->kind)
+					fRet = clSetKernelArg(helper->kernel, var->desc->arg, var->desc->nmemb * var->desc->type->size, NULL);
+				else if(desc_hasBuffer(var->desc) && !var->sliced)
+					fRet = clSetKernelArg(helper->kernel, var->desc->arg, sizeof(cl_mem), &(var->buffer));
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg"));
+			}
+		}
+		PRINT_SUCCESS();
+
+		loadCalibration(devices, contextDevicesLen, weights);
+		printf("Splitting kernel \"%s\" across %u device(s).\n", kernels[0].desc->name, contextDevicesLen);
+		if(benchMaxSamples)
+			printf("Benchmark mode is not available for split kernels.\n");
+	}
+#endif
+
+	/* Setting resident buffers (uploaded only once) */
+	PRINT_STEP("Setting resident buffers...");
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+
+			if(!var->owner || !desc_hasBuffer(var->desc) || !var->desc->resident)
+				continue;
+
+			if(isPinned(var)) {
+				fRet = unmapVar(transferQueue, var, PROFILE_EVENT(profileEvents, PROFILE_WRITE, var->desc->name));
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueUnmapMemObject"));
+			}
+			else if(!var->desc->noUpload) {
+				fRet = clEnqueueWriteBuffer(transferQueue, var->buffer, CL_TRUE, 0, var->desc->nmemb * var->desc->type->size, var->host,
+					0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, var->desc->name));
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer"));
+			}
+		}
+	}
+	clFinish(transferQueue);
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
+	do {
+		/* Calling loop preamble function */
+		hookRet = hooks_loopPreamble(i, &loopFlag);
+		if(RT_HOOK_BREAK == hookRet)
+			break;
+		ASSERT_CALL(EXIT_SUCCESS == hookRet, rv = EXIT_FAILURE);
+
+		/* Setting input and output buffers */
+		PRINT_STEP("[%d] Setting buffers...", i);
+		for(k = 0; k < desc->kernelsLen; k++) {
+			for(v = 0; v < kernels[k].desc->varsLen; v++) {
+				rt_var_t *var = &(kernels[k].vars[v]);
+
+				if(DESC_LOCAL == var->desc->kind)
+					continue;
+
+				if(!desc_hasBuffer(var->desc)) {
+					fRet = clSetKernelArg(kernels[k].kernel, var->desc->arg, var->desc->type->size, var->host);
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg"));
+				}
+				else if(var->swap) {
+					/* Kernel arguments are swapped on device every iteration */
+					fRet = clSetKernelArg(kernels[k].kernel, var->desc->arg, sizeof(cl_mem), (i % 2)? &(var->swap->buffer) : &(var->buffer));
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clSetKernelArg"));
+				}
+				else if(isPinned(var) && !var->desc->resident) {
+					fRet = unmapVar(transferQueue, var, PROFILE_EVENT(profileEvents, PROFILE_WRITE, var->desc->name));
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueUnmapMemObject"));
+				}
+				else if(var->owner && !var->desc->resident && !var->desc->noUpload && !var->sliced) {
+					fRet = clEnqueueWriteBuffer(transferQueue, var->buffer, TRANSFER_BLOCKING, 0, var->desc->nmemb * var->desc->type->size, var->host,
+						0, NULL, PROFILE_EVENT(profileEvents, PROFILE_WRITE, var->desc->name));
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueWriteBuffer"));
+				}
+			}
+		}
+
+#ifdef RT_MULTI_DEVICE
+		/* Each device receives a partition of the first dimension, in proportion to its throughput in the previous iteration */
+		if(multiDevice) {
+			partition(kernels[0].desc, weights, contextDevicesLen, splitStep, offsets, sizes);
+			fRet = splitVars(helpers, contextDevicesLen, &kernels[0], offsets, sizes, &splitFuncName);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS(splitFuncName));
+		}
+#endif
+		PRINT_SUCCESS();
+
+#ifdef COMMON_ASYNC_TRANSFERS
+		/* First kernel waits for all writes */
+		waitListLen = nWrites;
+		waitList = nWrites? &profileEvents[0] : NULL;
+#else
+		/* Unmapping is never blocking */
+		if(PINNED_BUFFERS)
+			clFinish(transferQueue);
+#endif
+
+		PRINT_STEP("[%d] Running kernels...", i);
+		clFlush(transferQueue);
+		timerclear(&tBench);
+		gettimeofday(&tThen, NULL);
+#ifdef RT_MULTI_DEVICE
+		if(multiDevice) {
+			cl_event *kernelEvent;
+
+			/* Each device executes its partition of the first dimension, after the writes of shared variables */
+			memcpy(splitGlobal, kernels[0].desc->global, sizeof(splitGlobal));
+			for(d = 1; d < contextDevicesLen; d++) {
+				splitOffset[0] = offsets[d];
+				splitGlobal[0] = sizes[d];
+				fRet = clEnqueueNDRangeKernel(helpers[d].queue, helpers[d].kernel, kernels[0].desc->dim, splitOffset, splitGlobal, kernels[0].desc->hasLocal? kernels[0].desc->local : NULL,
+					waitListLen, waitList, &doneEvents[d]);
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
+				clFlush(helpers[d].queue);
+			}
+
+			splitOffset[0] = offsets[0];
+			splitGlobal[0] = sizes[0];
+			kernelEvent = PROFILE_EVENT(profileEvents, PROFILE_KERNEL, kernels[0].desc->name);
+			ownDoneEvent = !kernelEvent;
+			fRet = clEnqueueNDRangeKernel(queue, kernels[0].kernel, kernels[0].desc->dim, splitOffset, splitGlobal, kernels[0].desc->hasLocal? kernels[0].desc->local : NULL,
+				waitListLen, waitList, ownDoneEvent? &doneEvents[0] : kernelEvent);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
+			if(!ownDoneEvent)
+				doneEvents[0] = *kernelEvent;
+			clFlush(queue);
+
+			fRet = measureDevices(doneEvents, contextDevicesLen, times);
+			for(d = ownDoneEvent? 0 : 1; d < contextDevicesLen; d++)
+				clReleaseEvent(doneEvents[d]);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clWaitForEvents"));
+		}
+		else
+#endif
+		for(k = 0; k < desc->kernelsLen; k++) {
+			/* Tuning and benchmark launches run before the actual one, from the same state, and are not accounted in the elapsed time */
+			if(benchMaxSamples || (tuneMode && kernels[k].desc->tune && !kernels[k].tuned)) {
+				gettimeofday(&tBenchThen, NULL);
+				clFinish(transferQueue);
+				clFinish(queue);
+				if(tuneMode && kernels[k].desc->tune && !kernels[k].tuned) {
+					fRet = tuneKernel(context, devices[0], queue, desc, &kernels[k], i, desc->source? programContent : NULL, programSz, &benchFuncName);
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS(benchFuncName));
+					kernels[k].tuned = true;
+				}
+				if(benchMaxSamples) {
+					fRet = benchmarkKernel(context, queue, &kernels[k], i, benchWarmup, benchMaxSamples, benchError, &benchFuncName);
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS(benchFuncName));
+				}
+				gettimeofday(&tBenchNow, NULL);
+				timersub(&tBenchNow, &tBenchThen, &tDelta);
+				timeradd(&tBench, &tDelta, &tBench);
+			}
+
+			fRet = clEnqueueNDRangeKernel(queue, kernels[k].kernel, kernels[k].desc->dim, NULL, kernels[k].desc->global, kernels[k].desc->hasLocal? kernels[k].desc->local : NULL,
+				k? 0 : waitListLen, k? NULL : waitList, PROFILE_EVENT(profileEvents, PROFILE_KERNEL, kernels[k].desc->name));
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueNDRangeKernel"));
+		}
+		clFinish(queue);
+		gettimeofday(&tNow, NULL);
+		PRINT_SUCCESS();
+
+#ifdef COMMON_ASYNC_TRANSFERS
+		/* Reads wait for last kernel */
+		waitListLen = 1;
+		waitList = &profileEvents[nWrites + desc->kernelsLen - 1];
+#endif
+
+		/* Get output buffers */
+		PRINT_STEP("[%d] Getting kernels arguments...", i);
+		for(k = 0; k < desc->kernelsLen; k++) {
+			for(v = 0; v < kernels[k].desc->varsLen; v++) {
+				rt_var_t *var = &(kernels[k].vars[v]);
+
+				if(isPinned(var) && !var->desc->resident) {
+					fRet = mapVar(transferQueue, var, var->buffer, TRANSFER_BLOCKING, waitListLen, waitList, PROFILE_EVENT(profileEvents, PROFILE_READ, var->desc->name));
+					ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueMapBuffer"));
+					continue;
+				}
+
+				if(!var->owner || !desc_hasBuffer(var->desc) || var->desc->resident || (var->desc->kind != DESC_OUTPUT) || var->desc->noDownload || var->sliced)
+					continue;
+
+				fRet = clEnqueueReadBuffer(transferQueue, var->buffer, TRANSFER_BLOCKING, 0, var->desc->nmemb * var->desc->type->size, var->host,
+					waitListLen, waitList, PROFILE_EVENT(profileEvents, PROFILE_READ, var->desc->name));
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+			}
+		}
+		if(nReads) {
+			ASYNC_WAIT(profileEvents, nWrites + desc->kernelsLen, nReads);
+		}
+
+#ifdef RT_MULTI_DEVICE
+		/* Gather the slices of all devices and rebalance according to measured throughput */
+		if(multiDevice) {
+			fRet = gatherVars(helpers, contextDevicesLen, &kernels[0], offsets, sizes);
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		}
+		for(d = 0; multiDevice && (d < contextDevicesLen); d++) {
+			if(times[d] > 0)
+				weights[d] = sizes[d] / times[d];
+		}
+#endif
+		PRINT_SUCCESS();
+		PROFILE_REPORT(profileEvents, i);
+
+		/* Calling loop postamble function */
+		hookRet = hooks_loopPostamble(i, &loopFlag);
+		ASSERT_CALL(EXIT_SUCCESS == hookRet, rv = EXIT_FAILURE);
+
+		totalItems += (iterationItems >= 0)? (unsigned long long) iterationItems : desc->items;
+		iterationItems = -1;
+
+		timersub(&tNow, &tThen, &tDelta);
+		timersub(&tDelta, &tBench, &tDelta);
+		timeradd(&tExecTime, &tDelta, &tExecTime);
+		i++;
+	} while(loopFlag);
+
+	/* Get resident output buffers */
+	PRINT_STEP("Getting kernels arguments...");
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			rt_var_t *var = &(kernels[k].vars[v]);
+
+			/* For swapped pairs, buffer holding the variable depends on the number of executed iterations */
+			if(isPinned(var) && var->desc->resident) {
+				fRet = mapVar(transferQueue, var, currentBuffer(var, i), CL_TRUE, 0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, var->desc->name));
+				ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueMapBuffer"));
+				continue;
+			}
+
+			if(!var->owner || !desc_hasBuffer(var->desc) || !var->desc->resident || (var->desc->kind != DESC_OUTPUT) || var->desc->noDownload)
+				continue;
+
+			fRet = clEnqueueReadBuffer(transferQueue, currentBuffer(var, i), CL_TRUE, 0, var->desc->nmemb * var->desc->type->size, var->host,
+				0, NULL, PROFILE_EVENT(profileEvents, PROFILE_READ, var->desc->name));
+			ASSERT_CALL(CL_SUCCESS == fRet, FUNCTION_ERROR_STATEMENTS("clEnqueueReadBuffer"));
+		}
+	}
+	PRINT_SUCCESS();
+	PROFILE_REPORT(profileEvents, i);
+
+	/* Calling postamble function */
+	hookRet = hooks_postamble(i);
+	ASSERT_CALL(EXIT_SUCCESS == hookRet, rv = EXIT_FAILURE);
+
+	/* Print profiling results */
+	long totalTime = (1000000 * tExecTime.tv_sec) + tExecTime.tv_usec;
+	printf("Elapsed time spent on kernels: %ld us; Average time per iteration: %lf us.\n", totalTime, totalTime / (double) i);
+	if(desc->items && totalTime)
+		printf("Throughput: %lf %s/s (%llu in %d iterations).\n", (totalItems * 1000000.0) / totalTime, desc->itemsUnit? desc->itemsUnit : "items", totalItems, i);
+	if(desc->bytes && totalTime) {
+		double bandwidth = (desc->bytes * (double) i) / (totalTime * 1000.0);
+
+		printf("Bandwidth: %lf GB/s (%llu bytes per iteration)", bandwidth, desc->bytes);
+		if(desc->peakBandwidth > 0)
+			printf(", %.1lf%% of the %lf GB/s peak", (100 * bandwidth) / desc->peakBandwidth, desc->peakBandwidth);
+		printf(".\n");
+	}
+	if(desc->flops && totalTime)
+		printf("Performance: %lf GFLOP/s (%llu operations per iteration).\n", (desc->flops * (double) i) / (totalTime * 1000.0), desc->flops);
+	PROFILE_SUMMARY(profileEvents, i);
+	for(k = 0; k < desc->kernelsLen; k++) {
+		if(kernels[k].bench.samplesLen)
+			reportBenchmark(&kernels[k]);
+	}
+#ifdef RT_MULTI_DEVICE
+	if(multiDevice) {
+		for(d = 0; d < contextDevicesLen; d++) {
+			char name[256];
+
+			clGetDeviceInfo(devices[d], CL_DEVICE_NAME, sizeof(name), name, NULL);
+			printf("Device %u (%s): %lu work-items in last iteration.\n", d, name, (unsigned long) sizes[d]);
+		}
+		storeCalibration(devices, contextDevicesLen, weights);
+	}
+#endif
+	printf("Time spent on program setup: %ld us (%s).\n", (1000000 * tProgramTime.tv_sec) + tProgramTime.tv_usec, programCacheHit? "loaded from binary cache" : "built from source");
+
+	/* Validate received data */
+	PRINT_STEP("Validating received data...");
+	for(k = 0; k < desc->kernelsLen; k++) {
+		for(v = 0; v < kernels[k].desc->varsLen; v++) {
+			if(kernels[k].vars[v].owner && kernels[k].vars[v].hostC)
+				invalidDataFound = validate(&(kernels[k].vars[v]), invalidDataFound);
+		}
+	}
+	if(!invalidDataFound)
+		PRINT_SUCCESS();
+
+_err:
+
+	/* Dealloc pending events */
+	PROFILE_RELEASE(profileEvents);
+
+#ifdef RT_MULTI_DEVICE
+	/* Dealloc sub-buffers and additional devices, before the buffers they belong to */
+	if(helpers) {
+		for(d = 0; d < contextDevicesLen; d++) {
+			for(v = 0; helpers[d].subBuffers && (v < desc->kernels[0].varsLen); v++) {
+				if(helpers[d].subBuffers[v])
+					clReleaseMemObject(helpers[d].subBuffers[v]);
+			}
+			free(helpers[d].subBuffers);
+			if(!d)
+				continue;
+			if(helpers[d].kernel)
+				clReleaseKernel(helpers[d].kernel);
+			if(helpers[d].queue)
+				clReleaseCommandQueue(helpers[d].queue);
+		}
+		free(helpers);
+	}
+#endif
+
+	/* Dealloc buffers, kernels and variables */
+	if(kernels) {
+		for(k = 0; k < desc->kernelsLen; k++) {
+			for(v = 0; kernels[k].vars && v < kernels[k].desc->varsLen; v++) {
+				rt_var_t *var = &(kernels[k].vars[v]);
+
+				if(!var->owner)
+					continue;
+
+				if(var->mapped)
+					unmapVar(transferQueue, var, NULL);
+				if(var->buffer)
+					clReleaseMemObject(var->buffer);
+
+				if(var->binding && var->binding->isPointer) {
+					if(!isPinned(var))
+						free(var->host);
+					free(var->hostC);
+				}
+			}
+
+			for(v = 0; kernels[k].bench.backups && (v < kernels[k].desc->varsLen); v++) {
+				if(kernels[k].bench.backups[v])
+					clReleaseMemObject(kernels[k].bench.backups[v]);
+			}
+			free(kernels[k].bench.backups);
+			free(kernels[k].bench.samples);
+
+			if(kernels[k].kernel)
+				clReleaseKernel(kernels[k].kernel);
+			if(kernels[k].program)
+				clReleaseProgram(kernels[k].program);
+			free(kernels[k].vars);
+		}
+		free(kernels);
+	}
+
+	/* Dealloc program */
+	if(program)
+		clReleaseProgram(program);
+	if(programContent)
+		free(programContent);
+	if(programFile)
+		fclose(programFile);
+
+	/* Dealloc queues */
+	if(queue)
+		clReleaseCommandQueue(queue);
+	if(transferQueue)
+		clReleaseCommandQueue(transferQueue);
+
+	/* Last OpenCL variables */
+	if(context)
+		clReleaseContext(context);
+	if(devices)
+		free(devices);
+	if(platforms)
+		free(platforms);
+
+	/* Calling cleanup function */
+	hooks_cleanup();
+
+	currentDesc = NULL;
+	desc_destroy(&desc);
+	free(overrides);
+
+	return rv;
+}